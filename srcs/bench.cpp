@@ -0,0 +1,199 @@
+#include <gmath.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+//**** CONFIG ******************************************************************
+
+static const std::size_t	PARTICLES = 1 << 20;
+static const int			STEPS = 20;
+static const std::size_t	NORMALS = 10000000;
+// Normalized block, small enough to stay in L1 so the sqrt is timed and not
+// the memory bandwidth
+static const std::size_t	NORMALS_BLOCK = 1000;
+
+//**** STATIC FUNCTIONS ********************************************************
+
+/**
+ * @brief Run a function STEPS times and return the best time of one run.
+ *
+ * @param function The function to time.
+ *
+ * @return Best time in milliseconds.
+ */
+template <typename F>
+static double	timeIt(F function)
+{
+	double	best = 1e30;
+
+	for (int i = 0; i < STEPS; i++)
+	{
+		const auto	start = std::chrono::steady_clock::now();
+
+		function();
+
+		const auto	end = std::chrono::steady_clock::now();
+		const double	ms = std::chrono::duration<double, std::milli>(end - start).count();
+
+		if (ms < best)
+			best = ms;
+	}
+	return (best);
+}
+
+/**
+ * @brief Print the result of a comparison.
+ *
+ * @param name Name of the benchmark.
+ * @param reference Time of the reference version.
+ * @param optimized Time of the optimized version.
+ */
+static void	report(const std::string &name, double reference, double optimized)
+{
+	std::cout << std::left << std::setw(36) << name
+			<< std::right << std::fixed << std::setprecision(3)
+			<< std::setw(10) << reference << " ms"
+			<< std::setw(10) << optimized << " ms"
+			<< std::setw(8) << std::setprecision(2) << reference / optimized << "x" << std::endl;
+}
+
+/**
+ * @brief Print the time of a benchmark without reference.
+ *
+ * @param name Name of the benchmark.
+ * @param time Time of the benchmark.
+ */
+static void	report(const std::string &name, double time)
+{
+	std::cout << std::left << std::setw(36) << name
+			<< std::right << std::fixed << std::setprecision(3)
+			<< std::setw(23) << time << " ms" << std::endl;
+}
+
+//---- Expression templates ----------------------------------------------------
+
+// Semi-implicit Euler step: pos += vel * dt + acc * dt^2 / 2, vel += acc * dt.
+static void	benchLazy(void)
+{
+	const float		dt = 1.0f / 60.0f;
+	const float		halfDt2 = 0.5f * dt * dt;
+	gm::Vec3SoAf	pos(PARTICLES);
+	gm::Vec3SoAf	vel(PARTICLES);
+	gm::Vec3SoAf	acc(PARTICLES);
+	gm::Vec3SoAf	tmp(PARTICLES);
+
+	for (std::size_t i = 0; i < PARTICLES; i++)
+	{
+		pos[i] = gm::Vec3f(gm::fRand(), gm::fRand(), gm::fRand());
+		vel[i] = gm::Vec3f(gm::fRand(), gm::fRand(), gm::fRand());
+		acc[i] = gm::Vec3f(0.0f, -9.81f, gm::fRand());
+	}
+
+	const double	soaEager = timeIt([&]() {
+		gm::scale(vel, dt, tmp);
+		gm::add(pos, tmp, pos);
+		gm::scale(acc, halfDt2, tmp);
+		gm::add(pos, tmp, pos);
+		gm::scale(acc, dt, tmp);
+		gm::add(vel, tmp, vel);
+	});
+	const double	soaLazy = timeIt([&]() {
+		gm::assign(pos, gm::lazy(pos) + gm::lazy(vel) * dt + gm::lazy(acc) * halfDt2);
+		gm::assign(vel, gm::lazy(vel) + gm::lazy(acc) * dt);
+	});
+	report("Vec3SoAf euler step, bulk vs lazy", soaEager, soaLazy);
+
+	std::vector<gm::Vec3f>	aosPos(PARTICLES);
+	std::vector<gm::Vec3f>	aosVel(PARTICLES);
+	std::vector<gm::Vec3f>	aosAcc(PARTICLES);
+
+	for (std::size_t i = 0; i < PARTICLES; i++)
+	{
+		aosPos[i] = pos[i];
+		aosVel[i] = vel[i];
+		aosAcc[i] = acc[i];
+	}
+
+	const double	aosEager = timeIt([&]() {
+		for (std::size_t i = 0; i < PARTICLES; i++)
+		{
+			aosPos[i] = aosPos[i] + aosVel[i] * dt + aosAcc[i] * halfDt2;
+			aosVel[i] = aosVel[i] + aosAcc[i] * dt;
+		}
+	});
+	const double	aosLazy = timeIt([&]() {
+		for (std::size_t i = 0; i < PARTICLES; i++)
+		{
+			gm::assign(aosPos[i], gm::lazy(aosPos[i]) + gm::lazy(aosVel[i]) * dt + gm::lazy(aosAcc[i]) * halfDt2);
+			gm::assign(aosVel[i], gm::lazy(aosVel[i]) + gm::lazy(aosAcc[i]) * dt);
+		}
+	});
+	report("Vec3f euler step, operators vs lazy", aosEager, aosLazy);
+}
+
+//---- Precision policy --------------------------------------------------------
+
+// Built twice, libgmathBenchPrecise with GM_PRECISE_FLOAT: compare the times
+// of both executables. gcc folds a float sqrt computed in double back to
+// sqrtf, so normalize can run at the same speed, sin and cos can't be folded.
+static void	benchPrecision(void)
+{
+	static volatile float	sink;
+	std::vector<gm::Vec3f>	src(NORMALS_BLOCK);
+	std::vector<gm::Vec3f>	dst(NORMALS_BLOCK);
+	std::vector<float>		angles(NORMALS_BLOCK);
+	std::vector<gm::Quatf>	rotations(NORMALS_BLOCK);
+
+	for (std::size_t i = 0; i < NORMALS_BLOCK; i++)
+	{
+		src[i] = gm::Vec3f(gm::fRand(), gm::fRand(), gm::fRand());
+		angles[i] = gm::fRand() * 6.28318531f;
+	}
+
+	const double	normalize = timeIt([&]() {
+		for (std::size_t n = 0; n < NORMALS; n += NORMALS_BLOCK)
+		{
+			for (std::size_t i = 0; i < NORMALS_BLOCK; i++)
+				dst[i] = gm::normalize(src[i]);
+			// Read back one result of every pass, so none is optimized out
+			sink = dst[n % NORMALS_BLOCK].x;
+		}
+	});
+	const double	rotation = timeIt([&]() {
+		for (std::size_t n = 0; n < NORMALS; n += NORMALS_BLOCK)
+		{
+			for (std::size_t i = 0; i < NORMALS_BLOCK; i++)
+				rotations[i] = gm::Quatf::rotation(dst[i], angles[i]);
+			sink = rotations[n % NORMALS_BLOCK].w;
+		}
+	});
+	static_cast<void>(sink);
+#ifdef GM_PRECISE_FLOAT
+	report("10M Vec3f normalize, float in double", normalize);
+	report("10M Quatf rotation, float in double", rotation);
+#else
+	report("10M Vec3f normalize, float in float", normalize);
+	report("10M Quatf rotation, float in float", rotation);
+#endif
+}
+
+//**** MAIN ********************************************************************
+
+int	main(void)
+{
+	std::cout << "simd level : " << static_cast<int>(gm::kernels().level)
+				<< ", " << PARTICLES << " vectors, best of " << STEPS << " runs" << std::endl;
+	std::cout << std::left << std::setw(36) << "benchmark"
+			<< std::right << std::setw(13) << "reference" << std::setw(13) << "optimized"
+			<< std::setw(9) << "speedup" << std::endl;
+
+	benchLazy();
+	benchPrecision();
+
+	return (0);
+}
@@ -10,15 +10,40 @@
 # include <gmath/Vec2.hpp>
 # include <gmath/Vec3.hpp>
 # include <gmath/Vec4.hpp>
+# include <gmath/Vec3A.hpp>
+# include <gmath/componentwise.hpp>
+# include <gmath/half.hpp>
+# include <gmath/normals.hpp>
+
+// Include structure of arrays vectors
+# include <gmath/Vec2SoA.hpp>
+# include <gmath/Vec3SoA.hpp>
+# include <gmath/Vec4SoA.hpp>
+
+// Expression templates
+# include <gmath/lazy.hpp>
 
 // Include matrix
 # include <gmath/Mat2.hpp>
 # include <gmath/Mat3.hpp>
 # include <gmath/Mat4.hpp>
 # include <gmath/inverse.hpp>
+# include <gmath/aligned.hpp>
 
 // Vector matrix operations
 # include <gmath/VecMat.hpp>
+# include <gmath/transform.hpp>
+# include <gmath/Affine3.hpp>
+# include <gmath/Quat.hpp>
+# include <gmath/fast.hpp>
+# include <gmath/Frustum.hpp>
+
+// Gpu buffers
+# include <gmath/blockLayout.hpp>
+
+// Batch kernels
+# include <gmath/dispatch.hpp>
+# include <gmath/batch.hpp>
 
 // Include perlin noise
 # include <gmath/PerlinNoise.hpp>
@@ -0,0 +1,352 @@
+#ifndef GM_AFFINE3_HPP
+# define GM_AFFINE3_HPP
+
+# include <gmath/Vec3.hpp>
+# include <gmath/Mat3.hpp>
+# include <gmath/Mat4.hpp>
+# include <gmath/VecMat.hpp>
+# include <gmath/inverse.hpp>
+
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include <type_traits>
+
+namespace gm {
+	//**** STATIC FUNCTIONS DEFINE *********************************************
+	//**** CLASS DEFINE ********************************************************
+
+	/**
+	 * @brief Class for 3d affine transform, stored as a 3x4 matrix.
+	 *
+	 * @tparam T Type of value in the transform.
+	 *
+	 * Same transform than a Mat4 with a last line at (0, 0, 0, 1), without
+	 * storing or computing it: compose cost 36 multiplications instead of 64
+	 * and a point transform 9 multiplications.
+	 */
+	template <typename T>
+	class Affine3
+	{
+	public:
+		Mat3<T>	linear;
+		Vec3<T>	offset;
+
+		//**** INITIALISION ****************************************************
+		//---- Constructors ----------------------------------------------------
+
+		/**
+		 * @brief Default constructor of Affine3 class.
+		 *
+		 * @return The Affine3 with values at 0.
+		 */
+		constexpr Affine3(void) : linear(), offset() {}
+
+		/**
+		 * @brief Constructor of Affine3 class.
+		 *
+		 * @param linear The linear part (rotation, scale, shear).
+		 * @param offset The translation, applied after linear.
+		 *
+		 * @return The Affine3 of x -> linear * x + offset.
+		 */
+		constexpr Affine3(const Mat3<T> &linear, const Vec3<T> &offset) : linear(linear), offset(offset) {}
+
+		/**
+		 * @brief Constructor of Affine3 class from a Mat4.
+		 *
+		 * @param mat4 The Mat4 to convert, of any layout, its last line is
+		 * ignored.
+		 *
+		 * @return The Affine3 with the 3 first lines of mat4.
+		 */
+		template <class L>
+		constexpr explicit Affine3(const Mat4<T, L> &mat4)
+			: linear(mat4.at(0, 0), mat4.at(1, 0), mat4.at(2, 0),
+					mat4.at(0, 1), mat4.at(1, 1), mat4.at(2, 1),
+					mat4.at(0, 2), mat4.at(1, 2), mat4.at(2, 2)),
+			  offset(mat4.at(3, 0), mat4.at(3, 1), mat4.at(3, 2)) {}
+
+		//**** OPERATORS *******************************************************
+		//---- Modify Operators ------------------------------------------------
+
+		/**
+		 * @brief Compose with another transform, applied before this one.
+		 *
+		 * @param affine3 The transform to compose.
+		 *
+		 * @return Reference to the Affine3, this * affine3.
+		 */
+		constexpr Affine3	&operator*=(const Affine3 &affine3)
+		{
+			this->offset = this->linear * affine3.offset + this->offset;
+			this->linear = this->linear * affine3.linear;
+
+			return (*this);
+		}
+
+		//---- Compare Operators -----------------------------------------------
+
+		constexpr bool	operator==(const Affine3 &affine3) const
+		{
+			return (this->linear == affine3.linear && this->offset == affine3.offset);
+		}
+
+		constexpr bool	operator!=(const Affine3 &affine3) const
+		{
+			return (this->linear != affine3.linear || this->offset != affine3.offset);
+		}
+
+		//---- Cast Operators --------------------------------------------------
+
+		/**
+		 * @brief Convert to a Mat4 of any layout.
+		 *
+		 * @return The Mat4 of the transform, last line at (0, 0, 0, 1).
+		 */
+		template <class L>
+		constexpr explicit operator Mat4<T, L>(void) const
+		{
+			const T	*l = this->linear.values;
+
+			return (Mat4<T, L>(l[0], l[1], l[2], this->offset.x,
+							l[3], l[4], l[5], this->offset.y,
+							l[6], l[7], l[8], this->offset.z,
+							T(), T(), T(), static_cast<T>(1)));
+		}
+
+		//**** STATIC METHODS **************************************************
+
+		/**
+		 * @brief Create identity transform.
+		 *
+		 * @return Identity transform.
+		 */
+		static constexpr Affine3<T>	identity(void)
+		{
+			return (Affine3<T>(Mat3<T>::identity(), Vec3<T>()));
+		}
+
+		/**
+		 * @brief Create rotation transform, same as Mat4::rotation3D.
+		 *
+		 * @param axis Vec3 to tell on wich axis the rotation will be done. It must be normalized.
+		 * @param radians The angle in radians.
+		 *
+		 * @return Rotation transform of parameter.
+		 */
+		static Affine3<T>	rotation(const Vec3<T> &axis, T radians)
+		{
+			return (Affine3<T>(Mat3<T>::rotation(axis, radians), Vec3<T>()));
+		}
+
+		/**
+		 * @brief Create translation transform.
+		 *
+		 * @param movement Vec3 for the translation to apply.
+		 *
+		 * @return Translation transform of parameter.
+		 */
+		static constexpr Affine3<T>	translation(const Vec3<T> &movement)
+		{
+			return (Affine3<T>(Mat3<T>::identity(), movement));
+		}
+
+		/**
+		 * @brief Create scale transform.
+		 *
+		 * @param factors Vec3 of scale factors on each axis.
+		 *
+		 * @return Scale transform of parameter.
+		 */
+		static constexpr Affine3<T>	scale(const Vec3<T> &factors)
+		{
+			return (Affine3<T>(Mat3<T>(factors.x, T(), T(),
+										T(), factors.y, T(),
+										T(), T(), factors.z), Vec3<T>()));
+		}
+	};
+
+	//**** EXTERNS OPERATORS ***************************************************
+	//---- Affine affine operator ----------------------------------------------
+
+	/**
+	 * @brief Compose two transforms, a2 is applied first.
+	 *
+	 * @param a1 First transform.
+	 * @param a2 Second transform.
+	 *
+	 * @return Result of a1 * a2.
+	 */
+	template <typename T>
+	constexpr Affine3<T>	operator*(const Affine3<T> &a1, const Affine3<T> &a2)
+	{
+		return (Affine3<T>(a1.linear * a2.linear, a1.linear * a2.offset + a1.offset));
+	}
+
+	//---- Affine vector operator ----------------------------------------------
+
+	/**
+	 * @brief Transform a point.
+	 *
+	 * @param affine3 The transform.
+	 * @param point The point.
+	 *
+	 * @return Result of affine3 * (point, 1).
+	 */
+	template <typename T>
+	constexpr Vec3<T>	operator*(const Affine3<T> &affine3, const Vec3<T> &point)
+	{
+		return (affine3.linear * point + affine3.offset);
+	}
+
+	//---- Print operator ------------------------------------------------------
+
+	template <typename T>
+	std::ostream	&operator<<(std::ostream &os, const Affine3<T> &affine3)
+	{
+		os << "|" << affine3.linear << ";" << affine3.offset << "|";
+		return (os);
+	}
+
+	//**** FUNCTIONS ***********************************************************
+
+	/**
+	 * @brief Print an Affine3 in a beatiful format with cout.
+	 *
+	 * @param affine3 The Affine3 to print.
+	 */
+	template <typename T>
+	void	print(const Affine3<T> &affine3)
+	{
+		const T	*l = affine3.linear.values;
+
+		std::cout	<< "|" << l[0] << ", " << l[1] << ", " << l[2] << ", " << affine3.offset.x << "|\n"
+					<< "|" << l[3] << ", " << l[4] << ", " << l[5] << ", " << affine3.offset.y << "|\n"
+					<< "|" << l[6] << ", " << l[7] << ", " << l[8] << ", " << affine3.offset.z << "|" << std::endl;
+	}
+
+	/**
+	 * @brief Transform a point (translation applied).
+	 *
+	 * @param affine3 The transform.
+	 * @param point The point.
+	 *
+	 * @return Result of affine3 * (point, 1).
+	 */
+	template <typename T>
+	Vec3<T>	transformPoint(const Affine3<T> &affine3, const Vec3<T> &point)
+	{
+		return (affine3.linear * point + affine3.offset);
+	}
+
+	/**
+	 * @brief Transform a direction (translation ignored).
+	 *
+	 * @param affine3 The transform.
+	 * @param vector The direction.
+	 *
+	 * @return Result of affine3 * (vector, 0).
+	 */
+	template <typename T>
+	Vec3<T>	transformVector(const Affine3<T> &affine3, const Vec3<T> &vector)
+	{
+		return (affine3.linear * vector);
+	}
+
+	/**
+	 * @brief Inverse an Affine3. Never throw.
+	 *
+	 * @param affine3 The transform to inverse.
+	 * @param out The inverse transform, untouched if affine3 is singular. Can
+	 * be affine3.
+	 * @param det If not nullptr, receive the determinant of affine3.
+	 * @param epsilon Transform is singular when |determinant| <= epsilon.
+	 *
+	 * @return True if the transform was inversed, false if it's singular.
+	 */
+	template <typename T>
+	bool	tryInverse(const Affine3<T> &affine3, Affine3<T> &out, T *det = nullptr,
+				T epsilon = __inverseEpsilon<T>()) noexcept
+	{
+		Mat3<T>	inv;
+
+		if (!tryInverse(affine3.linear, inv, det, epsilon))
+			return (false);
+
+		out.offset = -(inv * affine3.offset);
+		out.linear = inv;
+		return (true);
+	}
+
+	/**
+	 * @brief Inverse an Affine3.
+	 *
+	 * @param affine3 The transform to inverse.
+	 *
+	 * @exception Throw an runtime_error if the transform cannot be inverse.
+	 * @return The inverse transform.
+	 */
+	template <typename T>
+	Affine3<T>	inverse(const Affine3<T> &affine3)
+	{
+		Affine3<T>	res;
+
+		if (!tryInverse(affine3, res))
+			GM_THROW(std::runtime_error("Matrix cannot be inverse"));
+		return (res);
+	}
+
+	/**
+	 * @brief Inverse a rigid Affine3 (rotation and translation only).
+	 *
+	 * @param affine3 The rigid transform to inverse.
+	 *
+	 * @return The inverse transform, wrong if affine3 has a scale or a shear.
+	 */
+	template <typename T>
+	Affine3<T>	inverseRigid(const Affine3<T> &affine3)
+	{
+		const Mat3<T>	inv = transpose(affine3.linear);
+
+		return (Affine3<T>(inv, -(inv * affine3.offset)));
+	}
+
+	/**
+	 * @brief Get the hash of an Affine3.
+	 *
+	 * @param affine3 Affine3 to hash.
+	 *
+	 * @return Hash of Affine3.
+	 */
+	template <typename T>
+	std::size_t	hash(const Affine3<T> &affine3)
+	{
+		std::size_t	res = hash(affine3.linear);
+
+		return (hash(affine3.offset) + 0x9e3779b9 + (res<<6) + (res>>2));
+	}
+
+	//**** STATIC FUNCTIONS ****************************************************
+	//**** USINGS **************************************************************
+
+	/**
+	 * @brief Class for 3d float affine transform.
+	 */
+	using Affine3f = Affine3<float>;
+	/**
+	 * @brief Class for 3d double affine transform.
+	 */
+	using Affine3d = Affine3<double>;
+
+	//**** CHECKS **************************************************************
+
+	static_assert(std::is_trivially_copyable<Affine3f>::value && std::is_trivially_destructible<Affine3f>::value,
+					"Affine3f must be trivially copyable");
+	static_assert(std::is_trivially_copyable<Affine3d>::value && std::is_trivially_destructible<Affine3d>::value,
+					"Affine3d must be trivially copyable");
+	static_assert(Affine3<int>::translation(Vec3i(1, 2, 3)) * Vec3i(3, 4, 5) == Vec3i(4, 6, 8),
+					"Affine3 must be constexpr");
+}
+
+#endif
@@ -0,0 +1,348 @@
+#ifndef GM_FRUSTUM_HPP
+# define GM_FRUSTUM_HPP
+
+# include <gmath/Vec3.hpp>
+# include <gmath/Vec4.hpp>
+# include <gmath/Mat4.hpp>
+# include <gmath/SoABuffer.hpp>
+# include <gmath/dispatch.hpp>
+# include <gmath/precision.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <type_traits>
+
+namespace gm {
+	//**** STATIC FUNCTIONS DEFINE *********************************************
+	//**** CLASS DEFINE ********************************************************
+
+	/**
+	 * @brief Class for the view volume of a camera, as 6 planes.
+	 *
+	 * @tparam T Type of value in the planes.
+	 *
+	 * Planes are (a, b, c, d) in the order left, right, bottom, top, near,
+	 * far. A point p is on the inner side of a plane when
+	 * a * p.x + b * p.y + c * p.z + d >= 0, normals (a, b, c) are normalized
+	 * so it's the distance to the plane.
+	 */
+	template <typename T>
+	class Frustum
+	{
+	public:
+		Vec4<T>	planes[6];
+
+		//**** INITIALISION ****************************************************
+		//---- Constructors ----------------------------------------------------
+
+		/**
+		 * @brief Default constructor of Frustum class.
+		 *
+		 * @return The Frustum with planes at 0, nothing is culled.
+		 */
+		constexpr Frustum(void) : planes() {}
+
+		/**
+		 * @brief Constructor of Frustum class from a view projection matrix.
+		 *
+		 * Planes are the rows of the matrix added or subtracted to the last
+		 * one (Gribb and Hartmann), so they are in the space of the points
+		 * given to the view projection: world space for projection * view.
+		 *
+		 * @param viewProjection The matrix, of any layout. Its projection
+		 * must remap z in [0, 1] like Mat4::perspective. Also works with
+		 * orthographic projections.
+		 *
+		 * @return The Frustum of the camera.
+		 */
+		template <class L>
+		explicit Frustum(const Mat4<T, L> &viewProjection)
+		{
+			Vec4<T>	rows[4];
+
+			for (unsigned int y = 0; y < 4; y++)
+				rows[y] = Vec4<T>(viewProjection.at(0, y), viewProjection.at(1, y),
+									viewProjection.at(2, y), viewProjection.at(3, y));
+
+			this->planes[0] = rows[3] + rows[0];
+			this->planes[1] = rows[3] - rows[0];
+			this->planes[2] = rows[3] + rows[1];
+			this->planes[3] = rows[3] - rows[1];
+			// Clip z in [0, w], so near is z >= 0 alone
+			this->planes[4] = rows[2];
+			this->planes[5] = rows[3] - rows[2];
+
+			for (unsigned int i = 0; i < 6; i++)
+			{
+				Vec4<T>	&plane = this->planes[i];
+				const T	norm = __sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+
+				if (norm != T())
+					plane = plane / norm;
+			}
+		}
+
+		//**** OPERATORS *******************************************************
+		//---- Compare Operators -----------------------------------------------
+
+		bool	operator==(const Frustum &frustum) const
+		{
+			for (unsigned int i = 0; i < 6; i++)
+				if (this->planes[i] != frustum.planes[i])
+					return (false);
+			return (true);
+		}
+
+		bool	operator!=(const Frustum &frustum) const
+		{
+			return (!(*this == frustum));
+		}
+
+		//**** PUBLIC METHODS **************************************************
+
+		/**
+		 * @brief Signed distance of a point to a plane.
+		 *
+		 * @param i Index of the plane, in [0, 5].
+		 * @param point The point.
+		 *
+		 * @return The distance, negative on the outer side of the plane.
+		 */
+		T	distance(unsigned int i, const Vec3<T> &point) const noexcept
+		{
+			GM_ASSERT_BOUNDS(i < 6, "Index out of frustum planes");
+
+			const Vec4<T>	&plane = this->planes[i];
+
+			// Same order of operations as the batch kernels
+			return (plane.x * point.x + (plane.y * point.y + (plane.z * point.z + plane.w)));
+		}
+
+		/**
+		 * @brief Test if a point is inside the frustum.
+		 *
+		 * @param point The point.
+		 *
+		 * @return True if the point is inside or on a plane.
+		 */
+		bool	contains(const Vec3<T> &point) const noexcept
+		{
+			for (unsigned int i = 0; i < 6; i++)
+				if (this->distance(i, point) < T())
+					return (false);
+			return (true);
+		}
+
+		/**
+		 * @brief Test if a sphere may be visible.
+		 *
+		 * Conservative: a sphere near a corner of the frustum can be kept
+		 * while it's outside.
+		 *
+		 * @param center Center of the sphere.
+		 * @param radius Radius of the sphere.
+		 *
+		 * @return False if the sphere is fully outside one plane.
+		 */
+		bool	intersectsSphere(const Vec3<T> &center, T radius) const noexcept
+		{
+			for (unsigned int i = 0; i < 6; i++)
+				if (this->distance(i, center) + radius < T())
+					return (false);
+			return (true);
+		}
+
+		/**
+		 * @brief Test if an axis aligned box may be visible.
+		 *
+		 * Conservative like intersectsSphere, each plane is tested with the
+		 * corner of the box the farthest along its normal.
+		 *
+		 * @param min Corner of the box with the smallest values.
+		 * @param max Corner of the box with the biggest values.
+		 *
+		 * @return False if the box is fully outside one plane.
+		 */
+		bool	intersectsAABB(const Vec3<T> &min, const Vec3<T> &max) const noexcept
+		{
+			for (unsigned int i = 0; i < 6; i++)
+			{
+				const Vec4<T>	&plane = this->planes[i];
+				const Vec3<T>	corner(plane.x > T() ? max.x : min.x, plane.y > T() ? max.y : min.y,
+										plane.z > T() ? max.z : min.z);
+
+				if (this->distance(i, corner) < T())
+					return (false);
+			}
+			return (true);
+		}
+	};
+
+	//**** EXTERNS OPERATORS ***************************************************
+	//---- Print operator ------------------------------------------------------
+
+	template <typename T>
+	std::ostream	&operator<<(std::ostream &os, const Frustum<T> &frustum)
+	{
+		os << "|" << frustum.planes[0];
+		for (unsigned int i = 1; i < 6; i++)
+			os << ";" << frustum.planes[i];
+		os << "|";
+		return (os);
+	}
+
+	//**** FUNCTIONS ***********************************************************
+	//---- Visibility mask -----------------------------------------------------
+
+	/**
+	 * @brief Size of the visibility mask of the batch culling functions.
+	 *
+	 * @param count Number of objects.
+	 *
+	 * @return Number of 32 bits words, one bit per object.
+	 */
+	constexpr std::size_t	cullMaskSize(std::size_t count)
+	{
+		return ((count + 31) / 32);
+	}
+
+	/**
+	 * @brief Read the visibility of an object in a mask of the batch culling
+	 * functions.
+	 *
+	 * @param mask The mask.
+	 * @param i Index of the object.
+	 *
+	 * @return True if the object is visible.
+	 */
+	inline bool	isVisible(const std::uint32_t *mask, std::size_t i)
+	{
+		return (((mask[i / 32] >> (i % 32)) & 1u) != 0);
+	}
+
+	//---- Batch ---------------------------------------------------------------
+
+	/**
+	 * @brief Cull spheres stored as one array per component, with simd
+	 * kernels for float.
+	 *
+	 * Same results as Frustum::intersectsSphere, up to the rounding of fma
+	 * for spheres touching a plane.
+	 *
+	 * @param frustum The frustum.
+	 * @param center x, y and z arrays of the centers.
+	 * @param radius Radius of the spheres.
+	 * @param mask Visibility bits, cullMaskSize(count) words written.
+	 * @param count Number of spheres.
+	 */
+	template <typename T>
+	void	cullSpheres(const Frustum<T> &frustum, const T *const center[3], const T *radius,
+				std::uint32_t *mask, std::size_t count)
+	{
+		for (std::size_t i = 0; i < cullMaskSize(count); i++)
+			mask[i] = 0;
+		for (std::size_t i = 0; i < count; i++)
+			if (frustum.intersectsSphere(Vec3<T>(center[0][i], center[1][i], center[2][i]), radius[i]))
+				mask[i / 32] |= 1u << (i % 32);
+	}
+
+	inline void	cullSpheres(const Frustum<float> &frustum, const float *const center[3], const float *radius,
+					std::uint32_t *mask, std::size_t count)
+	{
+		kernels().cullSpheres(reinterpret_cast<const float *>(frustum.planes), center, radius, mask, count);
+	}
+
+	/**
+	 * @brief Cull axis aligned boxes stored as one array per component, with
+	 * simd kernels for float.
+	 *
+	 * Same results as Frustum::intersectsAABB, up to the rounding of fma for
+	 * boxes touching a plane.
+	 *
+	 * @param frustum The frustum.
+	 * @param min x, y and z arrays of the smallest corners.
+	 * @param max x, y and z arrays of the biggest corners.
+	 * @param mask Visibility bits, cullMaskSize(count) words written.
+	 * @param count Number of boxes.
+	 */
+	template <typename T>
+	void	cullAABBs(const Frustum<T> &frustum, const T *const min[3], const T *const max[3],
+				std::uint32_t *mask, std::size_t count)
+	{
+		for (std::size_t i = 0; i < cullMaskSize(count); i++)
+			mask[i] = 0;
+		for (std::size_t i = 0; i < count; i++)
+			if (frustum.intersectsAABB(Vec3<T>(min[0][i], min[1][i], min[2][i]),
+										Vec3<T>(max[0][i], max[1][i], max[2][i])))
+				mask[i / 32] |= 1u << (i % 32);
+	}
+
+	inline void	cullAABBs(const Frustum<float> &frustum, const float *const min[3], const float *const max[3],
+					std::uint32_t *mask, std::size_t count)
+	{
+		kernels().cullAABBs(reinterpret_cast<const float *>(frustum.planes), min, max, mask, count);
+	}
+
+	/**
+	 * @brief Cull spheres of a SoA, with simd kernels for float.
+	 *
+	 * @param frustum The frustum.
+	 * @param centers Centers of the spheres.
+	 * @param radius Array of centers size radius.
+	 * @param mask Visibility bits, cullMaskSize(centers.size()) words written.
+	 */
+	template <typename T>
+	void	cullSpheres(const Frustum<T> &frustum, const SoABuffer<T, 3> &centers, const T *radius,
+				std::uint32_t *mask)
+	{
+		const T	*center[3];
+
+		__soaComponents(centers, center);
+		cullSpheres(frustum, center, radius, mask, centers.size());
+	}
+
+	/**
+	 * @brief Cull axis aligned boxes of two SoA, with simd kernels for float.
+	 *
+	 * @param frustum The frustum.
+	 * @param min Smallest corners of the boxes.
+	 * @param max Biggest corners of the boxes.
+	 * @param mask Visibility bits, cullMaskSize(min.size()) words written.
+	 *
+	 * @exception Throw an exception if min and max have different sizes.
+	 */
+	template <typename T>
+	void	cullAABBs(const Frustum<T> &frustum, const SoABuffer<T, 3> &min, const SoABuffer<T, 3> &max,
+				std::uint32_t *mask)
+	{
+		__soaCheckSize(min, max);
+
+		const T	*cmin[3];
+		const T	*cmax[3];
+
+		__soaComponents(min, cmin);
+		__soaComponents(max, cmax);
+		cullAABBs(frustum, cmin, cmax, mask, min.size());
+	}
+
+	//**** STATIC FUNCTIONS ****************************************************
+	//**** USINGS **************************************************************
+
+	/**
+	 * @brief Class for float frustum.
+	 */
+	using Frustumf = Frustum<float>;
+	/**
+	 * @brief Class for double frustum.
+	 */
+	using Frustumd = Frustum<double>;
+
+	//**** CHECKS **************************************************************
+
+	static_assert(sizeof(Frustumf) == 24 * sizeof(float), "Frustumf planes must be packed for the batch kernels");
+	static_assert(std::is_trivially_copyable<Frustumf>::value, "Frustumf must be trivially copyable");
+}
+
+#endif
@@ -4,10 +4,12 @@
 # define GM_MAT2_SIZE 4
 
 # include <gmath/Vec2.hpp>
+# include <gmath/layout.hpp>
 
 #include <cmath>
 #include <iostream>
 #include <stdexcept>
+#include <type_traits>
 
 namespace gm {
 	//**** STATIC FUNCTIONS DEFINE *********************************************
@@ -17,10 +19,11 @@ namespace gm {
 	 * @brief Class for 2x2 matrix.
 	 *
 	 * @tparam T Type of value in the matrix.
+	 * @tparam L Storage order of values, RowMajor or ColumnMajor.
 	 *
 	 * The class is design to be used with graphic librairy like OpenGL or Vulkan.
 	 */
-	template <typename T>
+	template <typename T, class L = RowMajor>
 	class Mat2
 	{
 	public:
@@ -34,11 +37,7 @@ namespace gm {
 		 *
 		 * @return The Mat2 with values at 0.
 		 */
-		Mat2(void)
-		{
-			for (int i = 0; i < GM_MAT2_SIZE; i++)
-				this->values[i] = T();
-		}
+		constexpr Mat2(void) : values() {}
 
 		/**
 		 * @brief Copy constructor of Mat2 class.
@@ -47,20 +46,16 @@ namespace gm {
 		 *
 		 * @return The Mat2 copied from parameter.
 		 */
-		Mat2(const Mat2 &mat2)
-		{
-			for (int i = 0; i < GM_MAT2_SIZE; i++)
-				this->values[i] = mat2.values[i];
-		}
+		Mat2(const Mat2 &mat2) = default;
 
 		/**
 		 * @brief Constructor of Mat2 class from an array.
 		 *
-		 * @param values Values in array form.
+		 * @param values Values in array form, in the storage order of L.
 		 *
 		 * @return Mat2 values of the array.
 		 */
-		Mat2(const T values[GM_MAT2_SIZE])
+		constexpr Mat2(const T values[GM_MAT2_SIZE]) : values()
 		{
 			for (int i = 0; i < GM_MAT2_SIZE; i++)
 				this->values[i] = values[i];
@@ -76,12 +71,28 @@ namespace gm {
 		 *
 		 * @return Mat2 values of parameters.
 		 */
-		Mat2(T x1, T x2, T y1, T y2)
+		constexpr Mat2(T x1, T x2, T y1, T y2) : values()
+		{
+			this->at(0, 0) = x1;
+			this->at(1, 0) = x2;
+			this->at(0, 1) = y1;
+			this->at(1, 1) = y2;
+		}
+
+		/**
+		 * @brief Constructor of Mat2 class from a Mat2 of the other storage
+		 * order.
+		 *
+		 * @param mat2 The Mat2 to convert.
+		 *
+		 * @return Mat2 with the same elements as mat2.
+		 */
+		template <class O>
+		constexpr explicit Mat2(const Mat2<T, O> &mat2) : values()
 		{
-			this->values[0] = x1;
-			this->values[1] = x2;
-			this->values[2] = y1;
-			this->values[3] = y2;
+			for (unsigned int y = 0; y < 2; y++)
+				for (unsigned int x = 0; x < 2; x++)
+					this->at(x, y) = mat2.at(x, y);
 		}
 
 		/**
@@ -91,7 +102,7 @@ namespace gm {
 		 *
 		 * @return Mat2 identity * scale.
 		 */
-		Mat2(T scale)
+		constexpr Mat2(T scale) : values()
 		{
 			this->values[0] = scale;
 			this->values[1] = T();
@@ -101,9 +112,7 @@ namespace gm {
 
 		//---- Destructor ------------------------------------------------------
 
-		~Mat2()
-		{
-		}
+		~Mat2() = default;
 
 		//**** ACCESSORS *******************************************************
 		//---- Getters ---------------------------------------------------------
@@ -115,13 +124,12 @@ namespace gm {
 		 * @param y y index, must in range [0, 1].
 		 *
 		 * @return The value at position (x,y).
-		 * @exception Throw a runtime_error when x and y isn't in range [0, 1].
+		 * @warning Checked only if GM_BOUNDS_CHECK is 1, abort when x and y isn't in range [0, 1].
 		 */
-		T	get(unsigned int x, unsigned int y) const
+		constexpr T	get(unsigned int x, unsigned int y) const noexcept
 		{
-			if (x >= 2 || y >= 2)
-				throw std::runtime_error("Index out of mat2 bounds");
-			return (this->values[x + y * 2]);
+			GM_ASSERT_BOUNDS(x < 2 && y < 2, "Index out of mat2 bounds");
+			return (this->values[L::index(x, y, 2)]);
 		}
 
 		/**
@@ -134,9 +142,9 @@ namespace gm {
 		 *
 		 * @return The reference of value at position (x,y).
 		 */
-		T	&at(unsigned int x, unsigned int y)
+		constexpr T	&at(unsigned int x, unsigned int y)
 		{
-			return (this->values[x + y * 2]);
+			return (this->values[L::index(x, y, 2)]);
 		}
 
 		/**
@@ -149,9 +157,9 @@ namespace gm {
 		 *
 		 * @return The const reference of value at position (x,y).
 		 */
-		const T	&at(unsigned int x, unsigned int y) const
+		constexpr const T	&at(unsigned int x, unsigned int y) const
 		{
-			return (this->values[x + y * 2]);
+			return (this->values[L::index(x, y, 2)]);
 		}
 
 		/**
@@ -163,11 +171,10 @@ namespace gm {
 		 *
 		 * @return The row at row pos y as a Vec2.
 		 */
-		Vec2<T>	row(unsigned int y) const
+		constexpr Vec2<T>	row(unsigned int y) const
 		{
-			unsigned int	id = y * 2;
-			return (Vec2<T>(this->values[id],
-							this->values[id + 1]));
+			return (Vec2<T>(this->at(0, y),
+							this->at(1, y)));
 		}
 
 		//---- Setters ---------------------------------------------------------
@@ -179,29 +186,19 @@ namespace gm {
 		 * @param y y index, must in range [0, 1].
 		 * @param value The value to set.
 		 *
-		 * @exception Throw a runtime_error when x and y isn't in range [0, 1].
+		 * @warning Checked only if GM_BOUNDS_CHECK is 1, abort when x and y isn't in range [0, 1].
 		 */
-		void	set(unsigned int x, unsigned int y, const T &value)
+		constexpr void	set(unsigned int x, unsigned int y, const T &value) noexcept
 		{
-			if (x >= 2 || y >= 2)
-				throw std::runtime_error("Index out of mat2 bounds");
-			this->values[x + y * 2] = value;
+			GM_ASSERT_BOUNDS(x < 2 && y < 2, "Index out of mat2 bounds");
+			this->values[L::index(x, y, 2)] = value;
 		}
 
 		//---- Modify Operators ------------------------------------------------
 
-		Mat2	&operator=(const Mat2 &mat2)
-		{
-			if (this == &mat2)
-				return (*this);
-
-			for (int i = 0; i < GM_MAT2_SIZE; i++)
-				this->values[i] = mat2.values[i];
-
-			return (*this);
-		}
+		Mat2	&operator=(const Mat2 &mat2) = default;
 
-		Mat2	&operator+=(const Mat2 &mat2)
+		constexpr Mat2	&operator+=(const Mat2 &mat2)
 		{
 			for (int i = 0; i < GM_MAT2_SIZE; i++)
 				this->values[i] += mat2.values[i];
@@ -209,7 +206,7 @@ namespace gm {
 			return (*this);
 		}
 
-		Mat2	&operator-=(const Mat2 &mat2)
+		constexpr Mat2	&operator-=(const Mat2 &mat2)
 		{
 			for (int i = 0; i < GM_MAT2_SIZE; i++)
 				this->values[i] -= mat2.values[i];
@@ -217,7 +214,7 @@ namespace gm {
 			return (*this);
 		}
 
-		Mat2	&operator*=(const T &value)
+		constexpr Mat2	&operator*=(const T &value)
 		{
 			for (int i = 0; i < GM_MAT2_SIZE; i++)
 				this->values[i] *= value;
@@ -225,7 +222,7 @@ namespace gm {
 			return (*this);
 		}
 
-		Mat2	&operator/=(const T &value)
+		constexpr Mat2	&operator/=(const T &value)
 		{
 			for (int i = 0; i < GM_MAT2_SIZE; i++)
 				this->values[i] /= value;
@@ -235,7 +232,7 @@ namespace gm {
 
 		//---- Compare Operators -----------------------------------------------
 
-		bool	operator==(const Mat2 &mat2) const
+		constexpr bool	operator==(const Mat2 &mat2) const
 		{
 			for (int i = 0; i < GM_MAT2_SIZE; i++)
 				if (this->values[i] != mat2.values[i])
@@ -244,7 +241,7 @@ namespace gm {
 			return (true);
 		}
 
-		bool	operator!=(const Mat2 &mat2) const
+		constexpr bool	operator!=(const Mat2 &mat2) const
 		{
 			for (int i = 0; i < GM_MAT2_SIZE; i++)
 				if (this->values[i] != mat2.values[i])
@@ -258,15 +255,14 @@ namespace gm {
 		/**
 		 * @brief Access values by index.
 		 *
-		 * @param n The id of value in array style. Id is (x + y * 2).
+		 * @param n The id of value in array style. Id is L::index(x, y, 2).
 		 *
 		 * @return The reference of value at array position n.
-		 * @exception Throw a runtime_error if n isn't in range [0, 3].
+		 * @warning Checked only if GM_BOUNDS_CHECK is 1, abort when n isn't in range [0, 3].
 		 */
-		T	&operator[](unsigned int n)
+		constexpr T	&operator[](unsigned int n) noexcept
 		{
-			if (n >= GM_MAT2_SIZE)
-				throw std::runtime_error("Index out of mat2 bounds");
+			GM_ASSERT_BOUNDS(n < GM_MAT2_SIZE, "Index out of mat2 bounds");
 
 			return (this->values[n]);
 		}
@@ -274,15 +270,14 @@ namespace gm {
 		/**
 		 * @brief Const access values by index.
 		 *
-		 * @param n The id of value in array style. Id is (x + y * 2).
+		 * @param n The id of value in array style. Id is L::index(x, y, 2).
 		 *
 		 * @return The const reference of value at array position n.
-		 * @exception Throw a runtime_error if n isn't in range [0, 3].
+		 * @warning Checked only if GM_BOUNDS_CHECK is 1, abort when n isn't in range [0, 3].
 		 */
-		const T	&operator[](unsigned int n) const
+		constexpr const T	&operator[](unsigned int n) const noexcept
 		{
-			if (n >= GM_MAT2_SIZE)
-				throw std::runtime_error("Index out of mat2 bounds");
+			GM_ASSERT_BOUNDS(n < GM_MAT2_SIZE, "Index out of mat2 bounds");
 
 			return (this->values[n]);
 		}
@@ -296,9 +291,9 @@ namespace gm {
 		 *
 		 * @return The reference of value at position (x,y).
 		 */
-		T	&operator[](const Vec2u &vec2)
+		constexpr T	&operator[](const Vec2u &vec2)
 		{
-			return (this->values[vec2.x + vec2.y * 2]);
+			return (this->values[L::index(vec2.x, vec2.y, 2)]);
 		}
 
 		/**
@@ -310,9 +305,9 @@ namespace gm {
 		 *
 		 * @return The const reference of value at position (x,y).
 		 */
-		const T	&operator[](const Vec2u &vec2) const
+		constexpr const T	&operator[](const Vec2u &vec2) const
 		{
-			return (this->values[vec2.x + vec2.y * 2]);
+			return (this->values[L::index(vec2.x, vec2.y, 2)]);
 		}
 
 		//**** PUBLIC METHODS **************************************************
@@ -321,7 +316,7 @@ namespace gm {
 		 *
 		 * @return The determinant of the matrix.
 		 */
-		T	determinant(void) const
+		constexpr T	determinant(void) const
 		{
 			return ((this->values[0] * this->values[3])
 					- (this->values[1] * this->values[2]));
@@ -334,9 +329,9 @@ namespace gm {
 		 *
 		 * @return 2x2 identity matrix.
 		 */
-		static Mat2<T>	identity(void)
+		static constexpr Mat2<T, L>	identity(void)
 		{
-			Mat2<T>	res;
+			Mat2<T, L>	res;
 
 			res.values[0] = static_cast<T>(1);
 			res.values[3] = static_cast<T>(1);
@@ -351,16 +346,18 @@ namespace gm {
 		 *
 		 * @return 2x2 rotation matrix of parameter.
 		 */
-		static Mat2<T>	rotation(T radians)
+		static Mat2<T, L>	rotation(T radians)
 		{
-			Mat2<T>	res;
-			T		tmpCos = static_cast<T>(cos(static_cast<double>(radians)));
-			T		tmpSin = static_cast<T>(sin(static_cast<double>(radians)));
+			Mat2<T, L>	res;
+			T		tmpCos;
+			T		tmpSin;
 
-			res.values[0] = tmpCos;
-			res.values[1] = -tmpSin;
-			res.values[2] = tmpSin;
-			res.values[3] = tmpCos;
+			__sincos(radians, tmpSin, tmpCos);
+
+			res.at(0, 0) = tmpCos;
+			res.at(1, 0) = -tmpSin;
+			res.at(0, 1) = tmpSin;
+			res.at(1, 1) = tmpCos;
 
 			return (res);
 		}
@@ -372,10 +369,10 @@ namespace gm {
 	//**** EXTERNS OPERATORS ***************************************************
 	//---- Matrix matrix operator ----------------------------------------------
 
-	template <typename T>
-	Mat2<T>	operator+(const Mat2<T> &m1, const Mat2<T> &m2)
+	template <typename T, class L>
+	constexpr Mat2<T, L>	operator+(const Mat2<T, L> &m1, const Mat2<T, L> &m2)
 	{
-		Mat2<T>	res;
+		Mat2<T, L>	res;
 
 		for (int i = 0; i < GM_MAT2_SIZE; i++)
 			res.values[i] = m1.values[i] + m2.values[i];
@@ -383,10 +380,10 @@ namespace gm {
 		return (res);
 	}
 
-	template <typename T>
-	Mat2<T>	operator-(const Mat2<T> &m1, const Mat2<T> &m2)
+	template <typename T, class L>
+	constexpr Mat2<T, L>	operator-(const Mat2<T, L> &m1, const Mat2<T, L> &m2)
 	{
-		Mat2<T>	res;
+		Mat2<T, L>	res;
 
 		for (int i = 0; i < GM_MAT2_SIZE; i++)
 			res.values[i] = m1.values[i] - m2.values[i];
@@ -402,25 +399,24 @@ namespace gm {
 	 *
 	 * @return Result of m1 * m2.
 	 */
-	template <typename T>
-	Mat2<T>	operator*(const Mat2<T> &m1, const Mat2<T> &m2)
+	template <typename T, class L>
+	constexpr Mat2<T, L>	operator*(const Mat2<T, L> &m1, const Mat2<T, L> &m2)
 	{
-		Mat2<T>	res;
+		Mat2<T, L>	res;
 
-		res.values[0] = m1.values[0] * m2.values[0] + m1.values[1] * m2.values[2];
-		res.values[1] = m1.values[0] * m2.values[1] + m1.values[1] * m2.values[3];
-		res.values[2] = m1.values[2] * m2.values[0] + m1.values[3] * m2.values[2];
-		res.values[3] = m1.values[2] * m2.values[1] + m1.values[3] * m2.values[3];
+		for (unsigned int y = 0; y < 2; y++)
+			for (unsigned int x = 0; x < 2; x++)
+				res.at(x, y) = __dot(m1.at(0, y), m2.at(x, 0), m1.at(1, y), m2.at(x, 1));
 
 		return (res);
 	}
 
 	//---- Matrix value operator -----------------------------------------------
 
-	template <typename T>
-	Mat2<T>	operator*(const Mat2<T> &mat2, const T &value)
+	template <typename T, class L>
+	constexpr Mat2<T, L>	operator*(const Mat2<T, L> &mat2, const T &value)
 	{
-		Mat2<T>	res;
+		Mat2<T, L>	res;
 
 		for (int i = 0; i < GM_MAT2_SIZE; i++)
 			res.values[i] = mat2.values[i] * value;
@@ -428,10 +424,10 @@ namespace gm {
 		return (res);
 	}
 
-	template <typename T>
-	Mat2<T>	operator*(const T &value, const Mat2<T> &mat2)
+	template <typename T, class L>
+	constexpr Mat2<T, L>	operator*(const T &value, const Mat2<T, L> &mat2)
 	{
-		Mat2<T>	res;
+		Mat2<T, L>	res;
 
 		for (int i = 0; i < GM_MAT2_SIZE; i++)
 			res.values[i] = mat2.values[i] * value;
@@ -439,10 +435,10 @@ namespace gm {
 		return (res);
 	}
 
-	template <typename T>
-	Mat2<T>	operator/(const Mat2<T> &mat2, const T &value)
+	template <typename T, class L>
+	constexpr Mat2<T, L>	operator/(const Mat2<T, L> &mat2, const T &value)
 	{
-		Mat2<T>	res;
+		Mat2<T, L>	res;
 
 		for (int i = 0; i < GM_MAT2_SIZE; i++)
 			res.values[i] = mat2.values[i] / value;
@@ -452,10 +448,10 @@ namespace gm {
 
 	//---- Print operator ------------------------------------------------------
 
-	template <typename T>
-	std::ostream	&operator<<(std::ostream &os, const Mat2<T> &mat2)
+	template <typename T, class L>
+	std::ostream	&operator<<(std::ostream &os, const Mat2<T, L> &mat2)
 	{
-		os << "|(" << mat2.values[0] << "," << mat2.values[1] << ");(" << mat2.values[2] << "," << mat2.values[3] << ")|";
+		os << "|(" << mat2.at(0, 0) << "," << mat2.at(1, 0) << ");(" << mat2.at(0, 1) << "," << mat2.at(1, 1) << ")|";
 		return (os);
 	}
 
@@ -466,13 +462,13 @@ namespace gm {
 	 *
 	 * @param mat2 The Mat2 to print.
 	 */
-	template <typename T>
-	void	print(const Mat2<T> &mat2)
+	template <typename T, class L>
+	void	print(const Mat2<T, L> &mat2)
 	{
-		Mat2<T>	res;
+		Mat2<T, L>	res;
 
-		std::cout	<< "|" << mat2.values[0] << ", " << mat2.values[1] << "|\n"
-					<< "|" << mat2.values[2] << ", " << mat2.values[3] << "|" << std::endl;
+		std::cout	<< "|" << mat2.at(0, 0) << ", " << mat2.at(1, 0) << "|\n"
+					<< "|" << mat2.at(0, 1) << ", " << mat2.at(1, 1) << "|" << std::endl;
 	}
 
 	/**
@@ -482,10 +478,10 @@ namespace gm {
 	 *
 	 * @return Mat2 transposed.
 	 */
-	template <typename T>
-	Mat2<T>	transpose(const Mat2<T> &mat2)
+	template <typename T, class L>
+	Mat2<T, L>	transpose(const Mat2<T, L> &mat2)
 	{
-		Mat2<T>	res;
+		Mat2<T, L>	res;
 
 		res.values[0] = mat2.values[0];
 		res.values[1] = mat2.values[2];
@@ -503,10 +499,10 @@ namespace gm {
 	 *
 	 * @return Mat2 rotate by angle in radians.
 	 */
-	template <typename T>
-	Mat2<T>	rotate(const Mat2<T> &mat2, T radians)
+	template <typename T, class L>
+	Mat2<T, L>	rotate(const Mat2<T, L> &mat2, T radians)
 	{
-		const Mat2<T>	matRot = Mat2<T>::rotation(radians);
+		const Mat2<T, L>	matRot = Mat2<T, L>::rotation(radians);
 
 		return (mat2 * matRot);
 	}
@@ -518,8 +514,8 @@ namespace gm {
 	 *
 	 * @return Hash of Mat2.
 	 */
-	template <typename T>
-	std::size_t	hash(const Mat2<T> &mat2)
+	template <typename T, class L>
+	std::size_t	hash(const Mat2<T, L> &mat2)
 	{
 		std::size_t	hash = 0;
 
@@ -556,6 +552,37 @@ namespace gm {
 	 * The class is design to be used with graphic librairy like OpenGL or Vulkan.
 	 */
 	using Mat2d = Mat2<double>;
+	/**
+	 * @brief Class for 2x2 column-major float matrix.
+	 *
+	 * values match a mat2 of a std430 block. std140 puts the columns 16
+	 * bytes apart, write it with BlockLayout.
+	 */
+	using Mat2fc = Mat2<float, ColumnMajor>;
+	/**
+	 * @brief Class for 2x2 column-major double matrix.
+	 *
+	 * values match a mat2 of a std430 block. std140 puts the columns 16
+	 * bytes apart, write it with BlockLayout.
+	 */
+	using Mat2dc = Mat2<double, ColumnMajor>;
+
+	//**** CHECKS **************************************************************
+
+	static_assert(std::is_trivially_copyable<Mat2u>::value && std::is_trivially_destructible<Mat2u>::value,
+					"Mat2u must be trivially copyable");
+	static_assert(std::is_trivially_copyable<Mat2i>::value && std::is_trivially_destructible<Mat2i>::value,
+					"Mat2i must be trivially copyable");
+	static_assert(std::is_trivially_copyable<Mat2f>::value && std::is_trivially_destructible<Mat2f>::value,
+					"Mat2f must be trivially copyable");
+	static_assert(std::is_trivially_copyable<Mat2d>::value && std::is_trivially_destructible<Mat2d>::value,
+					"Mat2d must be trivially copyable");
+	static_assert(std::is_trivially_copyable<Mat2fc>::value && std::is_trivially_destructible<Mat2fc>::value,
+					"Mat2fc must be trivially copyable");
+	static_assert(Mat2i::identity() * Mat2i(2) == Mat2i(2, 0, 0, 2),
+					"Mat2 must be constexpr");
+	static_assert(Mat2<int, ColumnMajor>(1, 2, 3, 4)[1] == 3 && Mat2<int, ColumnMajor>(1, 2, 3, 4).get(1, 0) == 2,
+					"Mat2 must store columns contiguously in ColumnMajor");
 }
 
 #endif
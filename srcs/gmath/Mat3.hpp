@@ -5,10 +5,12 @@
 
 # include <gmath/Vec3.hpp>
 # include <gmath/Mat2.hpp>
+# include <gmath/layout.hpp>
 
 #include <cmath>
 #include <iostream>
 #include <stdexcept>
+#include <type_traits>
 
 namespace gm {
 	//**** STATIC FUNCTIONS DEFINE *********************************************
@@ -18,10 +20,11 @@ namespace gm {
 	 * @brief Class for 3x3 matrix.
 	 *
 	 * @tparam T Type of value in the matrix.
+	 * @tparam L Storage order of values, RowMajor or ColumnMajor.
 	 *
 	 * The class is design to be used with graphic library like OpenGL or Vulkan.
 	 */
-	template <typename T>
+	template <typename T, class L = RowMajor>
 	class Mat3
 	{
 	public:
@@ -35,11 +38,7 @@ namespace gm {
 		 *
 		 * @return The Mat3 with values at 0.
 		 */
-		Mat3(void)
-		{
-			for (int i = 0; i < GM_MAT3_SIZE; i++)
-				this->values[i] = T();
-		}
+		constexpr Mat3(void) : values() {}
 
 		/**
 		 * @brief Copy constructor of Mat3 class.
@@ -48,20 +47,16 @@ namespace gm {
 		 *
 		 * @return The Mat3 copied from parameter.
 		 */
-		Mat3(const Mat3 &mat3)
-		{
-			for (int i = 0; i < GM_MAT3_SIZE; i++)
-				this->values[i] = mat3.values[i];
-		}
+		Mat3(const Mat3 &mat3) = default;
 
 		/**
 		 * @brief Constructor of Mat3 class from an array.
 		 *
-		 * @param values Values in array form.
+		 * @param values Values in array form, in the storage order of L.
 		 *
 		 * @return Mat3 values of the array.
 		 */
-		Mat3(const T values[GM_MAT3_SIZE])
+		constexpr Mat3(const T values[GM_MAT3_SIZE]) : values()
 		{
 			for (int i = 0; i < GM_MAT3_SIZE; i++)
 				this->values[i] = values[i];
@@ -82,17 +77,33 @@ namespace gm {
 		 *
 		 * @return Mat3 values of parameters.
 		 */
-		Mat3(T x1, T x2, T x3, T y1, T y2, T y3, T z1, T z2, T z3)
+		constexpr Mat3(T x1, T x2, T x3, T y1, T y2, T y3, T z1, T z2, T z3) : values()
 		{
-			this->values[0] = x1;
-			this->values[1] = x2;
-			this->values[2] = x3;
-			this->values[3] = y1;
-			this->values[4] = y2;
-			this->values[5] = y3;
-			this->values[6] = z1;
-			this->values[7] = z2;
-			this->values[8] = z3;
+			this->at(0, 0) = x1;
+			this->at(1, 0) = x2;
+			this->at(2, 0) = x3;
+			this->at(0, 1) = y1;
+			this->at(1, 1) = y2;
+			this->at(2, 1) = y3;
+			this->at(0, 2) = z1;
+			this->at(1, 2) = z2;
+			this->at(2, 2) = z3;
+		}
+
+		/**
+		 * @brief Constructor of Mat3 class from a Mat3 of the other storage
+		 * order.
+		 *
+		 * @param mat3 The Mat3 to convert.
+		 *
+		 * @return Mat3 with the same elements as mat3.
+		 */
+		template <class O>
+		constexpr explicit Mat3(const Mat3<T, O> &mat3) : values()
+		{
+			for (unsigned int y = 0; y < 3; y++)
+				for (unsigned int x = 0; x < 3; x++)
+					this->at(x, y) = mat3.at(x, y);
 		}
 
 		/**
@@ -102,7 +113,7 @@ namespace gm {
 		 *
 		 * @return Mat3 with x1, x2, y1 and y2 from mat2, other value to 0.
 		 */
-		Mat3(const Mat2<T> &mat2)
+		constexpr Mat3(const Mat2<T, L> &mat2) : values()
 		{
 			this->values[0] = mat2.values[0];
 			this->values[1] = mat2.values[1];
@@ -122,7 +133,7 @@ namespace gm {
 		 *
 		 * @return Mat3 identity * scale.
 		 */
-		Mat3(T scale)
+		constexpr Mat3(T scale) : values()
 		{
 			this->values[0] = scale;
 			this->values[1] = T();
@@ -137,9 +148,7 @@ namespace gm {
 
 		//---- Destructor ------------------------------------------------------
 
-		~Mat3()
-		{
-		}
+		~Mat3() = default;
 
 		//**** ACCESSORS *******************************************************
 		//---- Getters ---------------------------------------------------------
@@ -151,13 +160,12 @@ namespace gm {
 		 * @param y y index, must in range [0, 2].
 		 *
 		 * @return The value at position (x,y).
-		 * @exception Throw a runtime_error when x and y isn't in range [0, 2].
+		 * @warning Checked only if GM_BOUNDS_CHECK is 1, abort when x and y isn't in range [0, 2].
 		 */
-		T	get(unsigned int x, unsigned int y) const
+		constexpr T	get(unsigned int x, unsigned int y) const noexcept
 		{
-			if (x >= 3 || y >= 3)
-				throw std::runtime_error("Index out of mat3 bounds");
-			return (this->values[x + y * 3]);
+			GM_ASSERT_BOUNDS(x < 3 && y < 3, "Index out of mat3 bounds");
+			return (this->values[L::index(x, y, 3)]);
 		}
 
 		/**
@@ -170,9 +178,9 @@ namespace gm {
 		 *
 		 * @return The reference of value at position (x,y).
 		 */
-		T	&at(unsigned int x, unsigned int y)
+		constexpr T	&at(unsigned int x, unsigned int y)
 		{
-			return (this->values[x + y * 3]);
+			return (this->values[L::index(x, y, 3)]);
 		}
 
 		/**
@@ -185,9 +193,9 @@ namespace gm {
 		 *
 		 * @return The const reference of value at position (x,y).
 		 */
-		const T	&at(unsigned int x, unsigned int y) const
+		constexpr const T	&at(unsigned int x, unsigned int y) const
 		{
-			return (this->values[x + y * 3]);
+			return (this->values[L::index(x, y, 3)]);
 		}
 
 		/**
@@ -199,12 +207,11 @@ namespace gm {
 		 *
 		 * @return The row at row pos y as a Vec3.
 		 */
-		Vec3<T>	row(unsigned int y) const
+		constexpr Vec3<T>	row(unsigned int y) const
 		{
-			unsigned int	id = y * 3;
-			return (Vec3<T>(this->values[id],
-							this->values[id + 1],
-							this->values[id + 2]));
+			return (Vec3<T>(this->at(0, y),
+							this->at(1, y),
+							this->at(2, y)));
 		}
 
 		//---- Setters ---------------------------------------------------------
@@ -216,29 +223,19 @@ namespace gm {
 		 * @param y y index, must in range [0, 2].
 		 * @param value The value to set.
 		 *
-		 * @exception Throw a runtime_error when x and y isn't in range [0, 2].
+		 * @warning Checked only if GM_BOUNDS_CHECK is 1, abort when x and y isn't in range [0, 2].
 		 */
-		void	set(unsigned int x, unsigned int y, const T &value)
+		constexpr void	set(unsigned int x, unsigned int y, const T &value) noexcept
 		{
-			if (x >= 3 || y >= 3)
-				throw std::runtime_error("Index out of mat3 bounds");
-			this->values[x + y * 3] = value;
+			GM_ASSERT_BOUNDS(x < 3 && y < 3, "Index out of mat3 bounds");
+			this->values[L::index(x, y, 3)] = value;
 		}
 
 		//---- Modify Operators ------------------------------------------------
 
-		Mat3	&operator=(const Mat3 &mat3)
-		{
-			if (this == &mat3)
-				return (*this);
-
-			for (int i = 0; i < GM_MAT3_SIZE; i++)
-				this->values[i] = mat3.values[i];
-
-			return (*this);
-		}
+		Mat3	&operator=(const Mat3 &mat3) = default;
 
-		Mat3	&operator+=(const Mat3 &mat3)
+		constexpr Mat3	&operator+=(const Mat3 &mat3)
 		{
 			for (int i = 0; i < GM_MAT3_SIZE; i++)
 				this->values[i] += mat3.values[i];
@@ -246,7 +243,7 @@ namespace gm {
 			return (*this);
 		}
 
-		Mat3	&operator-=(const Mat3 &mat3)
+		constexpr Mat3	&operator-=(const Mat3 &mat3)
 		{
 			for (int i = 0; i < GM_MAT3_SIZE; i++)
 				this->values[i] -= mat3.values[i];
@@ -254,7 +251,7 @@ namespace gm {
 			return (*this);
 		}
 
-		Mat3	&operator*=(const T &value)
+		constexpr Mat3	&operator*=(const T &value)
 		{
 			for (int i = 0; i < GM_MAT3_SIZE; i++)
 				this->values[i] *= value;
@@ -262,7 +259,7 @@ namespace gm {
 			return (*this);
 		}
 
-		Mat3	&operator/=(const T &value)
+		constexpr Mat3	&operator/=(const T &value)
 		{
 			for (int i = 0; i < GM_MAT3_SIZE; i++)
 				this->values[i] /= value;
@@ -272,7 +269,7 @@ namespace gm {
 
 		//---- Compare Operators -----------------------------------------------
 
-		bool	operator==(const Mat3 &mat3) const
+		constexpr bool	operator==(const Mat3 &mat3) const
 		{
 			for (int i = 0; i < GM_MAT3_SIZE; i++)
 				if (this->values[i] != mat3.values[i])
@@ -281,7 +278,7 @@ namespace gm {
 			return (true);
 		}
 
-		bool	operator!=(const Mat3 &mat3) const
+		constexpr bool	operator!=(const Mat3 &mat3) const
 		{
 			for (int i = 0; i < GM_MAT3_SIZE; i++)
 				if (this->values[i] != mat3.values[i])
@@ -295,15 +292,14 @@ namespace gm {
 		/**
 		 * @brief Access values by index.
 		 *
-		 * @param n The id of value in array style. Id is (x + y * 3).
+		 * @param n The id of value in array style. Id is L::index(x, y, 3).
 		 *
 		 * @return The reference of value at array position n.
-		 * @exception Throw a runtime_error if n isn't in range [0, 8].
+		 * @warning Checked only if GM_BOUNDS_CHECK is 1, abort when n isn't in range [0, 8].
 		 */
-		T	&operator[](unsigned int n)
+		constexpr T	&operator[](unsigned int n) noexcept
 		{
-			if (n >= GM_MAT3_SIZE)
-				throw std::runtime_error("Index out of mat3 bounds");
+			GM_ASSERT_BOUNDS(n < GM_MAT3_SIZE, "Index out of mat3 bounds");
 
 			return (this->values[n]);
 		}
@@ -311,15 +307,14 @@ namespace gm {
 		/**
 		 * @brief Const access values by index.
 		 *
-		 * @param n The id of value in array style. Id is (x + y * 3).
+		 * @param n The id of value in array style. Id is L::index(x, y, 3).
 		 *
 		 * @return The const reference of value at array position n.
-		 * @exception Throw a runtime_error if n isn't in range [0, 8].
+		 * @warning Checked only if GM_BOUNDS_CHECK is 1, abort when n isn't in range [0, 8].
 		 */
-		const T	&operator[](unsigned int n) const
+		constexpr const T	&operator[](unsigned int n) const noexcept
 		{
-			if (n >= GM_MAT3_SIZE)
-				throw std::runtime_error("Index out of mat3 bounds");
+			GM_ASSERT_BOUNDS(n < GM_MAT3_SIZE, "Index out of mat3 bounds");
 
 			return (this->values[n]);
 		}
@@ -333,9 +328,9 @@ namespace gm {
 		 *
 		 * @return The const reference of value at position (x,y).
 		 */
-		const T	&operator[](const Vec2u &vec2) const
+		constexpr const T	&operator[](const Vec2u &vec2) const
 		{
-			return (this->values[vec2.x + vec2.y * 3]);
+			return (this->values[L::index(vec2.x, vec2.y, 3)]);
 		}
 
 		/**
@@ -347,9 +342,9 @@ namespace gm {
 		 *
 		 * @return The reference of value at position (x,y).
 		 */
-		T	&operator[](const Vec2u &vec2)
+		constexpr T	&operator[](const Vec2u &vec2)
 		{
-			return (this->values[vec2.x + vec2.y * 3]);
+			return (this->values[L::index(vec2.x, vec2.y, 3)]);
 		}
 
 		//**** PUBLIC METHODS **************************************************
@@ -358,7 +353,7 @@ namespace gm {
 		 *
 		 * @return The determinant of the matrix.
 		 */
-		T	determinant(void) const
+		constexpr T	determinant(void) const
 		{
 			T	num0 = this->values[0];
 			T	det0 = (this->values[4] * this->values[8]) -
@@ -378,9 +373,9 @@ namespace gm {
 		 *
 		 * @return A Mat2 with x1, x2, y1 and y2 as values.
 		 */
-		Mat2<T>	asMat2(void) const
+		constexpr Mat2<T, L>	asMat2(void) const
 		{
-			Mat2<T>	res;
+			Mat2<T, L>	res;
 
 			res.values[0] = this->values[0];
 			res.values[1] = this->values[1];
@@ -397,9 +392,9 @@ namespace gm {
 		 *
 		 * @return 3x3 identity matrix.
 		 */
-		static Mat3<T>	identity(void)
+		static constexpr Mat3<T, L>	identity(void)
 		{
-			Mat3<T>	res;
+			Mat3<T, L>	res;
 
 			res.values[0] = static_cast<T>(1);
 			res.values[4] = static_cast<T>(1);
@@ -416,28 +411,31 @@ namespace gm {
 		 *
 		 * @return 3x3 rotation matrix of parameter.
 		 */
-		static Mat3<T>	rotation(const Vec3<T> &axis, T radians)
+		static Mat3<T, L>	rotation(const Vec3<T> &axis, T radians)
 		{
-			Mat3<T>	res;
-			T		tmpCos = static_cast<T>(cos(static_cast<double>(-radians)));
-			T		tmpSin = static_cast<T>(sin(static_cast<double>(-radians)));
+			Mat3<T, L>	res;
+			T		tmpCos;
+			T		tmpSin;
+
+			__sincos(static_cast<T>(-radians), tmpSin, tmpCos);
+
 			T		invTmpCos = static_cast<T>(1) - tmpCos;
 			T		tmpSinAx = tmpSin * axis.x;
 			T		tmpSinAy = tmpSin * axis.y;
 			T		tmpSinAz = tmpSin * axis.z;
 
 			// Line 1
-			res.values[0] = (axis.x * axis.x) * invTmpCos + tmpCos;
-			res.values[1] = (axis.x * axis.y) * invTmpCos - tmpSinAz;
-			res.values[2] = (axis.x * axis.z) * invTmpCos + tmpSinAy;
+			res.at(0, 0) = (axis.x * axis.x) * invTmpCos + tmpCos;
+			res.at(1, 0) = (axis.x * axis.y) * invTmpCos - tmpSinAz;
+			res.at(2, 0) = (axis.x * axis.z) * invTmpCos + tmpSinAy;
 			// Line 2
-			res.values[3] = (axis.y * axis.x) * invTmpCos + tmpSinAz;
-			res.values[4] = (axis.y * axis.y) * invTmpCos + tmpCos;
-			res.values[5] = (axis.y * axis.z) * invTmpCos - tmpSinAx;
+			res.at(0, 1) = (axis.y * axis.x) * invTmpCos + tmpSinAz;
+			res.at(1, 1) = (axis.y * axis.y) * invTmpCos + tmpCos;
+			res.at(2, 1) = (axis.y * axis.z) * invTmpCos - tmpSinAx;
 			// Line 3
-			res.values[6] = (axis.z * axis.x) * invTmpCos - tmpSinAy;
-			res.values[7] = (axis.z * axis.y) * invTmpCos + tmpSinAx;
-			res.values[8] = (axis.z * axis.z) * invTmpCos + tmpCos;
+			res.at(0, 2) = (axis.z * axis.x) * invTmpCos - tmpSinAy;
+			res.at(1, 2) = (axis.z * axis.y) * invTmpCos + tmpSinAx;
+			res.at(2, 2) = (axis.z * axis.z) * invTmpCos + tmpCos;
 
 			return (res);
 		}
@@ -449,12 +447,12 @@ namespace gm {
 		 *
 		 * @return 3x3 translation matrix of parameter.
 		 */
-		static Mat3<T>	translation(const Vec2<T> &movement)
+		static constexpr Mat3<T, L>	translation(const Vec2<T> &movement)
 		{
-			Mat3<T>	res(static_cast<T>(1));
+			Mat3<T, L>	res(static_cast<T>(1));
 
-			res.values[2] = movement.x;
-			res.values[5] = movement.y;
+			res.at(2, 0) = movement.x;
+			res.at(2, 1) = movement.y;
 
 			return (res);
 		}
@@ -466,10 +464,10 @@ namespace gm {
 	//**** EXTERNS OPERATORS ***************************************************
 	//---- Matrix matrix operator ----------------------------------------------
 
-	template <typename T>
-	Mat3<T>	operator+(const Mat3<T> &m1, const Mat3<T> &m2)
+	template <typename T, class L>
+	constexpr Mat3<T, L>	operator+(const Mat3<T, L> &m1, const Mat3<T, L> &m2)
 	{
-		Mat3<T>	res;
+		Mat3<T, L>	res;
 
 		for (int i = 0; i < GM_MAT3_SIZE; i++)
 			res.values[i] = m1.values[i] + m2.values[i];
@@ -477,10 +475,10 @@ namespace gm {
 		return (res);
 	}
 
-	template <typename T>
-	Mat3<T>	operator-(const Mat3<T> &m1, const Mat3<T> &m2)
+	template <typename T, class L>
+	constexpr Mat3<T, L>	operator-(const Mat3<T, L> &m1, const Mat3<T, L> &m2)
 	{
-		Mat3<T>	res;
+		Mat3<T, L>	res;
 
 		for (int i = 0; i < GM_MAT3_SIZE; i++)
 			res.values[i] = m1.values[i] - m2.values[i];
@@ -496,30 +494,24 @@ namespace gm {
 	 *
 	 * @return Result of m1 * m2.
 	 */
-	template <typename T>
-	Mat3<T>	operator*(const Mat3<T> &m1, const Mat3<T> &m2)
+	template <typename T, class L>
+	constexpr Mat3<T, L>	operator*(const Mat3<T, L> &m1, const Mat3<T, L> &m2)
 	{
-		Mat3<T>	res;
-
-		res.values[0] = m1.values[0] * m2.values[0] + m1.values[1] * m2.values[3] + m1.values[2] * m2.values[6];
-		res.values[1] = m1.values[0] * m2.values[1] + m1.values[1] * m2.values[4] + m1.values[2] * m2.values[7];
-		res.values[2] = m1.values[0] * m2.values[2] + m1.values[1] * m2.values[5] + m1.values[2] * m2.values[8];
-		res.values[3] = m1.values[3] * m2.values[0] + m1.values[4] * m2.values[3] + m1.values[5] * m2.values[6];
-		res.values[4] = m1.values[3] * m2.values[1] + m1.values[4] * m2.values[4] + m1.values[5] * m2.values[7];
-		res.values[5] = m1.values[3] * m2.values[2] + m1.values[4] * m2.values[5] + m1.values[5] * m2.values[8];
-		res.values[6] = m1.values[6] * m2.values[0] + m1.values[7] * m2.values[3] + m1.values[8] * m2.values[6];
-		res.values[7] = m1.values[6] * m2.values[1] + m1.values[7] * m2.values[4] + m1.values[8] * m2.values[7];
-		res.values[8] = m1.values[6] * m2.values[2] + m1.values[7] * m2.values[5] + m1.values[8] * m2.values[8];
+		Mat3<T, L>	res;
+
+		for (unsigned int y = 0; y < 3; y++)
+			for (unsigned int x = 0; x < 3; x++)
+				res.at(x, y) = __dot(m1.at(0, y), m2.at(x, 0), m1.at(1, y), m2.at(x, 1), m1.at(2, y), m2.at(x, 2));
 
 		return (res);
 	}
 
 	//---- Matrix value operator -----------------------------------------------
 
-	template <typename T>
-	Mat3<T>	operator*(const Mat3<T> &mat3, const T &value)
+	template <typename T, class L>
+	constexpr Mat3<T, L>	operator*(const Mat3<T, L> &mat3, const T &value)
 	{
-		Mat3<T>	res;
+		Mat3<T, L>	res;
 
 		for (int i = 0; i < GM_MAT3_SIZE; i++)
 			res.values[i] = mat3.values[i] * value;
@@ -527,10 +519,10 @@ namespace gm {
 		return (res);
 	}
 
-	template <typename T>
-	Mat3<T>	operator*(const T &value, const Mat3<T> &mat3)
+	template <typename T, class L>
+	constexpr Mat3<T, L>	operator*(const T &value, const Mat3<T, L> &mat3)
 	{
-		Mat3<T>	res;
+		Mat3<T, L>	res;
 
 		for (int i = 0; i < GM_MAT3_SIZE; i++)
 			res.values[i] = mat3.values[i] * value;
@@ -538,10 +530,10 @@ namespace gm {
 		return (res);
 	}
 
-	template <typename T>
-	Mat3<T>	operator/(const Mat3<T> &mat3, const T &value)
+	template <typename T, class L>
+	constexpr Mat3<T, L>	operator/(const Mat3<T, L> &mat3, const T &value)
 	{
-		Mat3<T>	res;
+		Mat3<T, L>	res;
 
 		for (int i = 0; i < GM_MAT3_SIZE; i++)
 			res.values[i] = mat3.values[i] / value;
@@ -551,12 +543,12 @@ namespace gm {
 
 	//---- Print operator ------------------------------------------------------
 
-	template <typename T>
-	std::ostream	&operator<<(std::ostream &os, const Mat3<T> &mat3)
+	template <typename T, class L>
+	std::ostream	&operator<<(std::ostream &os, const Mat3<T, L> &mat3)
 	{
-		os << "|(" << mat3.values[0] << "," << mat3.values[1] << "," << mat3.values[2]
-			<< ");(" << mat3.values[3] << "," << mat3.values[4] << "," << mat3.values[5]
-			<< ");(" << mat3.values[6] << "," << mat3.values[7] << "," << mat3.values[8] << ")|";
+		os << "|(" << mat3.at(0, 0) << "," << mat3.at(1, 0) << "," << mat3.at(2, 0)
+			<< ");(" << mat3.at(0, 1) << "," << mat3.at(1, 1) << "," << mat3.at(2, 1)
+			<< ");(" << mat3.at(0, 2) << "," << mat3.at(1, 2) << "," << mat3.at(2, 2) << ")|";
 		return (os);
 	}
 
@@ -567,14 +559,14 @@ namespace gm {
 	 *
 	 * @param mat3 The Mat3 to print.
 	 */
-	template <typename T>
-	void	print(const Mat3<T> &mat3)
+	template <typename T, class L>
+	void	print(const Mat3<T, L> &mat3)
 	{
-		Mat3<T>	res;
+		Mat3<T, L>	res;
 
-		std::cout	<< "|" << mat3.values[0] << ", " << mat3.values[1] << ", " << mat3.values[2] << "|\n"
-					<< "|" << mat3.values[3] << ", " << mat3.values[4] << ", " << mat3.values[5] << "|\n"
-					<< "|" << mat3.values[6] << ", " << mat3.values[7] << ", " << mat3.values[8] << "|" << std::endl;
+		std::cout	<< "|" << mat3.at(0, 0) << ", " << mat3.at(1, 0) << ", " << mat3.at(2, 0) << "|\n"
+					<< "|" << mat3.at(0, 1) << ", " << mat3.at(1, 1) << ", " << mat3.at(2, 1) << "|\n"
+					<< "|" << mat3.at(0, 2) << ", " << mat3.at(1, 2) << ", " << mat3.at(2, 2) << "|" << std::endl;
 	}
 
 	/**
@@ -584,10 +576,10 @@ namespace gm {
 	 *
 	 * @return Mat3 transposed.
 	 */
-	template <typename T>
-	Mat3<T>	transpose(const Mat3<T> &mat3)
+	template <typename T, class L>
+	Mat3<T, L>	transpose(const Mat3<T, L> &mat3)
 	{
-		Mat3<T>	res;
+		Mat3<T, L>	res;
 
 		res.values[0] = mat3.values[0];
 		res.values[1] = mat3.values[3];
@@ -611,10 +603,10 @@ namespace gm {
 	 *
 	 * @return Mat3 rotate by axis and angle in radians.
 	 */
-	template <typename T>
-	Mat3<T>	rotate(const Mat3<T> &mat3, const Vec3<T> &axis, T radians)
+	template <typename T, class L>
+	Mat3<T, L>	rotate(const Mat3<T, L> &mat3, const Vec3<T> &axis, T radians)
 	{
-		const Mat3<T>	matRot = Mat3<T>::rotation(axis, radians);
+		const Mat3<T, L>	matRot = Mat3<T, L>::rotation(axis, radians);
 
 		return (mat3 * matRot);
 	}
@@ -627,10 +619,10 @@ namespace gm {
 	 *
 	 * @return Mat3 translate by movement vector.
 	 */
-	template <typename T>
-	Mat3<T>	translate(const Mat3<T> &mat3, const Vec2<T> &movement)
+	template <typename T, class L>
+	Mat3<T, L>	translate(const Mat3<T, L> &mat3, const Vec2<T> &movement)
 	{
-		const Mat3<T>	matTranslate = Mat3<T>::translation(movement);
+		const Mat3<T, L>	matTranslate = Mat3<T, L>::translation(movement);
 
 		return (mat3 * matTranslate);
 	}
@@ -642,8 +634,8 @@ namespace gm {
 	 *
 	 * @return Hash of Mat3.
 	 */
-	template <typename T>
-	std::size_t	hash(const Mat3<T> &mat3)
+	template <typename T, class L>
+	std::size_t	hash(const Mat3<T, L> &mat3)
 	{
 		std::size_t	hash = 0;
 
@@ -680,6 +672,37 @@ namespace gm {
 	 * The class is design to be used with graphic library like OpenGL or Vulkan.
 	 */
 	using Mat3d = Mat3<double>;
+	/**
+	 * @brief Class for 3x3 column-major float matrix.
+	 *
+	 * GLSL puts the columns of a mat3 16 bytes apart in std140 and std430,
+	 * write it with BlockLayout.
+	 */
+	using Mat3fc = Mat3<float, ColumnMajor>;
+	/**
+	 * @brief Class for 3x3 column-major double matrix.
+	 *
+	 * GLSL puts the columns of a mat3 16 bytes apart in std140 and std430,
+	 * write it with BlockLayout.
+	 */
+	using Mat3dc = Mat3<double, ColumnMajor>;
+
+	//**** CHECKS **************************************************************
+
+	static_assert(std::is_trivially_copyable<Mat3u>::value && std::is_trivially_destructible<Mat3u>::value,
+					"Mat3u must be trivially copyable");
+	static_assert(std::is_trivially_copyable<Mat3i>::value && std::is_trivially_destructible<Mat3i>::value,
+					"Mat3i must be trivially copyable");
+	static_assert(std::is_trivially_copyable<Mat3f>::value && std::is_trivially_destructible<Mat3f>::value,
+					"Mat3f must be trivially copyable");
+	static_assert(std::is_trivially_copyable<Mat3d>::value && std::is_trivially_destructible<Mat3d>::value,
+					"Mat3d must be trivially copyable");
+	static_assert(std::is_trivially_copyable<Mat3fc>::value && std::is_trivially_destructible<Mat3fc>::value,
+					"Mat3fc must be trivially copyable");
+	static_assert(Mat3i::translation(Vec2i(1, 2)) * Mat3i::translation(Vec2i(3, 4)) == Mat3i::translation(Vec2i(4, 6)),
+					"Mat3 must be constexpr");
+	static_assert(Mat3<int, ColumnMajor>::translation(Vec2i(1, 2))[6] == 1 && Mat3<int, ColumnMajor>::translation(Vec2i(1, 2))[7] == 2,
+					"Mat3 must store columns contiguously in ColumnMajor");
 }
 
 #endif
@@ -6,11 +6,13 @@
 # include <gmath/Vec3.hpp>
 # include <gmath/Mat2.hpp>
 # include <gmath/Mat3.hpp>
+# include <gmath/layout.hpp>
 # include <gmath/utils.hpp>
 
 #include <cmath>
 #include <iostream>
 #include <stdexcept>
+#include <type_traits>
 
 namespace gm {
 	//**** STATIC FUNCTIONS DEFINE *********************************************
@@ -20,10 +22,11 @@ namespace gm {
 	 * @brief Class for 4x4 matrix.
 	 *
 	 * @tparam T Type of value in the matrix.
+	 * @tparam L Storage order of values, RowMajor or ColumnMajor.
 	 *
 	 * The class is design to be used with graphic library like OpenGL or Vulkan.
 	 */
-	template <typename T>
+	template <typename T, class L = RowMajor>
 	class Mat4
 	{
 	public:
@@ -37,11 +40,7 @@ namespace gm {
 		 *
 		 * @return The Mat4 with values at 0.
 		 */
-		Mat4(void)
-		{
-			for (int i = 0; i < GM_MAT4_SIZE; i++)
-				this->values[i] = T();
-		}
+		constexpr Mat4(void) : values() {}
 
 		/**
 		 * @brief Copy constructor of Mat4 class.
@@ -50,20 +49,16 @@ namespace gm {
 		 *
 		 * @return The Mat4 copied from parameter.
 		 */
-		Mat4(const Mat4 &mat4)
-		{
-			for (int i = 0; i < GM_MAT4_SIZE; i++)
-				this->values[i] = mat4.values[i];
-		}
+		Mat4(const Mat4 &mat4) = default;
 
 		/**
 		 * @brief Constructor of Mat4 class from an array.
 		 *
-		 * @param values Values in array form.
+		 * @param values Values in array form, in the storage order of L.
 		 *
 		 * @return Mat4 values of the array.
 		 */
-		Mat4(const T values[GM_MAT4_SIZE])
+		constexpr Mat4(const T values[GM_MAT4_SIZE]) : values()
 		{
 			for (int i = 0; i < GM_MAT4_SIZE; i++)
 				this->values[i] = values[i];
@@ -91,30 +86,34 @@ namespace gm {
 		 *
 		 * @return Mat3 values of parameters.
 		 */
-		Mat4(T x1, T x2, T x3, T x4,
+		constexpr Mat4(T x1, T x2, T x3, T x4,
 				T y1, T y2, T y3, T y4,
 				T z1, T z2, T z3, T z4,
-				T w1, T w2, T w3, T w4)
+				T w1, T w2, T w3, T w4) : values()
 		{
-			this->values[ 0] = x1;
-			this->values[ 1] = x2;
-			this->values[ 2] = x3;
-			this->values[ 3] = x4;
-
-			this->values[ 4] = y1;
-			this->values[ 5] = y2;
-			this->values[ 6] = y3;
-			this->values[ 7] = y4;
-
-			this->values[ 8] = z1;
-			this->values[ 9] = z2;
-			this->values[10] = z3;
-			this->values[11] = z4;
-
-			this->values[12] = w1;
-			this->values[13] = w2;
-			this->values[14] = w3;
-			this->values[15] = w4;
+			const T	list[GM_MAT4_SIZE] = {x1, x2, x3, x4,
+										y1, y2, y3, y4,
+										z1, z2, z3, z4,
+										w1, w2, w3, w4};
+
+			for (unsigned int i = 0; i < GM_MAT4_SIZE; i++)
+				this->at(i % 4, i / 4) = list[i];
+		}
+
+		/**
+		 * @brief Constructor of Mat4 class from a Mat4 of the other storage
+		 * order.
+		 *
+		 * @param mat4 The Mat4 to convert.
+		 *
+		 * @return Mat4 with the same elements as mat4.
+		 */
+		template <class O>
+		constexpr explicit Mat4(const Mat4<T, O> &mat4) : values()
+		{
+			for (unsigned int y = 0; y < 4; y++)
+				for (unsigned int x = 0; x < 4; x++)
+					this->at(x, y) = mat4.at(x, y);
 		}
 
 		/**
@@ -124,7 +123,7 @@ namespace gm {
 		 *
 		 * @return Mat4 with x1, x2, y1 and y2 from mat2, other value to 0.
 		 */
-		Mat4(const Mat2<T> mat2)
+		constexpr Mat4(const Mat2<T, L> mat2) : values()
 		{
 			this->values[ 0] = mat2.values[0];
 			this->values[ 1] = mat2.values[1];
@@ -154,7 +153,7 @@ namespace gm {
 		 *
 		 * @return Mat4 with x1, x2, x3, y1, y2, y3, z1, z2 and z3 from mat3, other value to 0.
 		 */
-		Mat4(const Mat3<T> mat3)
+		constexpr Mat4(const Mat3<T, L> mat3) : values()
 		{
 			this->values[ 0] = mat3.values[0];
 			this->values[ 1] = mat3.values[1];
@@ -184,8 +183,8 @@ namespace gm {
 		 *
 		 * @return Mat4 identity * scale.
 		 */
-		 Mat4(T scale)
-		 {
+		constexpr Mat4(T scale) : values()
+		{
 			this->values[ 0] = scale;
 			this->values[ 1] = T();
 			this->values[ 2] = T();
@@ -205,13 +204,11 @@ namespace gm {
 			this->values[13] = T();
 			this->values[14] = T();
 			this->values[15] = scale;
-		 }
+		}
 
 		//---- Destructor ------------------------------------------------------
 
-		~Mat4()
-		{
-		}
+		~Mat4() = default;
 
 		//**** ACCESSORS *******************************************************
 		//---- Getters ---------------------------------------------------------
@@ -223,13 +220,12 @@ namespace gm {
 		 * @param y y index, must in range [0, 3].
 		 *
 		 * @return The value at position (x,y).
-		 * @exception Throw a runtime_error when x and y isn't in range [0, 3].
+		 * @warning Checked only if GM_BOUNDS_CHECK is 1, abort when x and y isn't in range [0, 3].
 		 */
-		T	get(unsigned int x, unsigned int y) const
+		constexpr T	get(unsigned int x, unsigned int y) const noexcept
 		{
-			if (x >= 4 || y >= 4)
-				throw std::runtime_error("Index out of mat4 bounds");
-			return (this->values[x + y * 4]);
+			GM_ASSERT_BOUNDS(x < 4 && y < 4, "Index out of mat4 bounds");
+			return (this->values[L::index(x, y, 4)]);
 		}
 
 		/**
@@ -242,9 +238,9 @@ namespace gm {
 		 *
 		 * @return The reference of value at position (x,y).
 		 */
-		T	&at(unsigned int x, unsigned int y)
+		constexpr T	&at(unsigned int x, unsigned int y)
 		{
-			return (this->values[x + y * 4]);
+			return (this->values[L::index(x, y, 4)]);
 		}
 
 		/**
@@ -257,9 +253,9 @@ namespace gm {
 		 *
 		 * @return The const reference of value at position (x,y).
 		 */
-		const T	&at(unsigned int x, unsigned int y) const
+		constexpr const T	&at(unsigned int x, unsigned int y) const
 		{
-			return (this->values[x + y * 4]);
+			return (this->values[L::index(x, y, 4)]);
 		}
 
 		/**
@@ -271,13 +267,12 @@ namespace gm {
 		 *
 		 * @return The row at row pos y as a Vec4.
 		 */
-		Vec4<T>	row(unsigned int y) const
+		constexpr Vec4<T>	row(unsigned int y) const
 		{
-			unsigned int	id = y * 4;
-			return (Vec4<T>(this->values[id],
-							this->values[id + 1],
-							this->values[id + 2],
-							this->values[id + 3]));
+			return (Vec4<T>(this->at(0, y),
+							this->at(1, y),
+							this->at(2, y),
+							this->at(3, y)));
 		}
 
 		//---- Setters ---------------------------------------------------------
@@ -289,29 +284,19 @@ namespace gm {
 		 * @param y y index, must in range [0, 3].
 		 * @param value The value to set.
 		 *
-		 * @exception Throw a runtime_error when x and y isn't in range [0, 3].
+		 * @warning Checked only if GM_BOUNDS_CHECK is 1, abort when x and y isn't in range [0, 3].
 		 */
-		void	set(unsigned int x, unsigned int y, const T &value)
+		constexpr void	set(unsigned int x, unsigned int y, const T &value) noexcept
 		{
-			if (x >= 4 || y >= 4)
-				throw std::runtime_error("Index out of mat4 bounds");
-			this->values[x + y * 4] = value;
+			GM_ASSERT_BOUNDS(x < 4 && y < 4, "Index out of mat4 bounds");
+			this->values[L::index(x, y, 4)] = value;
 		}
 
 		//---- Modify Operators ------------------------------------------------
 
-		Mat4	&operator=(const Mat4 &mat4)
-		{
-			if (this == &mat4)
-				return (*this);
+		Mat4	&operator=(const Mat4 &mat4) = default;
 
-			for (int i = 0; i < GM_MAT4_SIZE; i++)
-				this->values[i] = mat4.values[i];
-
-			return (*this);
-		}
-
-		Mat4	&operator+=(const Mat4 &mat4)
+		constexpr Mat4	&operator+=(const Mat4 &mat4)
 		{
 			for (int i = 0; i < GM_MAT4_SIZE; i++)
 				this->values[i] += mat4.values[i];
@@ -319,7 +304,7 @@ namespace gm {
 			return (*this);
 		}
 
-		Mat4	&operator-=(const Mat4 &mat4)
+		constexpr Mat4	&operator-=(const Mat4 &mat4)
 		{
 			for (int i = 0; i < GM_MAT4_SIZE; i++)
 				this->values[i] -= mat4.values[i];
@@ -327,7 +312,7 @@ namespace gm {
 			return (*this);
 		}
 
-		Mat4	&operator*=(const T &value)
+		constexpr Mat4	&operator*=(const T &value)
 		{
 			for (int i = 0; i < GM_MAT4_SIZE; i++)
 				this->values[i] *= value;
@@ -335,7 +320,7 @@ namespace gm {
 			return (*this);
 		}
 
-		Mat4	&operator/=(const T &value)
+		constexpr Mat4	&operator/=(const T &value)
 		{
 			for (int i = 0; i < GM_MAT4_SIZE; i++)
 				this->values[i] /= value;
@@ -345,7 +330,7 @@ namespace gm {
 
 		//---- Compare Operators -----------------------------------------------
 
-		bool	operator==(const Mat4 &mat4) const
+		constexpr bool	operator==(const Mat4 &mat4) const
 		{
 			for (int i = 0; i < GM_MAT4_SIZE; i++)
 				if (this->values[i] != mat4.values[i])
@@ -354,7 +339,7 @@ namespace gm {
 			return (true);
 		}
 
-		bool	operator!=(const Mat4 &mat4) const
+		constexpr bool	operator!=(const Mat4 &mat4) const
 		{
 			for (int i = 0; i < GM_MAT4_SIZE; i++)
 				if (this->values[i] != mat4.values[i])
@@ -368,15 +353,14 @@ namespace gm {
 		/**
 		 * @brief Access values by index.
 		 *
-		 * @param n The id of value in array style. Id is (x + y * 4).
+		 * @param n The id of value in array style. Id is L::index(x, y, 4).
 		 *
 		 * @return The reference of value at array position n.
-		 * @exception Throw a runtime_error if n isn't in range [0, 15].
+		 * @warning Checked only if GM_BOUNDS_CHECK is 1, abort when n isn't in range [0, 15].
 		 */
-		T	&operator[](unsigned int n)
+		constexpr T	&operator[](unsigned int n) noexcept
 		{
-			if (n >= GM_MAT4_SIZE)
-				throw std::runtime_error("Index out of mat4 bounds");
+			GM_ASSERT_BOUNDS(n < GM_MAT4_SIZE, "Index out of mat4 bounds");
 
 			return (this->values[n]);
 		}
@@ -384,15 +368,14 @@ namespace gm {
 		/**
 		 * @brief Const access values by index.
 		 *
-		 * @param n The id of value in array style. Id is (x + y * 4).
+		 * @param n The id of value in array style. Id is L::index(x, y, 4).
 		 *
 		 * @return The const reference of value at array position n.
-		 * @exception Throw a runtime_error if n isn't in range [0, 15].
+		 * @warning Checked only if GM_BOUNDS_CHECK is 1, abort when n isn't in range [0, 15].
 		 */
-		const T	&operator[](unsigned int n) const
+		constexpr const T	&operator[](unsigned int n) const noexcept
 		{
-			if (n >= GM_MAT4_SIZE)
-				throw std::runtime_error("Index out of mat4 bounds");
+			GM_ASSERT_BOUNDS(n < GM_MAT4_SIZE, "Index out of mat4 bounds");
 
 			return (this->values[n]);
 		}
@@ -406,9 +389,9 @@ namespace gm {
 		 *
 		 * @return The reference of value at position (x,y).
 		 */
-		T	&operator[](const Vec2u &vec2)
+		constexpr T	&operator[](const Vec2u &vec2)
 		{
-			return (this->values[vec2.x + vec2.y * 4]);
+			return (this->values[L::index(vec2.x, vec2.y, 4)]);
 		}
 
 		/**
@@ -420,9 +403,9 @@ namespace gm {
 		 *
 		 * @return The const reference of value at position (x,y).
 		 */
-		const T	&operator[](const Vec2u &vec2) const
+		constexpr const T	&operator[](const Vec2u &vec2) const
 		{
-			return (this->values[vec2.x + vec2.y * 4]);
+			return (this->values[L::index(vec2.x, vec2.y, 4)]);
 		}
 
 		//**** PUBLIC METHODS **************************************************
@@ -431,7 +414,7 @@ namespace gm {
 		 *
 		 * @return The determinant of the matrix.
 		 */
-		T	determinant(void) const
+		constexpr T	determinant(void) const
 		{
 			// Det a
 			T	numA0 = this->values[5];
@@ -488,9 +471,9 @@ namespace gm {
 		 *
 		 * @return A Mat2 with x1, x2, y1 and y2 as values.
 		 */
-		Mat2<T>	asMat2(void) const
+		constexpr Mat2<T, L>	asMat2(void) const
 		{
-			Mat2<T>	res;
+			Mat2<T, L>	res;
 
 			res.values[0] = this->values[0];
 			res.values[1] = this->values[1];
@@ -505,9 +488,9 @@ namespace gm {
 		 *
 		 * @return A Mat3 with x1, x2, x3, y1, y2, y3, z1, z2 and z3 as values.
 		 */
-		Mat3<T>	asMat3(void) const
+		constexpr Mat3<T, L>	asMat3(void) const
 		{
-			Mat3<T>	res;
+			Mat3<T, L>	res;
 
 			res.values[0] = this->values[0];
 			res.values[1] = this->values[1];
@@ -529,9 +512,9 @@ namespace gm {
 		 *
 		 * @return 4x4 identity matrix.
 		 */
-		static Mat4<T>	identity(void)
+		static constexpr Mat4<T, L>	identity(void)
 		{
-			Mat4<T>	res;
+			Mat4<T, L>	res;
 
 			res.values[0] = static_cast<T>(1);
 			res.values[5] = static_cast<T>(1);
@@ -549,36 +532,39 @@ namespace gm {
 		 *
 		 * @return 4x4 rotation matrix of parameter.
 		 */
-		static Mat4<T>	rotation3D(const Vec3<T> &axis, T radians)
+		static Mat4<T, L>	rotation3D(const Vec3<T> &axis, T radians)
 		{
-			Mat4<T>	res;
-			T		tmpCos = static_cast<T>(cos(static_cast<double>(-radians)));
-			T		tmpSin = static_cast<T>(sin(static_cast<double>(-radians)));
+			Mat4<T, L>	res;
+			T		tmpCos;
+			T		tmpSin;
+
+			__sincos(static_cast<T>(-radians), tmpSin, tmpCos);
+
 			T		invTmpCos = static_cast<T>(1) - tmpCos;
 			T		tmpSinAx = tmpSin * axis.x;
 			T		tmpSinAy = tmpSin * axis.y;
 			T		tmpSinAz = tmpSin * axis.z;
 
 			// Line 1
-			res.values[ 0] = (axis.x * axis.x) * invTmpCos + tmpCos;
-			res.values[ 1] = (axis.x * axis.y) * invTmpCos - tmpSinAz;
-			res.values[ 2] = (axis.x * axis.z) * invTmpCos + tmpSinAy;
-			res.values[ 3] = T();
+			res.at(0, 0) = (axis.x * axis.x) * invTmpCos + tmpCos;
+			res.at(1, 0) = (axis.x * axis.y) * invTmpCos - tmpSinAz;
+			res.at(2, 0) = (axis.x * axis.z) * invTmpCos + tmpSinAy;
+			res.at(3, 0) = T();
 			// Line 2
-			res.values[ 4] = (axis.y * axis.x) * invTmpCos + tmpSinAz;
-			res.values[ 5] = (axis.y * axis.y) * invTmpCos + tmpCos;
-			res.values[ 6] = (axis.y * axis.z) * invTmpCos - tmpSinAx;
-			res.values[ 7] = T();
+			res.at(0, 1) = (axis.y * axis.x) * invTmpCos + tmpSinAz;
+			res.at(1, 1) = (axis.y * axis.y) * invTmpCos + tmpCos;
+			res.at(2, 1) = (axis.y * axis.z) * invTmpCos - tmpSinAx;
+			res.at(3, 1) = T();
 			// Line 3
-			res.values[ 8] = (axis.z * axis.x) * invTmpCos - tmpSinAy;
-			res.values[ 9] = (axis.z * axis.y) * invTmpCos + tmpSinAx;
-			res.values[10] = (axis.z * axis.z) * invTmpCos + tmpCos;
-			res.values[11] = T();
+			res.at(0, 2) = (axis.z * axis.x) * invTmpCos - tmpSinAy;
+			res.at(1, 2) = (axis.z * axis.y) * invTmpCos + tmpSinAx;
+			res.at(2, 2) = (axis.z * axis.z) * invTmpCos + tmpCos;
+			res.at(3, 2) = T();
 			// Line 4
-			res.values[12] = T();
-			res.values[13] = T();
-			res.values[14] = T();
-			res.values[15] = static_cast<T>(1);
+			res.at(0, 3) = T();
+			res.at(1, 3) = T();
+			res.at(2, 3) = T();
+			res.at(3, 3) = static_cast<T>(1);
 
 			return (res);
 		}
@@ -590,13 +576,13 @@ namespace gm {
 		 *
 		 * @return 4x4 translation matrix of parameter.
 		 */
-		static Mat4<T>	translation(const Vec3<T> &movement)
+		static constexpr Mat4<T, L>	translation(const Vec3<T> &movement)
 		{
-			Mat4<T>	res(static_cast<T>(1));
+			Mat4<T, L>	res(static_cast<T>(1));
 
-			res.values[3] = movement.x;
-			res.values[7] = movement.y;
-			res.values[11] = movement.z;
+			res.at(3, 0) = movement.x;
+			res.at(3, 1) = movement.y;
+			res.at(3, 2) = movement.z;
 
 			return (res);
 		}
@@ -611,22 +597,22 @@ namespace gm {
 		 *
 		 * @return The perspective matrix.
 		 */
-		static Mat4<T>	perspective(T fovY, T ratio, T near, T far)
+		static Mat4<T, L>	perspective(T fovY, T ratio, T near, T far)
 		{
-			Mat4<T>	res;
+			Mat4<T, L>	res;
 
 			// Compute fov
-			T	tanFov = tan(fovY / static_cast<T>(2));
+			T	tanFov = __tan(fovY / static_cast<T>(2));
 
 			// Scaling factor x * ratio because fov is for y
-			res.values[0] = static_cast<T>(1) / (tanFov * ratio);
+			res.at(0, 0) = static_cast<T>(1) / (tanFov * ratio);
 			// Scaling factor y
-			res.values[5] = static_cast<T>(1) / tanFov;
+			res.at(1, 1) = static_cast<T>(1) / tanFov;
 
-			// Remap z in range [0, 1]
-			res.values[10] = - (far / (far - near));
-			res.values[11] = - static_cast<T>(1);
-			res.values[14] = - ((far * near) / (far - near));
+			// Remap z in range [0, 1], w is -z
+			res.at(2, 2) = - (far / (far - near));
+			res.at(3, 2) = - ((far * near) / (far - near));
+			res.at(2, 3) = - static_cast<T>(1);
 
 			return (res);
 		}
@@ -640,28 +626,28 @@ namespace gm {
 		 *
 		 * @return The view matrix.
 		 */
-		static Mat4<T>	lookAt(const Vec3<T> &eye, const Vec3<T> &center, const Vec3<T> &up)
+		static Mat4<T, L>	lookAt(const Vec3<T> &eye, const Vec3<T> &center, const Vec3<T> &up)
 		{
 			const Vec3<T>	f(normalize(center - eye));
 			const Vec3<T>	s(normalize(cross(f, up)));
 			const Vec3<T>	u(cross(s, f));
 
-			Mat4<T>	res(static_cast<T>(1));
+			Mat4<T, L>	res(static_cast<T>(1));
 
-			res.values[ 0] = s.x;
-			res.values[ 4] = s.y;
-			res.values[ 8] = s.z;
-			res.values[12] = -dot(s, eye);
+			res.at(0, 0) = s.x;
+			res.at(1, 0) = s.y;
+			res.at(2, 0) = s.z;
+			res.at(3, 0) = -dot(s, eye);
 
-			res.values[ 1] = u.x;
-			res.values[ 5] = u.y;
-			res.values[ 9] = u.z;
-			res.values[13] = -dot(u, eye);
+			res.at(0, 1) = u.x;
+			res.at(1, 1) = u.y;
+			res.at(2, 1) = u.z;
+			res.at(3, 1) = -dot(u, eye);
 
-			res.values[ 2] = -f.x;
-			res.values[ 6] = -f.y;
-			res.values[10] = -f.z;
-			res.values[14] = dot(f, eye);
+			res.at(0, 2) = -f.x;
+			res.at(1, 2) = -f.y;
+			res.at(2, 2) = -f.z;
+			res.at(3, 2) = dot(f, eye);
 
 			return (res);
 		}
@@ -673,10 +659,10 @@ namespace gm {
 	//**** EXTERNS OPERATORS ***************************************************
 	//---- Matrix matrix operator ----------------------------------------------
 
-	template <typename T>
-	Mat4<T>	operator+(const Mat4<T> &m1, const Mat4<T> &m2)
+	template <typename T, class L>
+	constexpr Mat4<T, L>	operator+(const Mat4<T, L> &m1, const Mat4<T, L> &m2)
 	{
-		Mat4<T>	res;
+		Mat4<T, L>	res;
 
 		for (int i = 0; i < GM_MAT4_SIZE; i++)
 			res.values[i] = m1.values[i] + m2.values[i];
@@ -684,10 +670,10 @@ namespace gm {
 		return (res);
 	}
 
-	template <typename T>
-	Mat4<T>	operator-(const Mat4<T> &m1, const Mat4<T> &m2)
+	template <typename T, class L>
+	constexpr Mat4<T, L>	operator-(const Mat4<T, L> &m1, const Mat4<T, L> &m2)
 	{
-		Mat4<T>	res;
+		Mat4<T, L>	res;
 
 		for (int i = 0; i < GM_MAT4_SIZE; i++)
 			res.values[i] = m1.values[i] - m2.values[i];
@@ -703,37 +689,25 @@ namespace gm {
 	 *
 	 * @return Result of m1 * m2.
 	 */
-	template <typename T>
-	Mat4<T>	operator*(const Mat4<T> &m1, const Mat4<T> &m2)
+	template <typename T, class L>
+	constexpr Mat4<T, L>	operator*(const Mat4<T, L> &m1, const Mat4<T, L> &m2)
 	{
-		Mat4<T>	res;
-
-		res.values[ 0] = m1.values[ 0] * m2.values[ 0] + m1.values[ 1] * m2.values[ 4] + m1.values[ 2] * m2.values[ 8] + m1.values[ 3] * m2.values[12];
-		res.values[ 1] = m1.values[ 0] * m2.values[ 1] + m1.values[ 1] * m2.values[ 5] + m1.values[ 2] * m2.values[ 9] + m1.values[ 3] * m2.values[13];
-		res.values[ 2] = m1.values[ 0] * m2.values[ 2] + m1.values[ 1] * m2.values[ 6] + m1.values[ 2] * m2.values[10] + m1.values[ 3] * m2.values[14];
-		res.values[ 3] = m1.values[ 0] * m2.values[ 3] + m1.values[ 1] * m2.values[ 7] + m1.values[ 2] * m2.values[11] + m1.values[ 3] * m2.values[15];
-		res.values[ 4] = m1.values[ 4] * m2.values[ 0] + m1.values[ 5] * m2.values[ 4] + m1.values[ 6] * m2.values[ 8] + m1.values[ 7] * m2.values[12];
-		res.values[ 5] = m1.values[ 4] * m2.values[ 1] + m1.values[ 5] * m2.values[ 5] + m1.values[ 6] * m2.values[ 9] + m1.values[ 7] * m2.values[13];
-		res.values[ 6] = m1.values[ 4] * m2.values[ 2] + m1.values[ 5] * m2.values[ 6] + m1.values[ 6] * m2.values[10] + m1.values[ 7] * m2.values[14];
-		res.values[ 7] = m1.values[ 4] * m2.values[ 3] + m1.values[ 5] * m2.values[ 7] + m1.values[ 6] * m2.values[11] + m1.values[ 7] * m2.values[15];
-		res.values[ 8] = m1.values[ 8] * m2.values[ 0] + m1.values[ 9] * m2.values[ 4] + m1.values[10] * m2.values[ 8] + m1.values[11] * m2.values[12];
-		res.values[ 9] = m1.values[ 8] * m2.values[ 1] + m1.values[ 9] * m2.values[ 5] + m1.values[10] * m2.values[ 9] + m1.values[11] * m2.values[13];
-		res.values[10] = m1.values[ 8] * m2.values[ 2] + m1.values[ 9] * m2.values[ 6] + m1.values[10] * m2.values[10] + m1.values[11] * m2.values[14];
-		res.values[11] = m1.values[ 8] * m2.values[ 3] + m1.values[ 9] * m2.values[ 7] + m1.values[10] * m2.values[11] + m1.values[11] * m2.values[15];
-		res.values[12] = m1.values[12] * m2.values[ 0] + m1.values[13] * m2.values[ 4] + m1.values[14] * m2.values[ 8] + m1.values[15] * m2.values[12];
-		res.values[13] = m1.values[12] * m2.values[ 1] + m1.values[13] * m2.values[ 5] + m1.values[14] * m2.values[ 9] + m1.values[15] * m2.values[13];
-		res.values[14] = m1.values[12] * m2.values[ 2] + m1.values[13] * m2.values[ 6] + m1.values[14] * m2.values[10] + m1.values[15] * m2.values[14];
-		res.values[15] = m1.values[12] * m2.values[ 3] + m1.values[13] * m2.values[ 7] + m1.values[14] * m2.values[11] + m1.values[15] * m2.values[15];
+		Mat4<T, L>	res;
+
+		for (unsigned int y = 0; y < 4; y++)
+			for (unsigned int x = 0; x < 4; x++)
+				res.at(x, y) = __dot(m1.at(0, y), m2.at(x, 0), m1.at(1, y), m2.at(x, 1),
+									m1.at(2, y), m2.at(x, 2), m1.at(3, y), m2.at(x, 3));
 
 		return (res);
 	}
 
 	//---- Matrix value operator -----------------------------------------------
 
-	template <typename T>
-	Mat4<T>	operator*(const Mat4<T> &mat4, const T &value)
+	template <typename T, class L>
+	constexpr Mat4<T, L>	operator*(const Mat4<T, L> &mat4, const T &value)
 	{
-		Mat4<T>	res;
+		Mat4<T, L>	res;
 
 		for (int i = 0; i < GM_MAT4_SIZE; i++)
 			res.values[i] = mat4.values[i] * value;
@@ -741,10 +715,10 @@ namespace gm {
 		return (res);
 	}
 
-	template <typename T>
-	Mat4<T>	operator*(const T &value, const Mat4<T> &mat4)
+	template <typename T, class L>
+	constexpr Mat4<T, L>	operator*(const T &value, const Mat4<T, L> &mat4)
 	{
-		Mat4<T>	res;
+		Mat4<T, L>	res;
 
 		for (int i = 0; i < GM_MAT4_SIZE; i++)
 			res.values[i] = mat4.values[i] * value;
@@ -752,10 +726,10 @@ namespace gm {
 		return (res);
 	}
 
-	template <typename T>
-	Mat4<T>	operator/(const Mat4<T> &mat4, const T &value)
+	template <typename T, class L>
+	constexpr Mat4<T, L>	operator/(const Mat4<T, L> &mat4, const T &value)
 	{
-		Mat4<T>	res;
+		Mat4<T, L>	res;
 
 		for (int i = 0; i < GM_MAT4_SIZE; i++)
 			res.values[i] = mat4.values[i] / value;
@@ -765,13 +739,13 @@ namespace gm {
 
 	//---- Print operator ------------------------------------------------------
 
-	template <typename T>
-	std::ostream	&operator<<(std::ostream &os, const Mat4<T> &mat4)
+	template <typename T, class L>
+	std::ostream	&operator<<(std::ostream &os, const Mat4<T, L> &mat4)
 	{
-		os << "|(" << mat4.values[0] << "," << mat4.values[1] << "," << mat4.values[2] << "," << mat4.values[3]
-			<< ");(" << mat4.values[4] << "," << mat4.values[5] << "," << mat4.values[6] << "," << mat4.values[7]
-			<< ");(" << mat4.values[8] << "," << mat4.values[9] << "," << mat4.values[10] << "," << mat4.values[11]
-			<< ");(" << mat4.values[12] << "," << mat4.values[13] << "," << mat4.values[14] << "," << mat4.values[15] << ")|";
+		os << "|(" << mat4.at(0, 0) << "," << mat4.at(1, 0) << "," << mat4.at(2, 0) << "," << mat4.at(3, 0)
+			<< ");(" << mat4.at(0, 1) << "," << mat4.at(1, 1) << "," << mat4.at(2, 1) << "," << mat4.at(3, 1)
+			<< ");(" << mat4.at(0, 2) << "," << mat4.at(1, 2) << "," << mat4.at(2, 2) << "," << mat4.at(3, 2)
+			<< ");(" << mat4.at(0, 3) << "," << mat4.at(1, 3) << "," << mat4.at(2, 3) << "," << mat4.at(3, 3) << ")|";
 		return (os);
 	}
 
@@ -782,15 +756,15 @@ namespace gm {
 	 *
 	 * @param mat4 The Mat4 to print.
 	 */
-	template <typename T>
-	void	print(const Mat4<T> &mat4)
+	template <typename T, class L>
+	void	print(const Mat4<T, L> &mat4)
 	{
-		Mat4<T>	res;
+		Mat4<T, L>	res;
 
-		std::cout	<< "|" << mat4.values[ 0] << ", " << mat4.values[ 1] << ", " << mat4.values[ 2] << ", " << mat4.values[ 3] << "|\n"
-					<< "|" << mat4.values[ 4] << ", " << mat4.values[ 5] << ", " << mat4.values[ 6] << ", " << mat4.values[ 7] << "|\n"
-					<< "|" << mat4.values[ 8] << ", " << mat4.values[ 9] << ", " << mat4.values[10] << ", " << mat4.values[11] << "|\n"
-					<< "|" << mat4.values[12] << ", " << mat4.values[13] << ", " << mat4.values[14] << ", " << mat4.values[15] << "|" << std::endl;
+		std::cout	<< "|" << mat4.at(0, 0) << ", " << mat4.at(1, 0) << ", " << mat4.at(2, 0) << ", " << mat4.at(3, 0) << "|\n"
+					<< "|" << mat4.at(0, 1) << ", " << mat4.at(1, 1) << ", " << mat4.at(2, 1) << ", " << mat4.at(3, 1) << "|\n"
+					<< "|" << mat4.at(0, 2) << ", " << mat4.at(1, 2) << ", " << mat4.at(2, 2) << ", " << mat4.at(3, 2) << "|\n"
+					<< "|" << mat4.at(0, 3) << ", " << mat4.at(1, 3) << ", " << mat4.at(2, 3) << ", " << mat4.at(3, 3) << "|" << std::endl;
 	}
 
 	/**
@@ -800,10 +774,10 @@ namespace gm {
 	 *
 	 * @return Mat4 transposed.
 	 */
-	template <typename T>
-	Mat4<T>	transpose(const Mat4<T> &mat4)
+	template <typename T, class L>
+	Mat4<T, L>	transpose(const Mat4<T, L> &mat4)
 	{
-		Mat4<T>	res;
+		Mat4<T, L>	res;
 
 		res.values[ 0] = mat4.values[ 0];
 		res.values[ 1] = mat4.values[ 4];
@@ -834,10 +808,10 @@ namespace gm {
 	 *
 	 * @return Mat4 rotate by axis and angle in radians in 3D.
 	 */
-	template <typename T>
-	Mat4<T>	rotate(const Mat4<T> &mat4, const Vec3<T> &axis, T radians)
+	template <typename T, class L>
+	Mat4<T, L>	rotate(const Mat4<T, L> &mat4, const Vec3<T> &axis, T radians)
 	{
-		const Mat4<T>	matRot = Mat4<T>::rotation3D(axis, radians);
+		const Mat4<T, L>	matRot = Mat4<T, L>::rotation3D(axis, radians);
 
 		return (mat4 * matRot);
 	}
@@ -850,10 +824,10 @@ namespace gm {
 	 *
 	 * @return Mat4 translate by movement vector.
 	 */
-	template <typename T>
-	Mat4<T>	translate(const Mat4<T> &mat4, const Vec3<T> &movement)
+	template <typename T, class L>
+	Mat4<T, L>	translate(const Mat4<T, L> &mat4, const Vec3<T> &movement)
 	{
-		const Mat4<T>	matTranslate = Mat4<T>::translation(movement);
+		const Mat4<T, L>	matTranslate = Mat4<T, L>::translation(movement);
 
 		return (mat4 * matTranslate);
 	}
@@ -865,8 +839,8 @@ namespace gm {
 	 *
 	 * @return Hash of Mat4.
 	 */
-	template <typename T>
-	std::size_t	hash(const Mat4<T> &mat4)
+	template <typename T, class L>
+	std::size_t	hash(const Mat4<T, L> &mat4)
 	{
 		std::size_t	hash = 0;
 
@@ -903,6 +877,35 @@ namespace gm {
 	 * The class is design to be used with graphic library like OpenGL or Vulkan.
 	 */
 	using Mat4d = Mat4<double>;
+	/**
+	 * @brief Class for 4x4 column-major float matrix.
+	 *
+	 * values can be copied as is to a uniform buffer of OpenGL or Vulkan.
+	 */
+	using Mat4fc = Mat4<float, ColumnMajor>;
+	/**
+	 * @brief Class for 4x4 column-major double matrix.
+	 *
+	 * values can be copied as is to a uniform buffer of OpenGL or Vulkan.
+	 */
+	using Mat4dc = Mat4<double, ColumnMajor>;
+
+	//**** CHECKS **************************************************************
+
+	static_assert(std::is_trivially_copyable<Mat4u>::value && std::is_trivially_destructible<Mat4u>::value,
+					"Mat4u must be trivially copyable");
+	static_assert(std::is_trivially_copyable<Mat4i>::value && std::is_trivially_destructible<Mat4i>::value,
+					"Mat4i must be trivially copyable");
+	static_assert(std::is_trivially_copyable<Mat4f>::value && std::is_trivially_destructible<Mat4f>::value,
+					"Mat4f must be trivially copyable");
+	static_assert(std::is_trivially_copyable<Mat4d>::value && std::is_trivially_destructible<Mat4d>::value,
+					"Mat4d must be trivially copyable");
+	static_assert(std::is_trivially_copyable<Mat4fc>::value && std::is_trivially_destructible<Mat4fc>::value,
+					"Mat4fc must be trivially copyable");
+	static_assert(Mat4i::translation(Vec3i(1, 2, 3)) * Mat4i::translation(Vec3i(3, 4, 5)) == Mat4i::translation(Vec3i(4, 6, 8)),
+					"Mat4 must be constexpr");
+	static_assert(Mat4<int, ColumnMajor>::translation(Vec3i(1, 2, 3))[12] == 1 && Mat4<int, ColumnMajor>::translation(Vec3i(1, 2, 3))[14] == 3,
+					"Mat4 must store columns contiguously in ColumnMajor");
 }
 
 #endif
@@ -121,9 +121,9 @@ namespace gm {
 			this->persistence = persistence;
 
 			if (this->octaves == 0)
-				throw std::runtime_error("Octave can't be 0");
+				GM_THROW(std::runtime_error("Octave can't be 0"));
 			if (persistence < static_cast<T>(0.0) || persistence > static_cast<T>(1.0))
-				throw std::runtime_error("Persistence must be between 0.0 and 1.0");
+				GM_THROW(std::runtime_error("Persistence must be between 0.0 and 1.0"));
 
 			this->generateNoises(shape);
 		}
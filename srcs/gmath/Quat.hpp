@@ -0,0 +1,824 @@
+#ifndef GM_QUAT_HPP
+# define GM_QUAT_HPP
+
+# include <gmath/Vec3.hpp>
+# include <gmath/Vec4.hpp>
+# include <gmath/Mat3.hpp>
+# include <gmath/Mat4.hpp>
+# include <gmath/VecMat.hpp>
+# include <gmath/transform.hpp>
+# include <gmath/simd.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <type_traits>
+
+namespace gm {
+	//**** STATIC FUNCTIONS DEFINE *********************************************
+	//**** CLASS DEFINE ********************************************************
+
+	/**
+	 * @brief Class for rotation quaternion, x y z the vector part and w the
+	 * scalar part.
+	 *
+	 * @tparam T Type of value in the quaternion.
+	 *
+	 * 4 values instead of the 9 of a Mat3, composing cost 16 multiplications
+	 * instead of 27. The quaternion is aligned on 4 values up to 16 bytes, so
+	 * the float version is computed with one SSE register. Wider types keep
+	 * their natural alignment: std::allocator and new only give 16 bytes
+	 * before C++17.
+	 * Rotations go in the same direction as Mat3::rotation.
+	 */
+	template <typename T>
+	class alignas(4 * sizeof(T) <= 16 ? 4 * sizeof(T) : alignof(T)) Quat
+	{
+	public:
+		T	x;
+		T	y;
+		T	z;
+		T	w;
+
+		//**** INITIALISION ****************************************************
+		//---- Constructors ----------------------------------------------------
+
+		/**
+		 * @brief Default constructor of Quat class.
+		 *
+		 * @return The Quat with values at 0.
+		 */
+		constexpr Quat(void) : x(T()), y(T()), z(T()), w(T()) {}
+
+		/**
+		 * @brief Copy constructor of Quat class.
+		 *
+		 * @param quat The Quat to copy.
+		 *
+		 * @return The Quat copied from parameter.
+		 */
+		Quat(const Quat &quat) = default;
+
+		/**
+		 * @brief Constructor of Quat class.
+		 *
+		 * @param x x value of the Quat.
+		 * @param y y value of the Quat.
+		 * @param z z value of the Quat.
+		 * @param w w value of the Quat, the scalar part.
+		 *
+		 * @return The Quat with parameter values.
+		 */
+		constexpr Quat(T x, T y, T z, T w) : x(x), y(y), z(z), w(w) {}
+
+		/**
+		 * @brief Constructor of Quat class.
+		 *
+		 * @param vector The vector part.
+		 * @param scalar The scalar part.
+		 *
+		 * @return The Quat with parameter values.
+		 */
+		constexpr Quat(const Vec3<T> &vector, T scalar) : x(vector.x), y(vector.y), z(vector.z), w(scalar) {}
+
+		/**
+		 * @brief Constructor of Quat class from a rotation matrix.
+		 *
+		 * @param mat3 The rotation matrix, without scale, of any layout.
+		 *
+		 * @return The unit Quat of the same rotation.
+		 */
+		template <class L>
+		explicit Quat(const Mat3<T, L> &mat3)
+		{
+			const Mat3<T>	rows(mat3);
+			const T			*m = rows.values;
+			const T			trace = m[0] + m[4] + m[8];
+			const T			one = static_cast<T>(1);
+			const T			half = static_cast<T>(0.5);
+
+			// Compute first the biggest value, for precision
+			if (trace > T())
+			{
+				const T	s = half / __sqrt(trace + one);
+
+				this->w = static_cast<T>(0.25) / s;
+				this->x = (m[7] - m[5]) * s;
+				this->y = (m[2] - m[6]) * s;
+				this->z = (m[3] - m[1]) * s;
+			}
+			else if (m[0] > m[4] && m[0] > m[8])
+			{
+				const T	s = static_cast<T>(2) * __sqrt(one + m[0] - m[4] - m[8]);
+
+				this->w = (m[7] - m[5]) / s;
+				this->x = static_cast<T>(0.25) * s;
+				this->y = (m[1] + m[3]) / s;
+				this->z = (m[2] + m[6]) / s;
+			}
+			else if (m[4] > m[8])
+			{
+				const T	s = static_cast<T>(2) * __sqrt(one + m[4] - m[0] - m[8]);
+
+				this->w = (m[2] - m[6]) / s;
+				this->x = (m[1] + m[3]) / s;
+				this->y = static_cast<T>(0.25) * s;
+				this->z = (m[5] + m[7]) / s;
+			}
+			else
+			{
+				const T	s = static_cast<T>(2) * __sqrt(one + m[8] - m[0] - m[4]);
+
+				this->w = (m[3] - m[1]) / s;
+				this->x = (m[2] + m[6]) / s;
+				this->y = (m[5] + m[7]) / s;
+				this->z = static_cast<T>(0.25) * s;
+			}
+		}
+
+		//---- Destructor ------------------------------------------------------
+
+		~Quat() = default;
+
+		//**** ACCESSORS *******************************************************
+		//---- Getters ---------------------------------------------------------
+
+		/**
+		 * @brief Get the vector part.
+		 *
+		 * @return A Vec3 with x, y and z as value.
+		 */
+		constexpr Vec3<T>	xyz(void) const
+		{
+			return (Vec3<T>(this->x, this->y, this->z));
+		}
+
+		//---- Setters ---------------------------------------------------------
+		//---- Modify Operators ------------------------------------------------
+
+		Quat	&operator=(const Quat &quat) = default;
+
+		/**
+		 * @brief Compose with another rotation, applied before this one.
+		 *
+		 * @param quat The rotation to compose.
+		 *
+		 * @return Reference to the Quat, this * quat.
+		 */
+		constexpr Quat	&operator*=(const Quat &quat)
+		{
+			*this = *this * quat;
+
+			return (*this);
+		}
+
+		//---- Compare Operators -----------------------------------------------
+
+		constexpr bool	operator==(const Quat &quat) const
+		{
+			return (this->x == quat.x && this->y == quat.y && this->z == quat.z && this->w == quat.w);
+		}
+
+		constexpr bool	operator!=(const Quat &quat) const
+		{
+			return (this->x != quat.x || this->y != quat.y || this->z != quat.z || this->w != quat.w);
+		}
+
+		//---- Unary Operators -------------------------------------------------
+
+		constexpr Quat	operator-(void) const
+		{
+			return (Quat(-this->x, -this->y, -this->z, -this->w));
+		}
+
+		//**** PUBLIC METHODS **************************************************
+		//**** STATIC METHODS **************************************************
+
+		/**
+		 * @brief Create identity rotation.
+		 *
+		 * @return Identity Quat.
+		 */
+		static constexpr Quat<T>	identity(void)
+		{
+			return (Quat<T>(T(), T(), T(), static_cast<T>(1)));
+		}
+
+		/**
+		 * @brief Create rotation quaternion, same rotation as Mat3::rotation.
+		 *
+		 * @param axis Vec3 to tell on wich axis the rotation will be done. It must be normalized.
+		 * @param radians The angle in radians.
+		 *
+		 * @return Rotation quaternion of parameter.
+		 */
+		static Quat<T>	rotation(const Vec3<T> &axis, T radians)
+		{
+			T	tmpSin;
+			T	tmpCos;
+
+			__sincos(static_cast<T>(-radians / static_cast<T>(2)), tmpSin, tmpCos);
+			return (Quat<T>(axis * tmpSin, tmpCos));
+		}
+	};
+
+	//**** EXTERNS OPERATORS ***************************************************
+	//---- Quaternion quaternion operator --------------------------------------
+
+	template <typename T>
+	constexpr Quat<T>	operator+(const Quat<T> &q1, const Quat<T> &q2)
+	{
+		return (Quat<T>(q1.x + q2.x, q1.y + q2.y, q1.z + q2.z, q1.w + q2.w));
+	}
+
+	template <typename T>
+	constexpr Quat<T>	operator-(const Quat<T> &q1, const Quat<T> &q2)
+	{
+		return (Quat<T>(q1.x - q2.x, q1.y - q2.y, q1.z - q2.z, q1.w - q2.w));
+	}
+
+	/**
+	 * @brief Compose two rotations, q2 is applied first.
+	 *
+	 * @param q1 First quaternion.
+	 * @param q2 Second quaternion.
+	 *
+	 * @return Hamilton product q1 * q2.
+	 */
+	template <typename T>
+	constexpr Quat<T>	operator*(const Quat<T> &q1, const Quat<T> &q2)
+	{
+		return (Quat<T>(q1.w * q2.x + q1.x * q2.w + q1.y * q2.z - q1.z * q2.y,
+						q1.w * q2.y - q1.x * q2.z + q1.y * q2.w + q1.z * q2.x,
+						q1.w * q2.z + q1.x * q2.y - q1.y * q2.x + q1.z * q2.w,
+						q1.w * q2.w - q1.x * q2.x - q1.y * q2.y - q1.z * q2.z));
+	}
+
+	//---- Quaternion value operator -------------------------------------------
+
+	template <typename T>
+	constexpr Quat<T>	operator*(const Quat<T> &quat, const T &value)
+	{
+		return (Quat<T>(quat.x * value, quat.y * value, quat.z * value, quat.w * value));
+	}
+
+	template <typename T>
+	constexpr Quat<T>	operator*(const T &value, const Quat<T> &quat)
+	{
+		return (Quat<T>(quat.x * value, quat.y * value, quat.z * value, quat.w * value));
+	}
+
+	template <typename T>
+	constexpr Quat<T>	operator/(const Quat<T> &quat, const T &value)
+	{
+		return (Quat<T>(quat.x / value, quat.y / value, quat.z / value, quat.w / value));
+	}
+
+	//---- Quaternion vector operator ------------------------------------------
+
+	/**
+	 * @brief Rotate a Vec3, as quat * vec3 * conjugate(quat).
+	 *
+	 * Use t = 2 * cross(q.xyz, v), v + q.w * t + cross(q.xyz, t): 15
+	 * multiplications instead of the 32 of two quaternion products.
+	 *
+	 * @param quat The unit rotation quaternion.
+	 * @param vec3 The Vec3 to rotate.
+	 *
+	 * @return The rotated Vec3.
+	 */
+	template <typename T>
+	constexpr Vec3<T>	operator*(const Quat<T> &quat, const Vec3<T> &vec3)
+	{
+		const T	two = static_cast<T>(2);
+		const T	tx = two * (quat.y * vec3.z - quat.z * vec3.y);
+		const T	ty = two * (quat.z * vec3.x - quat.x * vec3.z);
+		const T	tz = two * (quat.x * vec3.y - quat.y * vec3.x);
+
+		return (Vec3<T>(vec3.x + quat.w * tx + (quat.y * tz - quat.z * ty),
+						vec3.y + quat.w * ty + (quat.z * tx - quat.x * tz),
+						vec3.z + quat.w * tz + (quat.x * ty - quat.y * tx)));
+	}
+
+	//---- Print operator ------------------------------------------------------
+
+	template <typename T>
+	std::ostream	&operator<<(std::ostream &os, const Quat<T> &quat)
+	{
+		os << "(" << quat.x << "," << quat.y << "," << quat.z << "," << quat.w << ")";
+		return (os);
+	}
+
+	//**** FUNCTIONS ***********************************************************
+
+	/**
+	 * @brief Dot product between two Quat.
+	 *
+	 * @param q1 First Quat.
+	 * @param q2 Second Quat.
+	 *
+	 * @return Dot product of q1 with q2, cosinus of half the angle between
+	 * the two rotations.
+	 */
+	template <typename T>
+	constexpr T	dot(const Quat<T> &q1, const Quat<T> &q2)
+	{
+		return (__dot(q1.x, q2.x, q1.y, q2.y, q1.z, q2.z, q1.w, q2.w));
+	}
+
+	/**
+	 * @brief Get Quat norm.
+	 *
+	 * @param quat Quat to get the norm.
+	 *
+	 * @return Norm of quat.
+	 */
+	template <typename T>
+	T	norm(const Quat<T> &quat)
+	{
+		return (__sqrt(dot(quat, quat)));
+	}
+
+	/**
+	 * @brief Get Quat norm squared.
+	 *
+	 * @param quat Quat to get the norm squared.
+	 *
+	 * @return Norm squared of quat.
+	 */
+	template <typename T>
+	constexpr T	norm2(const Quat<T> &quat)
+	{
+		return (dot(quat, quat));
+	}
+
+	/**
+	 * @brief Normalize a Quat.
+	 *
+	 * @param quat Quat to normalize.
+	 *
+	 * @return Normalised quat, or quat if it's norm is 0.
+	 */
+	template <typename T>
+	Quat<T>	normalize(const Quat<T> &quat)
+	{
+		T	dst = norm2(quat);
+
+		const T	toDiv = dst == static_cast<T>(0) ? static_cast<T>(1) : static_cast<T>(1) / __sqrt(dst);
+
+		return (quat * toDiv);
+	}
+
+	/**
+	 * @brief Get the conjugate of a Quat, the inverse rotation of an unit Quat.
+	 *
+	 * @param quat The Quat.
+	 *
+	 * @return Quat with the vector part negated.
+	 */
+	template <typename T>
+	constexpr Quat<T>	conjugate(const Quat<T> &quat)
+	{
+		return (Quat<T>(-quat.x, -quat.y, -quat.z, quat.w));
+	}
+
+	/**
+	 * @brief Inverse a Quat. Use conjugate for unit Quat.
+	 *
+	 * @param quat The Quat to inverse, its norm must not be 0.
+	 *
+	 * @return The inverse of quat.
+	 */
+	template <typename T>
+	constexpr Quat<T>	inverse(const Quat<T> &quat)
+	{
+		return (conjugate(quat) / norm2(quat));
+	}
+
+	/**
+	 * @brief Rotate a Vec3.
+	 *
+	 * @param vec3 The Vec3 to rotate.
+	 * @param quat The unit rotation quaternion.
+	 *
+	 * @return vec3 rotated by quat.
+	 */
+	template <typename T>
+	Vec3<T>	rotate(const Vec3<T> &vec3, const Quat<T> &quat)
+	{
+		return (quat * vec3);
+	}
+
+	/**
+	 * @brief Normalized linear interpolation between two rotations, by the
+	 * shortest path.
+	 *
+	 * Faster than slerp, the angular speed is not constant but the result is
+	 * close for near rotations (animation keys).
+	 *
+	 * @param start Start unit Quat.
+	 * @param end End unit Quat.
+	 * @param range Factor of the interpolation, between 0 and 1.
+	 *
+	 * @return Unit Quat between start and end.
+	 */
+	template <typename T>
+	Quat<T>	nlerp(const Quat<T> &start, const Quat<T> &end, T range)
+	{
+		const Quat<T>	target = dot(start, end) < T() ? -end : end;
+
+		return (normalize(start + (target - start) * range));
+	}
+
+	/**
+	 * @brief Spherical linear interpolation between two rotations, by the
+	 * shortest path.
+	 *
+	 * @param start Start unit Quat.
+	 * @param end End unit Quat.
+	 * @param range Factor of the interpolation, between 0 and 1.
+	 *
+	 * @return Unit Quat between start and end, at constant angular speed.
+	 */
+	template <typename T>
+	Quat<T>	slerp(const Quat<T> &start, const Quat<T> &end, T range)
+	{
+		T				cosTheta = dot(start, end);
+		const Quat<T>	target = cosTheta < T() ? -end : end;
+
+		if (cosTheta < T())
+			cosTheta = -cosTheta;
+		// sin(theta) is near 0, nlerp is exact enough
+		if (cosTheta > static_cast<T>(0.9995))
+			return (normalize(start + (target - start) * range));
+
+		const T	theta = __acos(cosTheta);
+		const T	invSin = static_cast<T>(1) / __sin(theta);
+		const T	startFactor = __sin((static_cast<T>(1) - range) * theta) * invSin;
+		const T	endFactor = __sin(range * theta) * invSin;
+
+		return (start * startFactor + target * endFactor);
+	}
+
+	/**
+	 * @brief Convert a unit Quat to a rotation matrix.
+	 *
+	 * @tparam L Layout of the matrix, RowMajor by default.
+	 * @param quat The unit Quat.
+	 *
+	 * @return The Mat3 of the same rotation.
+	 */
+	template <class L = RowMajor, typename T>
+	constexpr Mat3<T, L>	toMat3(const Quat<T> &quat)
+	{
+		const T	one = static_cast<T>(1);
+		const T	two = static_cast<T>(2);
+		const T	xx = quat.x * quat.x, yy = quat.y * quat.y, zz = quat.z * quat.z;
+		const T	xy = quat.x * quat.y, xz = quat.x * quat.z, yz = quat.y * quat.z;
+		const T	wx = quat.w * quat.x, wy = quat.w * quat.y, wz = quat.w * quat.z;
+
+		return (Mat3<T, L>(one - two * (yy + zz), two * (xy - wz), two * (xz + wy),
+						two * (xy + wz), one - two * (xx + zz), two * (yz - wx),
+						two * (xz - wy), two * (yz + wx), one - two * (xx + yy)));
+	}
+
+	/**
+	 * @brief Convert a unit Quat to a 4x4 rotation matrix.
+	 *
+	 * @tparam L Layout of the matrix, RowMajor by default.
+	 * @param quat The unit Quat.
+	 *
+	 * @return The Mat4 of the same rotation, without translation.
+	 */
+	template <class L = RowMajor, typename T>
+	constexpr Mat4<T, L>	toMat4(const Quat<T> &quat)
+	{
+		const Mat3<T>	mat3 = toMat3(quat);
+		const T			*m = mat3.values;
+
+		return (Mat4<T, L>(m[0], m[1], m[2], T(),
+						m[3], m[4], m[5], T(),
+						m[6], m[7], m[8], T(),
+						T(), T(), T(), static_cast<T>(1)));
+	}
+
+	/**
+	 * @brief Get the hash of a Quat.
+	 *
+	 * @param quat Quat to hash.
+	 *
+	 * @return Hash of Quat, same as the hash of the equivalent Vec4.
+	 */
+	template <typename T>
+	std::size_t	hash(const Quat<T> &quat)
+	{
+		return (hash(Vec4<T>(quat.x, quat.y, quat.z, quat.w)));
+	}
+
+	//---- Batch ---------------------------------------------------------------
+
+	/**
+	 * @brief Convert unit Quat to rotation matrices.
+	 *
+	 * @param src The quaternions.
+	 * @param dst The matrices.
+	 * @param count Number of quaternions.
+	 */
+	template <typename T, class L>
+	void	toMat3(const Quat<T> *src, Mat3<T, L> *dst, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; i++)
+			dst[i] = toMat3<L>(src[i]);
+	}
+
+	/**
+	 * @brief Convert unit Quat to 4x4 rotation matrices.
+	 *
+	 * @param src The quaternions.
+	 * @param dst The matrices.
+	 * @param count Number of quaternions.
+	 */
+	template <typename T, class L>
+	void	toMat4(const Quat<T> *src, Mat4<T, L> *dst, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; i++)
+			dst[i] = toMat4<L>(src[i]);
+	}
+
+	/**
+	 * @brief Normalized linear interpolation of arrays of rotations, with the
+	 * same factor (animation tracks sampled at one time).
+	 *
+	 * @param start Start unit quaternions.
+	 * @param end End unit quaternions.
+	 * @param range Factor of the interpolation, between 0 and 1.
+	 * @param res Result quaternions, can be start or end.
+	 * @param count Number of quaternions.
+	 */
+	template <typename T>
+	void	nlerp(const Quat<T> *start, const Quat<T> *end, T range, Quat<T> *res, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; i++)
+			res[i] = nlerp(start[i], end[i], range);
+	}
+
+	/**
+	 * @brief Spherical linear interpolation of arrays of rotations, with the
+	 * same factor (animation tracks sampled at one time).
+	 *
+	 * @param start Start unit quaternions.
+	 * @param end End unit quaternions.
+	 * @param range Factor of the interpolation, between 0 and 1.
+	 * @param res Result quaternions, can be start or end.
+	 * @param count Number of quaternions.
+	 */
+	template <typename T>
+	void	slerp(const Quat<T> *start, const Quat<T> *end, T range, Quat<T> *res, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; i++)
+			res[i] = slerp(start[i], end[i], range);
+	}
+
+	/**
+	 * @brief Rotate an array of Vec3 by the same rotation.
+	 *
+	 * @param quat The unit rotation quaternion.
+	 * @param src The vectors to rotate.
+	 * @param dst The rotated vectors, can be src.
+	 * @param count Number of vectors.
+	 */
+	template <typename T>
+	void	rotate(const Quat<T> &quat, const Vec3<T> *src, Vec3<T> *dst, std::size_t count)
+	{
+		const Mat3<T>	mat3 = toMat3(quat);
+
+		for (std::size_t i = 0; i < count; i++)
+			dst[i] = mat3 * src[i];
+	}
+
+	//**** SIMD SPECIALIZATION ************************************************
+# ifdef GM_SSE2
+
+	/**
+	 * @brief Internal function for Quat. Load the Quat in a register.
+	 *
+	 * @param quat The Quat to load.
+	 *
+	 * @return Register with x, y, z and w.
+	 */
+	inline __m128	__simd(const Quat<float> &quat)
+	{
+		return (_mm_load_ps(&quat.x));
+	}
+
+	/**
+	 * @brief Internal function for Quat. Store a register in a Quat.
+	 *
+	 * @param simd Register with x, y, z and w.
+	 *
+	 * @return The Quat with register values.
+	 */
+	inline Quat<float>	__quat(__m128 simd)
+	{
+		Quat<float>	res;
+
+		_mm_store_ps(&res.x, simd);
+
+		return (res);
+	}
+
+	/**
+	 * @brief Internal function for Quat. Weighted sum of two registers.
+	 *
+	 * @return Register a * wa + b * wb.
+	 */
+	inline __m128	__quatBlend(__m128 a, float wa, __m128 b, float wb)
+	{
+		return (_mm_add_ps(_mm_mul_ps(a, _mm_set1_ps(wa)), _mm_mul_ps(b, _mm_set1_ps(wb))));
+	}
+
+	/**
+	 * @brief Internal function for Quat. Normalize a register.
+	 *
+	 * @return Register normalized, or simd if it's norm is 0.
+	 */
+	inline __m128	__normalizeQuat(__m128 simd)
+	{
+		const __m128	dst = __dot4(simd, simd);
+
+		if (_mm_cvtss_f32(dst) == 0.0f)
+			return (simd);
+		return (_mm_div_ps(simd, _mm_sqrt_ps(dst)));
+	}
+
+	//---- Quaternion quaternion operator --------------------------------------
+
+	inline Quat<float>	operator+(const Quat<float> &q1, const Quat<float> &q2)
+	{
+		return (__quat(_mm_add_ps(__simd(q1), __simd(q2))));
+	}
+
+	inline Quat<float>	operator-(const Quat<float> &q1, const Quat<float> &q2)
+	{
+		return (__quat(_mm_sub_ps(__simd(q1), __simd(q2))));
+	}
+
+	inline Quat<float>	operator*(const Quat<float> &q1, const Quat<float> &q2)
+	{
+		const __m128	a = __simd(q1);
+		const __m128	b = __simd(q2);
+		// Each lane of a multiply q2 with its values swapped and signed
+		const __m128	bW = _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 1, 2, 3));
+		const __m128	bZ = _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2));
+		const __m128	bY = _mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 3, 0, 1));
+		__m128			res = _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 3, 3)), b);
+
+		res = _mm_add_ps(res, _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 0, 0)),
+								_mm_xor_ps(bW, _mm_set_ps(-0.0f, 0.0f, -0.0f, 0.0f))));
+		res = _mm_add_ps(res, _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 1, 1, 1)),
+								_mm_xor_ps(bZ, _mm_set_ps(-0.0f, -0.0f, 0.0f, 0.0f))));
+		res = _mm_add_ps(res, _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 2, 2)),
+								_mm_xor_ps(bY, _mm_set_ps(-0.0f, 0.0f, 0.0f, -0.0f))));
+		return (__quat(res));
+	}
+
+	//---- Quaternion value operator -------------------------------------------
+
+	inline Quat<float>	operator*(const Quat<float> &quat, const float &value)
+	{
+		return (__quat(_mm_mul_ps(__simd(quat), _mm_set1_ps(value))));
+	}
+
+	inline Quat<float>	operator*(const float &value, const Quat<float> &quat)
+	{
+		return (__quat(_mm_mul_ps(__simd(quat), _mm_set1_ps(value))));
+	}
+
+	inline Quat<float>	operator/(const Quat<float> &quat, const float &value)
+	{
+		return (__quat(_mm_div_ps(__simd(quat), _mm_set1_ps(value))));
+	}
+
+	//---- Functions -----------------------------------------------------------
+
+	/**
+	 * @brief Dot product between two Quat.
+	 *
+	 * @param q1 First Quat.
+	 * @param q2 Second Quat.
+	 *
+	 * @return Dot product of q1 with q2.
+	 */
+	inline float	dot(const Quat<float> &q1, const Quat<float> &q2)
+	{
+#  if defined(GM_USE_FMA) && defined(GM_FMA)
+		return (_mm_cvtss_f32(__fusedDot4(__simd(q1), __simd(q2))));
+#  else
+		return (_mm_cvtss_f32(__dot4(__simd(q1), __simd(q2))));
+#  endif
+	}
+
+	/**
+	 * @brief Normalize a Quat.
+	 *
+	 * @param quat Quat to normalize.
+	 *
+	 * @return Normalised quat, or quat if it's norm is 0.
+	 */
+	inline Quat<float>	normalize(const Quat<float> &quat)
+	{
+		return (__quat(__normalizeQuat(__simd(quat))));
+	}
+
+	/**
+	 * @brief Normalized linear interpolation between two rotations, by the
+	 * shortest path.
+	 *
+	 * @param start Start unit Quat.
+	 * @param end End unit Quat.
+	 * @param range Factor of the interpolation, between 0 and 1.
+	 *
+	 * @return Unit Quat between start and end.
+	 */
+	inline Quat<float>	nlerp(const Quat<float> &start, const Quat<float> &end, float range)
+	{
+		const __m128	a = __simd(start);
+		const __m128	b = __simd(end);
+		const float		sign = _mm_cvtss_f32(__dot4(a, b)) < 0.0f ? -1.0f : 1.0f;
+
+		return (__quat(__normalizeQuat(__quatBlend(a, 1.0f - range, b, sign * range))));
+	}
+
+	/**
+	 * @brief Spherical linear interpolation between two rotations, by the
+	 * shortest path.
+	 *
+	 * Trigonometry is done once, in the precision of MathPrecision<float>,
+	 * the 4 values are weighted in one register.
+	 *
+	 * @param start Start unit Quat.
+	 * @param end End unit Quat.
+	 * @param range Factor of the interpolation, between 0 and 1.
+	 *
+	 * @return Unit Quat between start and end, at constant angular speed.
+	 */
+	inline Quat<float>	slerp(const Quat<float> &start, const Quat<float> &end, float range)
+	{
+		const __m128	a = __simd(start);
+		const __m128	b = __simd(end);
+		const float		cosDot = _mm_cvtss_f32(__dot4(a, b));
+		const float		sign = cosDot < 0.0f ? -1.0f : 1.0f;
+		const float		cosTheta = cosDot * sign;
+
+		// sin(theta) is near 0, nlerp is exact enough
+		if (cosTheta > 0.9995f)
+			return (__quat(__normalizeQuat(__quatBlend(a, 1.0f - range, b, sign * range))));
+
+		const float		theta = __acos(cosTheta);
+		const float		invSin = 1.0f / __sin(theta);
+
+		return (__quat(__quatBlend(a, __sin((1.0f - range) * theta) * invSin,
+								b, sign * __sin(range * theta) * invSin)));
+	}
+
+	/**
+	 * @brief Rotate an array of Vec3 by the same rotation, with the batch
+	 * kernels.
+	 *
+	 * @param quat The unit rotation quaternion.
+	 * @param src The vectors to rotate.
+	 * @param dst The rotated vectors, can be src.
+	 * @param count Number of vectors.
+	 */
+	inline void	rotate(const Quat<float> &quat, const Vec3<float> *src, Vec3<float> *dst, std::size_t count)
+	{
+		transformVectors(toMat4(quat), src, dst, count);
+	}
+
+# endif
+
+	//**** STATIC FUNCTIONS ****************************************************
+	//**** USINGS **************************************************************
+
+	/**
+	 * @brief Class for float rotation quaternion, computed with SSE.
+	 */
+	using Quatf = Quat<float>;
+	/**
+	 * @brief Class for double rotation quaternion.
+	 */
+	using Quatd = Quat<double>;
+
+	//**** CHECKS **************************************************************
+
+	static_assert(std::is_trivially_copyable<Quatf>::value && std::is_trivially_destructible<Quatf>::value,
+					"Quatf must be trivially copyable");
+	static_assert(std::is_trivially_copyable<Quatd>::value && std::is_trivially_destructible<Quatd>::value,
+					"Quatd must be trivially copyable");
+	static_assert(sizeof(Quatf) == 16, "Quatf must be 4 floats");
+	static_assert(alignof(Quatf) == 16 && alignof(Quatd) <= 16, "Quat must fit the alignment of std::allocator");
+	static_assert(Quat<int>(0, 0, 1, 0) * Quat<int>(0, 0, 1, 0) == Quat<int>(0, 0, 0, -1),
+					"Quat must be constexpr");
+}
+
+#endif
@@ -0,0 +1,569 @@
+#ifndef GM_SOA_BUFFER_HPP
+# define GM_SOA_BUFFER_HPP
+
+# include <gmath/dispatch.hpp>
+# include <gmath/memory.hpp>
+# include <gmath/precision.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+namespace gm {
+	//**** STATIC FUNCTIONS DEFINE *********************************************
+
+	//**** CLASS DEFINE ********************************************************
+
+	/**
+	 * @brief Storage of N components arrays for structure of arrays vectors.
+	 *
+	 * @tparam T Type of value in the vectors.
+	 * @tparam N Number of components of the vectors.
+	 *
+	 * All components live in one allocation, each component array starts on
+	 * GM_SIMD_ALIGNMENT bytes. Base class of Vec2SoA, Vec3SoA and Vec4SoA.
+	 */
+	template <typename T, unsigned int N>
+	class SoABuffer
+	{
+		static_assert(std::is_arithmetic<T>::value, "SoABuffer need an arithmetic type");
+	public:
+		//**** INITIALISION ****************************************************
+		//---- Constructors ----------------------------------------------------
+
+		/**
+		 * @brief Default constructor of SoABuffer class.
+		 *
+		 * @return The SoABuffer without vectors.
+		 */
+		SoABuffer(void)
+		{
+			this->data = nullptr;
+			this->count = 0;
+			this->cap = 0;
+		}
+
+		/**
+		 * @brief Constructor of SoABuffer class.
+		 *
+		 * @param size Number of vectors.
+		 *
+		 * @return The SoABuffer with size vectors at 0.
+		 */
+		explicit SoABuffer(std::size_t size)
+		{
+			this->data = nullptr;
+			this->count = 0;
+			this->cap = 0;
+			this->resize(size);
+		}
+
+		/**
+		 * @brief Copy constructor of SoABuffer class.
+		 *
+		 * @param obj The SoABuffer to copy.
+		 *
+		 * @return The SoABuffer copied from parameter.
+		 */
+		SoABuffer(const SoABuffer &obj)
+		{
+			this->data = nullptr;
+			this->count = 0;
+			this->cap = 0;
+			*this = obj;
+		}
+
+		/**
+		 * @brief Move constructor of SoABuffer class.
+		 *
+		 * @param obj The SoABuffer to move, left empty.
+		 *
+		 * @return The SoABuffer with the arrays of parameter.
+		 */
+		SoABuffer(SoABuffer &&obj) noexcept
+		{
+			this->data = obj.data;
+			this->count = obj.count;
+			this->cap = obj.cap;
+			obj.data = nullptr;
+			obj.count = 0;
+			obj.cap = 0;
+		}
+
+		//---- Destructor ------------------------------------------------------
+
+		/**
+		 * @brief Destructor of SoABuffer class.
+		 */
+		~SoABuffer()
+		{
+			alignedFree(this->data);
+		}
+
+		//**** ACCESSORS *******************************************************
+		//---- Getters ---------------------------------------------------------
+
+		/**
+		 * @brief Get the number of vectors.
+		 *
+		 * @return The number of vectors.
+		 */
+		std::size_t	size(void) const
+		{
+			return (this->count);
+		}
+
+		/**
+		 * @brief Get the number of vectors that fit without reallocation.
+		 *
+		 * @return The capacity.
+		 */
+		std::size_t	capacity(void) const
+		{
+			return (this->cap);
+		}
+
+		/**
+		 * @brief Check if there is no vectors.
+		 *
+		 * @return True if size is 0, false otherwise.
+		 */
+		bool	empty(void) const
+		{
+			return (this->count == 0);
+		}
+
+		/**
+		 * @brief Get the array of one component.
+		 *
+		 * @param i Index of the component (0 for x, 1 for y...).
+		 *
+		 * @return Pointer to size values, aligned on GM_SIMD_ALIGNMENT.
+		 *
+		 * @warning Checked only if GM_BOUNDS_CHECK is 1, abort when i >= N.
+		 */
+		T	*component(unsigned int i) noexcept
+		{
+			GM_ASSERT_BOUNDS(i < N, "Index out of soa components");
+			return (this->data + i * this->cap);
+		}
+
+		/**
+		 * @brief Get the array of one component.
+		 *
+		 * @param i Index of the component (0 for x, 1 for y...).
+		 *
+		 * @return Pointer to size values, aligned on GM_SIMD_ALIGNMENT.
+		 *
+		 * @warning Checked only if GM_BOUNDS_CHECK is 1, abort when i >= N.
+		 */
+		const T	*component(unsigned int i) const noexcept
+		{
+			GM_ASSERT_BOUNDS(i < N, "Index out of soa components");
+			return (this->data + i * this->cap);
+		}
+
+		//**** OPERATORS *******************************************************
+		//---- Copy operator ---------------------------------------------------
+
+		/**
+		 * @brief Copy operator of SoABuffer class.
+		 *
+		 * @param obj The SoABuffer to copy.
+		 *
+		 * @return The SoABuffer copied from parameter.
+		 */
+		SoABuffer	&operator=(const SoABuffer &obj)
+		{
+			if (this == &obj)
+				return (*this);
+
+			this->count = 0;
+			this->reserve(obj.count);
+			for (unsigned int c = 0; c < N; c++)
+			{
+				if (obj.count > 0)
+					std::memcpy(this->data + c * this->cap, obj.data + c * obj.cap,
+								obj.count * sizeof(T));
+			}
+			this->count = obj.count;
+			return (*this);
+		}
+
+		/**
+		 * @brief Move operator of SoABuffer class.
+		 *
+		 * @param obj The SoABuffer to move, left empty.
+		 *
+		 * @return The SoABuffer with the arrays of parameter.
+		 */
+		SoABuffer	&operator=(SoABuffer &&obj) noexcept
+		{
+			if (this == &obj)
+				return (*this);
+
+			alignedFree(this->data);
+			this->data = obj.data;
+			this->count = obj.count;
+			this->cap = obj.cap;
+			obj.data = nullptr;
+			obj.count = 0;
+			obj.cap = 0;
+			return (*this);
+		}
+
+		//**** PUBLIC METHODS **************************************************
+
+		/**
+		 * @brief Allocate arrays for at least size vectors.
+		 *
+		 * @param size Number of vectors wanted.
+		 */
+		void	reserve(std::size_t size)
+		{
+			if (size <= this->cap)
+				return ;
+
+			// Keep every component array aligned
+			const std::size_t	block = GM_SIMD_ALIGNMENT / sizeof(T) > 0
+										? GM_SIMD_ALIGNMENT / sizeof(T) : 1;
+			const std::size_t	newCap = (size + block - 1) / block * block;
+			T	*newData = static_cast<T *>(alignedAlloc(N * newCap * sizeof(T)));
+
+			for (unsigned int c = 0; c < N; c++)
+			{
+				if (this->count > 0)
+					std::memcpy(newData + c * newCap, this->data + c * this->cap,
+								this->count * sizeof(T));
+			}
+			alignedFree(this->data);
+			this->data = newData;
+			this->cap = newCap;
+		}
+
+		/**
+		 * @brief Change the number of vectors.
+		 *
+		 * @param size New number of vectors, new ones are set to 0.
+		 */
+		void	resize(std::size_t size)
+		{
+			this->reserve(size);
+			for (unsigned int c = 0; c < N; c++)
+			{
+				for (std::size_t i = this->count; i < size; i++)
+					this->data[c * this->cap + i] = T();
+			}
+			this->count = size;
+		}
+
+		/**
+		 * @brief Remove all vectors, capacity is kept.
+		 */
+		void	clear(void)
+		{
+			this->count = 0;
+		}
+
+	protected:
+		T			*data;
+		std::size_t	count;
+		std::size_t	cap;
+
+		/**
+		 * @brief Add one vector at the end, growing capacity if needed.
+		 *
+		 * @return Index of the new vector.
+		 */
+		std::size_t	grow(void)
+		{
+			if (this->count == this->cap)
+				this->reserve(this->cap == 0 ? 1 : this->cap * 2);
+			return (this->count++);
+		}
+	};
+
+	//**** STATIC FUNCTIONS ****************************************************
+
+	template <typename T>
+	void	__soaAdd(const T *a, const T *b, T *res, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; i++)
+			res[i] = a[i] + b[i];
+	}
+
+	inline void	__soaAdd(const float *a, const float *b, float *res, std::size_t count)
+	{
+		kernels().add(a, b, res, count);
+	}
+
+	template <typename T>
+	void	__soaSub(const T *a, const T *b, T *res, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; i++)
+			res[i] = a[i] - b[i];
+	}
+
+	inline void	__soaSub(const float *a, const float *b, float *res, std::size_t count)
+	{
+		kernels().sub(a, b, res, count);
+	}
+
+	template <typename T>
+	void	__soaScale(const T *a, T value, T *res, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; i++)
+			res[i] = a[i] * value;
+	}
+
+	inline void	__soaScale(const float *a, float value, float *res, std::size_t count)
+	{
+		kernels().scale(a, value, res, count);
+	}
+
+	template <typename T, unsigned int N>
+	void	__soaComponents(const SoABuffer<T, N> &soa, const T *res[N])
+	{
+		for (unsigned int c = 0; c < N; c++)
+			res[c] = soa.component(c);
+	}
+
+	template <typename T, unsigned int N>
+	void	__soaComponents(SoABuffer<T, N> &soa, T *res[N])
+	{
+		for (unsigned int c = 0; c < N; c++)
+			res[c] = soa.component(c);
+	}
+
+	template <typename T, unsigned int N>
+	void	__soaCheckSize(const SoABuffer<T, N> &a, const SoABuffer<T, N> &b)
+	{
+		if (a.size() != b.size())
+			GM_THROW(std::runtime_error("Soa vectors have different sizes"));
+	}
+
+	//**** FUNCTIONS ***********************************************************
+
+	/**
+	 * @brief Add vectors of two SoA, with simd kernels for float.
+	 *
+	 * @param a First vectors.
+	 * @param b Second vectors.
+	 * @param res Result vectors, resized to a size. Can be a or b.
+	 *
+	 * @exception Throw an exception if a and b have different sizes.
+	 */
+	template <typename T, unsigned int N>
+	void	add(const SoABuffer<T, N> &a, const SoABuffer<T, N> &b, SoABuffer<T, N> &res)
+	{
+		__soaCheckSize(a, b);
+		res.resize(a.size());
+		for (unsigned int c = 0; c < N; c++)
+			__soaAdd(a.component(c), b.component(c), res.component(c), a.size());
+	}
+
+	/**
+	 * @brief Subtract vectors of two SoA, with simd kernels for float.
+	 *
+	 * @param a First vectors.
+	 * @param b Second vectors, subtracted to a.
+	 * @param res Result vectors, resized to a size. Can be a or b.
+	 *
+	 * @exception Throw an exception if a and b have different sizes.
+	 */
+	template <typename T, unsigned int N>
+	void	sub(const SoABuffer<T, N> &a, const SoABuffer<T, N> &b, SoABuffer<T, N> &res)
+	{
+		__soaCheckSize(a, b);
+		res.resize(a.size());
+		for (unsigned int c = 0; c < N; c++)
+			__soaSub(a.component(c), b.component(c), res.component(c), a.size());
+	}
+
+	/**
+	 * @brief Multiply vectors of a SoA by a value, with simd kernels for
+	 * float.
+	 *
+	 * @param a The vectors.
+	 * @param value The value to multiply.
+	 * @param res Result vectors, resized to a size. Can be a.
+	 */
+	template <typename T, unsigned int N>
+	void	scale(const SoABuffer<T, N> &a, T value, SoABuffer<T, N> &res)
+	{
+		res.resize(a.size());
+		for (unsigned int c = 0; c < N; c++)
+			__soaScale(a.component(c), value, res.component(c), a.size());
+	}
+
+	/**
+	 * @brief Dot product of vectors of two SoA, with simd kernels for float.
+	 *
+	 * @param a First vectors.
+	 * @param b Second vectors.
+	 * @param res Array of a size values for the results.
+	 *
+	 * @exception Throw an exception if a and b have different sizes.
+	 */
+	template <typename T, unsigned int N>
+	void	dot(const SoABuffer<T, N> &a, const SoABuffer<T, N> &b, T *res)
+	{
+		__soaCheckSize(a, b);
+
+		const T	*ca[N];
+		const T	*cb[N];
+
+		__soaComponents(a, ca);
+		__soaComponents(b, cb);
+		for (std::size_t i = 0; i < a.size(); i++)
+		{
+			T	sum = ca[0][i] * cb[0][i];
+
+			for (unsigned int c = 1; c < N; c++)
+				sum += ca[c][i] * cb[c][i];
+			res[i] = sum;
+		}
+	}
+
+	template <unsigned int N>
+	void	dot(const SoABuffer<float, N> &a, const SoABuffer<float, N> &b, float *res)
+	{
+		__soaCheckSize(a, b);
+
+		const float	*ca[N];
+		const float	*cb[N];
+
+		__soaComponents(a, ca);
+		__soaComponents(b, cb);
+		kernels().dot(ca, cb, N, res, a.size());
+	}
+
+	/**
+	 * @brief Norm of vectors of a SoA, with simd kernels for float.
+	 *
+	 * @param a The vectors.
+	 * @param res Array of a size values for the results.
+	 */
+	template <typename T, unsigned int N>
+	void	norm(const SoABuffer<T, N> &a, T *res)
+	{
+		const T	*ca[N];
+
+		__soaComponents(a, ca);
+		for (std::size_t i = 0; i < a.size(); i++)
+		{
+			T	dst = ca[0][i] * ca[0][i];
+
+			for (unsigned int c = 1; c < N; c++)
+				dst += ca[c][i] * ca[c][i];
+			res[i] = __sqrt(dst);
+		}
+	}
+
+	template <unsigned int N>
+	void	norm(const SoABuffer<float, N> &a, float *res)
+	{
+		const float	*ca[N];
+
+		__soaComponents(a, ca);
+		kernels().norm(ca, N, res, a.size());
+	}
+
+	/**
+	 * @brief Normalize vectors of a SoA, with simd kernels for float.
+	 *
+	 * @param a The vectors.
+	 * @param res Normalized vectors, resized to a size. Can be a. Vectors of
+	 * norm 0 are kept as is.
+	 */
+	template <typename T, unsigned int N>
+	void	normalize(const SoABuffer<T, N> &a, SoABuffer<T, N> &res)
+	{
+		res.resize(a.size());
+
+		const T	*ca[N];
+		T		*cr[N];
+
+		__soaComponents(a, ca);
+		__soaComponents(res, cr);
+		for (std::size_t i = 0; i < a.size(); i++)
+		{
+			T	dst = ca[0][i] * ca[0][i];
+
+			for (unsigned int c = 1; c < N; c++)
+				dst += ca[c][i] * ca[c][i];
+
+			T	toDiv = static_cast<T>(1);
+			if (dst != static_cast<T>(0))
+				toDiv = static_cast<T>(1) / __sqrt(dst);
+			for (unsigned int c = 0; c < N; c++)
+				cr[c][i] = ca[c][i] * toDiv;
+		}
+	}
+
+	template <unsigned int N>
+	void	normalize(const SoABuffer<float, N> &a, SoABuffer<float, N> &res)
+	{
+		res.resize(a.size());
+
+		const float	*ca[N];
+		float		*cr[N];
+
+		__soaComponents(a, ca);
+		__soaComponents(res, cr);
+		kernels().normalize(ca, N, cr, a.size());
+	}
+
+	/**
+	 * @brief Cross product of vectors of two SoA, with simd kernels for float.
+	 *
+	 * @param a First vectors.
+	 * @param b Second vectors.
+	 * @param res Result vectors, resized to a size. Can be a or b.
+	 *
+	 * @exception Throw an exception if a and b have different sizes.
+	 */
+	template <typename T>
+	void	cross(const SoABuffer<T, 3> &a, const SoABuffer<T, 3> &b, SoABuffer<T, 3> &res)
+	{
+		__soaCheckSize(a, b);
+		res.resize(a.size());
+
+		const T	*ca[3];
+		const T	*cb[3];
+		T		*cr[3];
+
+		__soaComponents(a, ca);
+		__soaComponents(b, cb);
+		__soaComponents(res, cr);
+		for (std::size_t i = 0; i < a.size(); i++)
+		{
+			const T	x = ca[1][i] * cb[2][i] - ca[2][i] * cb[1][i];
+			const T	y = ca[2][i] * cb[0][i] - ca[0][i] * cb[2][i];
+			const T	z = ca[0][i] * cb[1][i] - ca[1][i] * cb[0][i];
+
+			cr[0][i] = x;
+			cr[1][i] = y;
+			cr[2][i] = z;
+		}
+	}
+
+	inline void	cross(const SoABuffer<float, 3> &a, const SoABuffer<float, 3> &b, SoABuffer<float, 3> &res)
+	{
+		__soaCheckSize(a, b);
+		res.resize(a.size());
+
+		const float	*ca[3];
+		const float	*cb[3];
+		float		*cr[3];
+
+		__soaComponents(a, ca);
+		__soaComponents(b, cb);
+		__soaComponents(res, cr);
+		kernels().cross(ca, cb, cr, a.size());
+	}
+}
+
+#endif
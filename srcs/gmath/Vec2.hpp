@@ -1,10 +1,14 @@
 #ifndef GM_VEC2_HPP
 # define GM_VEC2_HPP
 
+# include <gmath/config.hpp>
+# include <gmath/fma.hpp>
+# include <gmath/precision.hpp>
 # include <gmath/random.hpp>
 
 # include <cmath>
 # include <iostream>
+# include <limits>
 # include <stdexcept>
 
 namespace gm {
@@ -33,11 +37,7 @@ namespace gm {
 		 *
 		 * @return The Vec2 with values at 0.
 		 */
-		Vec2(void)
-		{
-			this->x = T();
-			this->y = T();
-		}
+		constexpr Vec2(void) : x(T()), y(T()) {}
 
 		/**
 		 * @brief Copy constructor of Vec2 class.
@@ -46,11 +46,7 @@ namespace gm {
 		 *
 		 * @return The Vec2 copied from parameter.
 		 */
-		Vec2(const Vec2 &vec2)
-		{
-			this->x = vec2.x;
-			this->y = vec2.y;
-		}
+		Vec2(const Vec2 &vec2) = default;
 
 		/**
 		 * @brief Constructor of Vec2 class.
@@ -60,11 +56,7 @@ namespace gm {
 		 *
 		 * @return The Vec2 with parameter values.
 		 */
-		Vec2(T x, T y)
-		{
-			this->x = x;
-			this->y = y;
-		}
+		constexpr Vec2(T x, T y) : x(x), y(y) {}
 
 		/**
 		 * @brief Constructor of Vec2 class.
@@ -73,35 +65,20 @@ namespace gm {
 		 *
 		 * @return The Vec2 with parameter value.
 		 */
-		Vec2(T value)
-		{
-			this->x = value;
-			this->y = value;
-		}
+		constexpr Vec2(T value) : x(value), y(value) {}
 
 		//---- Destructor ------------------------------------------------------
 
-		~Vec2()
-		{
-		}
+		~Vec2() = default;
 
 		//**** ACCESSORS *******************************************************
 		//---- Getters ---------------------------------------------------------
 		//---- Setters ---------------------------------------------------------
 		//---- Modify Operators ------------------------------------------------
 
-		Vec2	&operator=(const Vec2 &vec2)
-		{
-			if (this == &vec2)
-				return (*this);
-
-			this->x = vec2.x;
-			this->y = vec2.y;
-
-			return (*this);
-		}
+		Vec2	&operator=(const Vec2 &vec2) = default;
 
-		Vec2	&operator+=(const Vec2 &vec2)
+		constexpr Vec2	&operator+=(const Vec2 &vec2)
 		{
 			this->x += vec2.x;
 			this->y += vec2.y;
@@ -109,7 +86,7 @@ namespace gm {
 			return (*this);
 		}
 
-		Vec2	&operator-=(const Vec2 &vec2)
+		constexpr Vec2	&operator-=(const Vec2 &vec2)
 		{
 			this->x -= vec2.x;
 			this->y -= vec2.y;
@@ -117,7 +94,7 @@ namespace gm {
 			return (*this);
 		}
 
-		Vec2	&operator*=(const T &value)
+		constexpr Vec2	&operator*=(const T &value)
 		{
 			this->x *= value;
 			this->y *= value;
@@ -125,7 +102,7 @@ namespace gm {
 			return (*this);
 		}
 
-		Vec2	&operator/=(const T &value)
+		constexpr Vec2	&operator/=(const T &value)
 		{
 			this->x /= value;
 			this->y /= value;
@@ -135,19 +112,19 @@ namespace gm {
 
 		//---- Compare Operators -----------------------------------------------
 
-		bool	operator==(const Vec2 &vec2) const
+		constexpr bool	operator==(const Vec2 &vec2) const
 		{
 			return (this->x == vec2.x && this->y == vec2.y);
 		}
 
-		bool	operator!=(const Vec2 &vec2) const
+		constexpr bool	operator!=(const Vec2 &vec2) const
 		{
 			return (this->x != vec2.x || this->y != vec2.y);
 		}
 
 		//---- Unary Operators -------------------------------------------------
 
-		Vec2	operator-(void) const
+		constexpr Vec2	operator-(void) const
 		{
 			return (Vec2(-this->x, -this->y));
 		}
@@ -159,21 +136,17 @@ namespace gm {
 		 *
 		 * Index 0 is for x.
 		 * Index 1 is for y.
-		 * Other index will return an exception.
 		 *
 		 * @param n Index of the value wanted.
 		 *
 		 * @return The reference to value at the index.
-		 * @exception Throw runtime_error when index is greater than 1.
+		 * @warning Checked only if GM_BOUNDS_CHECK is 1, abort when index is greater than 1.
 		 */
-		T	&operator[](unsigned int n)
+		constexpr T	&operator[](unsigned int n) noexcept
 		{
-			if (n == 0)
-				return (this->x);
-			if (n == 1)
-				return (this->y);
+			GM_ASSERT_BOUNDS(n < 2, "Index out of vec2 bounds");
 
-			throw std::runtime_error("Index out of vec2 bounds");
+			return (n == 0 ? this->x : this->y);
 		}
 
 		/**
@@ -181,21 +154,17 @@ namespace gm {
 		 *
 		 * Index 0 is for x.
 		 * Index 1 is for y.
-		 * Other index will return an exception.
 		 *
 		 * @param n Index of the value wanted.
 		 *
 		 * @return The const reference to value at the index.
-		 * @exception Throw runtime_error when index is greater than 1.
+		 * @warning Checked only if GM_BOUNDS_CHECK is 1, abort when index is greater than 1.
 		 */
-		const T	&operator[](unsigned int n) const
+		constexpr const T	&operator[](unsigned int n) const noexcept
 		{
-			if (n == 0)
-				return (this->x);
-			if (n == 1)
-				return (this->y);
+			GM_ASSERT_BOUNDS(n < 2, "Index out of vec2 bounds");
 
-			throw std::runtime_error("Index out of vec2 bounds");
+			return (n == 0 ? this->x : this->y);
 		}
 
 		//**** PUBLIC METHODS **************************************************
@@ -222,13 +191,13 @@ namespace gm {
 	//---- Vector vector operator ----------------------------------------------
 
 	template <typename T>
-	Vec2<T>	operator+(const Vec2<T> &v1, const Vec2<T> &v2)
+	constexpr Vec2<T>	operator+(const Vec2<T> &v1, const Vec2<T> &v2)
 	{
 		return (Vec2<T>(v1.x + v2.x, v1.y + v2.y));
 	}
 
 	template <typename T>
-	Vec2<T>	operator-(const Vec2<T> &v1, const Vec2<T> &v2)
+	constexpr Vec2<T>	operator-(const Vec2<T> &v1, const Vec2<T> &v2)
 	{
 		return (Vec2<T>(v1.x - v2.x, v1.y - v2.y));
 	}
@@ -236,19 +205,19 @@ namespace gm {
 	//---- Vector value operator -----------------------------------------------
 
 	template <typename T>
-	Vec2<T>	operator*(const Vec2<T> &vec2, const T &value)
+	constexpr Vec2<T>	operator*(const Vec2<T> &vec2, const T &value)
 	{
 		return (Vec2<T>(vec2.x * value, vec2.y * value));
 	}
 
 	template <typename T>
-	Vec2<T>	operator*(const T &value, const Vec2<T> &vec2)
+	constexpr Vec2<T>	operator*(const T &value, const Vec2<T> &vec2)
 	{
 		return (Vec2<T>(vec2.x * value, vec2.y * value));
 	}
 
 	template <typename T>
-	Vec2<T>	operator/(const Vec2<T> &vec2, const T &value)
+	constexpr Vec2<T>	operator/(const Vec2<T> &vec2, const T &value)
 	{
 		return (Vec2<T>(vec2.x / value, vec2.y / value));
 	}
@@ -274,8 +243,8 @@ namespace gm {
 	template <typename T>
 	T	norm(const Vec2<T> &vec2)
 	{
-		return (static_cast<T>(sqrt(static_cast<double>(vec2.x * vec2.x
-														+ vec2.y * vec2.y))));
+		return (__sqrt(vec2.x * vec2.x
+						+ vec2.y * vec2.y));
 	}
 
 	/**
@@ -303,13 +272,47 @@ namespace gm {
 	{
 		T	dst = norm2(vec2);
 
-		if (dst == static_cast<T>(0) || dst == static_cast<T>(1))
-			return (vec2);
+		// A select, not an early return, so loops over vectors can vectorize
+		const T	toDiv = dst == static_cast<T>(0) ? static_cast<T>(1) : static_cast<T>(1) / __sqrt(dst);
 
-		T	toDiv = static_cast<T>(1) / static_cast<T>(sqrt(static_cast<double>(dst)));
 		return (vec2 * toDiv);
 	}
 
+	/**
+	 * @brief Normalize a Vec2 with an approximated reciprocal square root.
+	 *
+	 * For float with SSE, hardware estimate and one Newton-Raphson step:
+	 * relative error on each component below 4e-7. Exact for other types.
+	 *
+	 * @param vec2 Vec2 to normalize, must not be null.
+	 *
+	 * @return Normalised vec2.
+	 */
+	template <typename T>
+	Vec2<T>	normalizeFast(const Vec2<T> &vec2)
+	{
+		return (vec2 * __rsqrt(norm2(vec2)));
+	}
+
+	/**
+	 * @brief Normalize a Vec2 without branch, null if it is too small.
+	 *
+	 * @param vec2 Vec2 to normalize.
+	 * @param epsilon Norm under which the result is a null Vec2.
+	 *
+	 * @return Normalised vec2, or a null Vec2 if it's norm is not above epsilon.
+	 */
+	template <typename T>
+	Vec2<T>	normalizeSafe(const Vec2<T> &vec2, T epsilon = std::numeric_limits<T>::epsilon())
+	{
+		const T	dst = norm2(vec2);
+		const T	minDst = epsilon * epsilon;
+		// sqrt of a valid value, then a select
+		const T	toDiv = static_cast<T>(1) / __sqrt(dst > minDst ? dst : minDst);
+
+		return (vec2 * (dst > minDst ? toDiv : static_cast<T>(0)));
+	}
+
 	/**
 	 * @brief Dot product between two Vec2.
 	 *
@@ -321,9 +324,47 @@ namespace gm {
 	template <typename T>
 	T	dot(const Vec2<T> &v1, const Vec2<T> &v2)
 	{
-		return (v1.x * v2.x + v1.y * v2.y);
+		return (__dot(v1.x, v2.x, v1.y, v2.y));
+	}
+
+	/**
+	 * @brief Fused multiply-add on each component.
+	 *
+	 * @param a First Vec2.
+	 * @param b Second Vec2.
+	 * @param c Vec2 to add.
+	 *
+	 * @return Result of a * b + c with a single rounding per component.
+	 */
+	template <typename T>
+	constexpr Vec2<T>	fma(const Vec2<T> &a, const Vec2<T> &b, const Vec2<T> &c)
+	{
+		return (Vec2<T>(fma(a.x, b.x, c.x), fma(a.y, b.y, c.y)));
 	}
 
+	/**
+	 * @brief Fused multiply-add of a Vec2 by a scalar.
+	 *
+	 * @param a The Vec2.
+	 * @param b The scalar.
+	 * @param c Vec2 to add.
+	 *
+	 * @return Result of a * b + c with a single rounding per component.
+	 */
+	template <typename T>
+	constexpr Vec2<T>	fma(const Vec2<T> &a, const T &b, const Vec2<T> &c)
+	{
+		return (Vec2<T>(fma(a.x, b, c.x), fma(a.y, b, c.y)));
+	}
+
+# ifdef GM_USE_FMA
+	template <typename T>
+	constexpr Vec2<T>	__madd(const Vec2<T> &a, const T &b, const Vec2<T> &c)
+	{
+		return (Vec2<T>(__madd(a.x, b, c.x), __madd(a.y, b, c.y)));
+	}
+# endif
+
 	/**
 	 * @brief Get the hash of a Vec2.
 	 *
@@ -415,6 +456,19 @@ namespace gm {
 	 * The class is design to be used with graphic librairy like OpenGL or Vulkan.
 	 */
 	using Point2d = Vec2<double>;
+
+	//**** CHECKS **************************************************************
+
+	static_assert(std::is_trivially_copyable<Vec2u>::value && std::is_trivially_destructible<Vec2u>::value,
+					"Vec2u must be trivially copyable");
+	static_assert(std::is_trivially_copyable<Vec2i>::value && std::is_trivially_destructible<Vec2i>::value,
+					"Vec2i must be trivially copyable");
+	static_assert(std::is_trivially_copyable<Vec2f>::value && std::is_trivially_destructible<Vec2f>::value,
+					"Vec2f must be trivially copyable");
+	static_assert(std::is_trivially_copyable<Vec2d>::value && std::is_trivially_destructible<Vec2d>::value,
+					"Vec2d must be trivially copyable");
+	static_assert(Vec2i(1, 2) + Vec2i(3) * 2 == Vec2i(7, 8),
+					"Vec2 must be constexpr");
 }
 
 #endif
@@ -0,0 +1,443 @@
+#ifndef GM_VEC2_SOA_HPP
+# define GM_VEC2_SOA_HPP
+
+# include <gmath/SoABuffer.hpp>
+# include <gmath/Vec2.hpp>
+
+#include <cstddef>
+#include <iostream>
+
+namespace gm {
+	//**** STATIC FUNCTIONS DEFINE *********************************************
+	//**** CLASS DEFINE ********************************************************
+
+	/**
+	 * @brief Reference to one vector of a Vec2SoA.
+	 *
+	 * @tparam T Type of value in the vector.
+	 *
+	 * Read and write the vector like a Vec2, components are references to
+	 * the Vec2SoA arrays.
+	 */
+	template <typename T>
+	class Vec2SoARef
+	{
+	public:
+		T	&x;
+		T	&y;
+
+		//**** INITIALISION ****************************************************
+		//---- Constructors ----------------------------------------------------
+
+		/**
+		 * @brief Constructor of Vec2SoARef class.
+		 *
+		 * @param x Reference to x value.
+		 * @param y Reference to y value.
+		 *
+		 * @return The Vec2SoARef on x and y.
+		 */
+		Vec2SoARef(T &x, T &y) : x(x), y(y) {}
+
+		/**
+		 * @brief Copy constructor of Vec2SoARef class.
+		 *
+		 * @param ref The Vec2SoARef to copy.
+		 *
+		 * @return The Vec2SoARef on same values than parameter.
+		 */
+		Vec2SoARef(const Vec2SoARef &ref) : x(ref.x), y(ref.y) {}
+
+		//**** OPERATORS *******************************************************
+		//---- Copy operator ---------------------------------------------------
+
+		/**
+		 * @brief Copy the values of another vector of a Vec2SoA.
+		 *
+		 * @param ref The Vec2SoARef to copy values.
+		 *
+		 * @return Reference to the Vec2SoARef.
+		 */
+		Vec2SoARef	&operator=(const Vec2SoARef &ref)
+		{
+			return (*this = Vec2<T>(ref));
+		}
+
+		/**
+		 * @brief Copy the values of a Vec2.
+		 *
+		 * @param vec2 The Vec2 to copy.
+		 *
+		 * @return Reference to the Vec2SoARef.
+		 */
+		Vec2SoARef	&operator=(const Vec2<T> &vec2)
+		{
+			this->x = vec2.x;
+			this->y = vec2.y;
+			return (*this);
+		}
+
+		//---- Arithmetic operators --------------------------------------------
+
+		/**
+		 * @brief Add a Vec2 to the vector.
+		 *
+		 * @param vec2 The Vec2 to add.
+		 *
+		 * @return Reference to the Vec2SoARef.
+		 */
+		Vec2SoARef	&operator+=(const Vec2<T> &vec2)
+		{
+			this->x += vec2.x;
+			this->y += vec2.y;
+			return (*this);
+		}
+
+		/**
+		 * @brief Subtract a Vec2 to the vector.
+		 *
+		 * @param vec2 The Vec2 to subtract.
+		 *
+		 * @return Reference to the Vec2SoARef.
+		 */
+		Vec2SoARef	&operator-=(const Vec2<T> &vec2)
+		{
+			this->x -= vec2.x;
+			this->y -= vec2.y;
+			return (*this);
+		}
+
+		/**
+		 * @brief Multiply the vector by a value.
+		 *
+		 * @param value The value to multiply.
+		 *
+		 * @return Reference to the Vec2SoARef.
+		 */
+		Vec2SoARef	&operator*=(const T &value)
+		{
+			this->x *= value;
+			this->y *= value;
+			return (*this);
+		}
+
+		/**
+		 * @brief Divide the vector by a value.
+		 *
+		 * @param value The value to divide.
+		 *
+		 * @return Reference to the Vec2SoARef.
+		 */
+		Vec2SoARef	&operator/=(const T &value)
+		{
+			this->x /= value;
+			this->y /= value;
+			return (*this);
+		}
+
+		//---- Compare Operators -----------------------------------------------
+
+		bool	operator==(const Vec2<T> &vec2) const
+		{
+			return (Vec2<T>(*this) == vec2);
+		}
+
+		bool	operator!=(const Vec2<T> &vec2) const
+		{
+			return (Vec2<T>(*this) != vec2);
+		}
+
+		//---- Unary Operators -------------------------------------------------
+
+		Vec2<T>	operator-(void) const
+		{
+			return (-Vec2<T>(*this));
+		}
+
+		//---- Cast operator ---------------------------------------------------
+
+		/**
+		 * @brief Get the values as a Vec2.
+		 *
+		 * @return The Vec2 with the referenced values.
+		 */
+		operator Vec2<T>(void) const
+		{
+			return (Vec2<T>(this->x, this->y));
+		}
+	};
+
+	/**
+	 * @brief Class for 2d vectors stored as structure of arrays.
+	 *
+	 * @tparam T Type of value in the vectors.
+	 *
+	 * x and y values are stored in two aligned arrays, so operations on
+	 * all vectors run at full simd width. Bulk operations (add, sub, scale,
+	 * dot, norm, normalize) are in SoABuffer.hpp.
+	 */
+	template <typename T>
+	class Vec2SoA : public SoABuffer<T, 2>
+	{
+	public:
+		//**** INITIALISION ****************************************************
+		//---- Constructors ----------------------------------------------------
+
+		/**
+		 * @brief Default constructor of Vec2SoA class.
+		 *
+		 * @return The Vec2SoA without vectors.
+		 */
+		Vec2SoA(void) : SoABuffer<T, 2>() {}
+
+		/**
+		 * @brief Constructor of Vec2SoA class.
+		 *
+		 * @param size Number of vectors.
+		 *
+		 * @return The Vec2SoA with size vectors at 0.
+		 */
+		explicit Vec2SoA(std::size_t size) : SoABuffer<T, 2>(size) {}
+
+		/**
+		 * @brief Constructor of Vec2SoA class from an array of Vec2.
+		 *
+		 * @param vecs The Vec2 array.
+		 * @param size Number of Vec2 in array.
+		 *
+		 * @return The Vec2SoA with the vectors of array.
+		 */
+		Vec2SoA(const Vec2<T> *vecs, std::size_t size) : SoABuffer<T, 2>(size)
+		{
+			for (std::size_t i = 0; i < size; i++)
+				(*this)[i] = vecs[i];
+		}
+
+		//**** ACCESSORS *******************************************************
+		//---- Getters ---------------------------------------------------------
+
+		/**
+		 * @brief Get the array of x values.
+		 *
+		 * @return Pointer to size values.
+		 */
+		T	*getX(void) { return (this->data); }
+		const T	*getX(void) const { return (this->data); }
+
+		/**
+		 * @brief Get the array of y values.
+		 *
+		 * @return Pointer to size values.
+		 */
+		T	*getY(void) { return (this->data + this->cap); }
+		const T	*getY(void) const { return (this->data + this->cap); }
+
+		//**** OPERATORS *******************************************************
+		//---- Access operators ------------------------------------------------
+
+		/**
+		 * @brief Access to a vector.
+		 *
+		 * @param i Index of the vector.
+		 *
+		 * @return Reference to the vector, usable as a Vec2.
+		 *
+		 * @warning Checked only if GM_BOUNDS_CHECK is 1, abort when i >= size.
+		 */
+		Vec2SoARef<T>	operator[](std::size_t i) noexcept
+		{
+			GM_ASSERT_BOUNDS(i < this->count, "Index out of vec2 soa bounds");
+			return (Vec2SoARef<T>(this->getX()[i], this->getY()[i]));
+		}
+
+		/**
+		 * @brief Get a vector.
+		 *
+		 * @param i Index of the vector.
+		 *
+		 * @return Copy of the vector.
+		 *
+		 * @warning Checked only if GM_BOUNDS_CHECK is 1, abort when i >= size.
+		 */
+		Vec2<T>	operator[](std::size_t i) const noexcept
+		{
+			GM_ASSERT_BOUNDS(i < this->count, "Index out of vec2 soa bounds");
+			return (Vec2<T>(this->getX()[i], this->getY()[i]));
+		}
+
+		//**** PUBLIC METHODS **************************************************
+
+		/**
+		 * @brief Add a vector at the end.
+		 *
+		 * @param vec2 The vector to add.
+		 */
+		void	pushBack(const Vec2<T> &vec2)
+		{
+			const std::size_t	i = this->grow();
+
+			this->getX()[i] = vec2.x;
+			this->getY()[i] = vec2.y;
+		}
+	};
+
+	//**** EXTERNS OPERATORS ***************************************************
+	//---- Print operator ------------------------------------------------------
+
+	template <typename T>
+	std::ostream	&operator<<(std::ostream &os, const Vec2SoARef<T> &ref)
+	{
+		os << Vec2<T>(ref);
+		return (os);
+	}
+
+	//---- Vector vector operator ----------------------------------------------
+	// The operators of Vec2 are templates, the proxy is not converted when
+	// deducing T
+
+	template <typename T>
+	Vec2<T>	operator+(const Vec2SoARef<T> &ref, const Vec2<T> &vec2)
+	{
+		return (Vec2<T>(ref) + vec2);
+	}
+
+	template <typename T>
+	Vec2<T>	operator+(const Vec2<T> &vec2, const Vec2SoARef<T> &ref)
+	{
+		return (vec2 + Vec2<T>(ref));
+	}
+
+	template <typename T>
+	Vec2<T>	operator+(const Vec2SoARef<T> &r1, const Vec2SoARef<T> &r2)
+	{
+		return (Vec2<T>(r1) + Vec2<T>(r2));
+	}
+
+	template <typename T>
+	Vec2<T>	operator-(const Vec2SoARef<T> &ref, const Vec2<T> &vec2)
+	{
+		return (Vec2<T>(ref) - vec2);
+	}
+
+	template <typename T>
+	Vec2<T>	operator-(const Vec2<T> &vec2, const Vec2SoARef<T> &ref)
+	{
+		return (vec2 - Vec2<T>(ref));
+	}
+
+	template <typename T>
+	Vec2<T>	operator-(const Vec2SoARef<T> &r1, const Vec2SoARef<T> &r2)
+	{
+		return (Vec2<T>(r1) - Vec2<T>(r2));
+	}
+
+	//---- Vector value operator -----------------------------------------------
+
+	template <typename T>
+	Vec2<T>	operator*(const Vec2SoARef<T> &ref, const T &value)
+	{
+		return (Vec2<T>(ref) * value);
+	}
+
+	template <typename T>
+	Vec2<T>	operator*(const T &value, const Vec2SoARef<T> &ref)
+	{
+		return (value * Vec2<T>(ref));
+	}
+
+	template <typename T>
+	Vec2<T>	operator/(const Vec2SoARef<T> &ref, const T &value)
+	{
+		return (Vec2<T>(ref) / value);
+	}
+
+	//**** FUNCTIONS ***********************************************************
+
+	/**
+	 * @brief Norm of a vector of a Vec2SoA, same as with a Vec2.
+	 *
+	 * @param ref The vector of the Vec2SoA.
+	 *
+	 * @return The norm.
+	 */
+	template <typename T>
+	T	norm(const Vec2SoARef<T> &ref)
+	{
+		return (norm(Vec2<T>(ref)));
+	}
+
+	/**
+	 * @brief Norm squared of a vector of a Vec2SoA, same as with a Vec2.
+	 *
+	 * @param ref The vector of the Vec2SoA.
+	 *
+	 * @return The norm squared.
+	 */
+	template <typename T>
+	T	norm2(const Vec2SoARef<T> &ref)
+	{
+		return (norm2(Vec2<T>(ref)));
+	}
+
+	/**
+	 * @brief Normalize a vector of a Vec2SoA, same as with a Vec2.
+	 *
+	 * @param ref The vector of the Vec2SoA.
+	 *
+	 * @return Normalised copy of the vector, or the vector if it's norm is 0.
+	 */
+	template <typename T>
+	Vec2<T>	normalize(const Vec2SoARef<T> &ref)
+	{
+		return (normalize(Vec2<T>(ref)));
+	}
+
+	/**
+	 * @brief Dot product with a vector of a Vec2SoA, same as with a Vec2.
+	 *
+	 * @param ref The vector of the Vec2SoA.
+	 * @param vec2 The other vector.
+	 *
+	 * @return Dot product of the vectors.
+	 */
+	template <typename T>
+	T	dot(const Vec2SoARef<T> &ref, const Vec2<T> &vec2)
+	{
+		return (dot(Vec2<T>(ref), vec2));
+	}
+
+	template <typename T>
+	T	dot(const Vec2<T> &vec2, const Vec2SoARef<T> &ref)
+	{
+		return (dot(vec2, Vec2<T>(ref)));
+	}
+
+	template <typename T>
+	T	dot(const Vec2SoARef<T> &r1, const Vec2SoARef<T> &r2)
+	{
+		return (dot(Vec2<T>(r1), Vec2<T>(r2)));
+	}
+
+	//**** USINGS **************************************************************
+	//---- VEC2SOA -------------------------------------------------------------
+
+	/**
+	 * @brief Class for 2d unsigned int vectors stored as structure of arrays.
+	 */
+	using Vec2SoAu = Vec2SoA<unsigned int>;
+	/**
+	 * @brief Class for 2d int vectors stored as structure of arrays.
+	 */
+	using Vec2SoAi = Vec2SoA<int>;
+	/**
+	 * @brief Class for 2d float vectors stored as structure of arrays, bulk
+	 * operations use simd kernels.
+	 */
+	using Vec2SoAf = Vec2SoA<float>;
+	/**
+	 * @brief Class for 2d double vectors stored as structure of arrays.
+	 */
+	using Vec2SoAd = Vec2SoA<double>;
+}
+
+#endif
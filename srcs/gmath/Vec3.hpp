@@ -5,7 +5,9 @@
 
 #include <cmath>
 #include <iostream>
+#include <limits>
 #include <stdexcept>
+#include <type_traits>
 
 namespace gm {
 	//**** STATIC FUNCTIONS DEFINE *********************************************
@@ -34,12 +36,7 @@ namespace gm {
 		 *
 		 * @return The Vec3 with values at 0.
 		 */
-		Vec3(void)
-		{
-			this->x = T();
-			this->y = T();
-			this->z = T();
-		}
+		constexpr Vec3(void) : x(T()), y(T()), z(T()) {}
 
 		/**
 		 * @brief Copy constructor of Vec3 class.
@@ -48,12 +45,7 @@ namespace gm {
 		 *
 		 * @return The Vec3 copied from parameter.
 		 */
-		Vec3(const Vec3 &vec3)
-		{
-			this->x = vec3.x;
-			this->y = vec3.y;
-			this->z = vec3.z;
-		}
+		Vec3(const Vec3 &vec3) = default;
 
 		/**
 		 * @brief Constructor of Vec3 class from Vec2.
@@ -62,12 +54,7 @@ namespace gm {
 		 *
 		 * @return Vec3 with x and y from parameter and z at 0.
 		 */
-		Vec3(const Vec2<T> &vec2)
-		{
-			this->x = vec2.x;
-			this->y = vec2.y;
-			this->z = T();
-		}
+		constexpr Vec3(const Vec2<T> &vec2) : x(vec2.x), y(vec2.y), z(T()) {}
 
 		/**
 		 * @brief Constructor of Vec3 class from Vec2.
@@ -77,12 +64,7 @@ namespace gm {
 		 *
 		 * @return Vec3 with x and y from vec2 and z from z.
 		 */
-		Vec3(const Vec2<T> &vec2, T z)
-		{
-			this->x = vec2.x;
-			this->y = vec2.y;
-			this->z = z;
-		}
+		constexpr Vec3(const Vec2<T> &vec2, T z) : x(vec2.x), y(vec2.y), z(z) {}
 
 		/**
 		 * @brief Constructor of Vec3 class.
@@ -93,12 +75,7 @@ namespace gm {
 		 *
 		 * @return The Vec3 with parameter values.
 		 */
-		Vec3(T x, T y, T z)
-		{
-			this->x = x;
-			this->y = y;
-			this->z = z;
-		}
+		constexpr Vec3(T x, T y, T z) : x(x), y(y), z(z) {}
 
 		/**
 		 * @brief Constructor of Vec3 class.
@@ -107,37 +84,20 @@ namespace gm {
 		 *
 		 * @return The Vec3 with parameter value.
 		 */
-		Vec3(T value)
-		{
-			this->x = value;
-			this->y = value;
-			this->z = value;
-		}
+		constexpr Vec3(T value) : x(value), y(value), z(value) {}
 
 		//---- Destructor ------------------------------------------------------
 
-		~Vec3()
-		{
-		}
+		~Vec3() = default;
 
 		//**** ACCESSORS *******************************************************
 		//---- Getters ---------------------------------------------------------
 		//---- Setters ---------------------------------------------------------
 		//---- Modify Operators ------------------------------------------------
 
-		Vec3	&operator=(const Vec3 &vec3)
-		{
-			if (this == &vec3)
-				return (*this);
-
-			this->x = vec3.x;
-			this->y = vec3.y;
-			this->z = vec3.z;
+		Vec3	&operator=(const Vec3 &vec3) = default;
 
-			return (*this);
-		}
-
-		Vec3	&operator+=(const Vec3 &vec3)
+		constexpr Vec3	&operator+=(const Vec3 &vec3)
 		{
 			this->x += vec3.x;
 			this->y += vec3.y;
@@ -146,7 +106,7 @@ namespace gm {
 			return (*this);
 		}
 
-		Vec3	&operator-=(const Vec3 &vec3)
+		constexpr Vec3	&operator-=(const Vec3 &vec3)
 		{
 			this->x -= vec3.x;
 			this->y -= vec3.y;
@@ -155,7 +115,7 @@ namespace gm {
 			return (*this);
 		}
 
-		Vec3	&operator*=(const T &value)
+		constexpr Vec3	&operator*=(const T &value)
 		{
 			this->x *= value;
 			this->y *= value;
@@ -164,7 +124,7 @@ namespace gm {
 			return (*this);
 		}
 
-		Vec3	&operator/=(const T &value)
+		constexpr Vec3	&operator/=(const T &value)
 		{
 			this->x /= value;
 			this->y /= value;
@@ -175,19 +135,19 @@ namespace gm {
 
 		//---- Compare Operators -----------------------------------------------
 
-		bool	operator==(const Vec3 &vec3) const
+		constexpr bool	operator==(const Vec3 &vec3) const
 		{
 			return (this->x == vec3.x && this->y == vec3.y && this->z == vec3.z);
 		}
 
-		bool	operator!=(const Vec3 &vec3) const
+		constexpr bool	operator!=(const Vec3 &vec3) const
 		{
 			return (this->x != vec3.x || this->y != vec3.y || this->z != vec3.z);
 		}
 
 		//---- Unary Operators -------------------------------------------------
 
-		Vec3	operator-(void) const
+		constexpr Vec3	operator-(void) const
 		{
 			return (Vec3(-this->x, -this->y, -this->z));
 		}
@@ -200,23 +160,17 @@ namespace gm {
 		 * Index 0 is for x.
 		 * Index 1 is for y.
 		 * Index 2 is for z.
-		 * Other index will return an exception.
 		 *
 		 * @param n Index of the value wanted.
 		 *
 		 * @return The reference to value at the index.
-		 * @exception Throw runtime_error when index is greater than 2.
+		 * @warning Checked only if GM_BOUNDS_CHECK is 1, abort when index is greater than 2.
 		 */
-		T	&operator[](unsigned int n)
+		constexpr T	&operator[](unsigned int n) noexcept
 		{
-			if (n == 0)
-				return (this->x);
-			if (n == 1)
-				return (this->y);
-			if (n == 2)
-				return (this->z);
-
-			throw std::runtime_error("Index out of vec3 bounds");
+			GM_ASSERT_BOUNDS(n < 3, "Index out of vec3 bounds");
+
+			return (n == 0 ? this->x : (n == 1 ? this->y : this->z));
 		}
 
 		/**
@@ -225,23 +179,17 @@ namespace gm {
 		 * Index 0 is for x.
 		 * Index 1 is for y.
 		 * Index 2 is for z.
-		 * Other index will return an exception.
 		 *
 		 * @param n Index of the value wanted.
 		 *
 		 * @return The const reference to value at the index.
-		 * @exception Throw runtime_error when index is greater than 2.
+		 * @warning Checked only if GM_BOUNDS_CHECK is 1, abort when index is greater than 2.
 		 */
-		const T	&operator[](unsigned int n) const
+		constexpr const T	&operator[](unsigned int n) const noexcept
 		{
-			if (n == 0)
-				return (this->x);
-			if (n == 1)
-				return (this->y);
-			if (n == 2)
-				return (this->z);
-
-			throw std::runtime_error("Index out of vec3 bounds");
+			GM_ASSERT_BOUNDS(n < 3, "Index out of vec3 bounds");
+
+			return (n == 0 ? this->x : (n == 1 ? this->y : this->z));
 		}
 
 		//**** PUBLIC METHODS **************************************************
@@ -251,7 +199,7 @@ namespace gm {
 		 *
 		 * @return A Vec2 with x and y as value.
 		 */
-		Vec2<T>	xy(void)
+		constexpr Vec2<T>	xy(void)
 		{
 			return	(Vec2<T>(this->x, this->y));
 		}
@@ -261,7 +209,7 @@ namespace gm {
 		 *
 		 * @return A Vec2 with y and z as value.
 		 */
-		Vec2<T>	yz(void)
+		constexpr Vec2<T>	yz(void)
 		{
 			return	(Vec2<T>(this->y, this->z));
 		}
@@ -271,7 +219,7 @@ namespace gm {
 		 *
 		 * @return A Vec2 with x and z as value.
 		 */
-		Vec2<T>	xz(void)
+		constexpr Vec2<T>	xz(void)
 		{
 			return	(Vec2<T>(this->x, this->z));
 		}
@@ -301,13 +249,13 @@ namespace gm {
 	//---- Vector vector operator ----------------------------------------------
 
 	template <typename T>
-	Vec3<T>	operator+(const Vec3<T> &v1, const Vec3<T> &v2)
+	constexpr Vec3<T>	operator+(const Vec3<T> &v1, const Vec3<T> &v2)
 	{
 		return (Vec3<T>(v1.x + v2.x, v1.y + v2.y, v1.z + v2.z));
 	}
 
 	template <typename T>
-	Vec3<T>	operator-(const Vec3<T> &v1, const Vec3<T> &v2)
+	constexpr Vec3<T>	operator-(const Vec3<T> &v1, const Vec3<T> &v2)
 	{
 		return (Vec3<T>(v1.x - v2.x, v1.y - v2.y, v1.z - v2.z));
 	}
@@ -315,19 +263,19 @@ namespace gm {
 	//---- Vector value operator -----------------------------------------------
 
 	template <typename T>
-	Vec3<T>	operator*(const Vec3<T> &vec3, const T &value)
+	constexpr Vec3<T>	operator*(const Vec3<T> &vec3, const T &value)
 	{
 		return (Vec3<T>(vec3.x * value, vec3.y * value, vec3.z * value));
 	}
 
 	template <typename T>
-	Vec3<T>	operator*(const T &value, const Vec3<T> &vec3)
+	constexpr Vec3<T>	operator*(const T &value, const Vec3<T> &vec3)
 	{
 		return (Vec3<T>(vec3.x * value, vec3.y * value, vec3.z * value));
 	}
 
 	template <typename T>
-	Vec3<T>	operator/(const Vec3<T> &vec3, const T &value)
+	constexpr Vec3<T>	operator/(const Vec3<T> &vec3, const T &value)
 	{
 		return (Vec3<T>(vec3.x / value, vec3.y / value, vec3.z / value));
 	}
@@ -353,9 +301,9 @@ namespace gm {
 	template <typename T>
 	T	norm(const Vec3<T> &vec3)
 	{
-		return (static_cast<T>(sqrt(static_cast<double>(vec3.x * vec3.x
-														+ vec3.y * vec3.y
-														+ vec3.z * vec3.z))));
+		return (__sqrt(vec3.x * vec3.x
+						+ vec3.y * vec3.y
+						+ vec3.z * vec3.z));
 	}
 
 	/**
@@ -383,13 +331,46 @@ namespace gm {
 	{
 		T	dst = norm2(vec3);
 
-		if (dst == static_cast<T>(0) || dst == static_cast<T>(1))
-			return (vec3);
+		const T	toDiv = dst == static_cast<T>(0) ? static_cast<T>(1) : static_cast<T>(1) / __sqrt(dst);
 
-		T	toDiv = static_cast<T>(1) / static_cast<T>(sqrt(static_cast<double>(dst)));
 		return (vec3 * toDiv);
 	}
 
+	/**
+	 * @brief Normalize a Vec3 with an approximated reciprocal square root.
+	 *
+	 * For float with SSE, hardware estimate and one Newton-Raphson step:
+	 * relative error on each component below 4e-7. Exact for other types.
+	 *
+	 * @param vec3 Vec3 to normalize, must not be null.
+	 *
+	 * @return Normalised vec3.
+	 */
+	template <typename T>
+	Vec3<T>	normalizeFast(const Vec3<T> &vec3)
+	{
+		return (vec3 * __rsqrt(norm2(vec3)));
+	}
+
+	/**
+	 * @brief Normalize a Vec3 without branch, null if it is too small.
+	 *
+	 * @param vec3 Vec3 to normalize.
+	 * @param epsilon Norm under which the result is a null Vec3.
+	 *
+	 * @return Normalised vec3, or a null Vec3 if it's norm is not above epsilon.
+	 */
+	template <typename T>
+	Vec3<T>	normalizeSafe(const Vec3<T> &vec3, T epsilon = std::numeric_limits<T>::epsilon())
+	{
+		const T	dst = norm2(vec3);
+		const T	minDst = epsilon * epsilon;
+		// sqrt of a valid value, then a select
+		const T	toDiv = static_cast<T>(1) / __sqrt(dst > minDst ? dst : minDst);
+
+		return (vec3 * (dst > minDst ? toDiv : static_cast<T>(0)));
+	}
+
 	/**
 	 * @brief Dot product between two Vec3.
 	 *
@@ -401,9 +382,47 @@ namespace gm {
 	template <typename T>
 	T	dot(const Vec3<T> &v1, const Vec3<T> &v2)
 	{
-		return (v1.x * v2.x + v1.y * v2.y + v1.z * v2.z);
+		return (__dot(v1.x, v2.x, v1.y, v2.y, v1.z, v2.z));
+	}
+
+	/**
+	 * @brief Fused multiply-add on each component.
+	 *
+	 * @param a First Vec3.
+	 * @param b Second Vec3.
+	 * @param c Vec3 to add.
+	 *
+	 * @return Result of a * b + c with a single rounding per component.
+	 */
+	template <typename T>
+	constexpr Vec3<T>	fma(const Vec3<T> &a, const Vec3<T> &b, const Vec3<T> &c)
+	{
+		return (Vec3<T>(fma(a.x, b.x, c.x), fma(a.y, b.y, c.y), fma(a.z, b.z, c.z)));
 	}
 
+	/**
+	 * @brief Fused multiply-add of a Vec3 by a scalar.
+	 *
+	 * @param a The Vec3.
+	 * @param b The scalar.
+	 * @param c Vec3 to add.
+	 *
+	 * @return Result of a * b + c with a single rounding per component.
+	 */
+	template <typename T>
+	constexpr Vec3<T>	fma(const Vec3<T> &a, const T &b, const Vec3<T> &c)
+	{
+		return (Vec3<T>(fma(a.x, b, c.x), fma(a.y, b, c.y), fma(a.z, b, c.z)));
+	}
+
+# ifdef GM_USE_FMA
+	template <typename T>
+	constexpr Vec3<T>	__madd(const Vec3<T> &a, const T &b, const Vec3<T> &c)
+	{
+		return (Vec3<T>(__madd(a.x, b, c.x), __madd(a.y, b, c.y), __madd(a.z, b, c.z)));
+	}
+# endif
+
 	/**
 	 * @brief Cross product between two Vec2.
 	 *
@@ -513,6 +532,19 @@ namespace gm {
 	 * The class is design to be used with graphic librairy like OpenGL or Vulkan.
 	 */
 	using Point3d = Vec3<double>;
+
+	//**** CHECKS **************************************************************
+
+	static_assert(std::is_trivially_copyable<Vec3u>::value && std::is_trivially_destructible<Vec3u>::value,
+					"Vec3u must be trivially copyable");
+	static_assert(std::is_trivially_copyable<Vec3i>::value && std::is_trivially_destructible<Vec3i>::value,
+					"Vec3i must be trivially copyable");
+	static_assert(std::is_trivially_copyable<Vec3f>::value && std::is_trivially_destructible<Vec3f>::value,
+					"Vec3f must be trivially copyable");
+	static_assert(std::is_trivially_copyable<Vec3d>::value && std::is_trivially_destructible<Vec3d>::value,
+					"Vec3d must be trivially copyable");
+	static_assert(Vec3i(1, 2, 3) + Vec3i(3) * 2 == Vec3i(7, 8, 9),
+					"Vec3 must be constexpr");
 }
 
 #endif
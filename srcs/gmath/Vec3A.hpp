@@ -0,0 +1,536 @@
+#ifndef GM_VEC3A_HPP
+# define GM_VEC3A_HPP
+
+# include <gmath/Vec3.hpp>
+# include <gmath/simd.hpp>
+
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include <type_traits>
+
+namespace gm {
+	//**** STATIC FUNCTIONS DEFINE *********************************************
+	//**** CLASS DEFINE ********************************************************
+
+	/**
+	 * @brief Class for 3d vector padded to 4 values.
+	 *
+	 * @tparam T Type of value in the vector.
+	 *
+	 * The vector is aligned on 4 values up to 16 bytes, so the float version
+	 * is computed with one SSE register, wider types keep their natural
+	 * alignment to stay usable in std::vector. Use it for computation, and
+	 * Vec3 for storage (vertex format, buffers). Both types convert freely.
+	 */
+	template <typename T>
+	class alignas(4 * sizeof(T) <= 16 ? 4 * sizeof(T) : alignof(T)) Vec3A
+	{
+	public:
+		T	x;
+		T	y;
+		T	z;
+
+		//**** INITIALISION ****************************************************
+		//---- Constructors ----------------------------------------------------
+
+		/**
+		 * @brief Default constructor of Vec3A class.
+		 *
+		 * @return The Vec3A with values at 0.
+		 */
+		constexpr Vec3A(void) : x(T()), y(T()), z(T()), pad(T()) {}
+
+		/**
+		 * @brief Copy constructor of Vec3A class.
+		 *
+		 * @param vec3a The Vec3A to copy.
+		 *
+		 * @return The Vec3A copied from parameter.
+		 */
+		Vec3A(const Vec3A &vec3a) = default;
+
+		/**
+		 * @brief Constructor of Vec3A class from Vec3.
+		 *
+		 * @param vec3 The Vec3 to based on.
+		 *
+		 * @return Vec3A with x, y and z from vec3.
+		 */
+		constexpr Vec3A(const Vec3<T> &vec3) : x(vec3.x), y(vec3.y), z(vec3.z), pad(T()) {}
+
+		/**
+		 * @brief Constructor of Vec3A class.
+		 *
+		 * @param x x value of the Vec3A.
+		 * @param y y value of the Vec3A.
+		 * @param z z value of the Vec3A.
+		 *
+		 * @return The Vec3A with parameter values.
+		 */
+		constexpr Vec3A(T x, T y, T z) : x(x), y(y), z(z), pad(T()) {}
+
+		/**
+		 * @brief Constructor of Vec3A class.
+		 *
+		 * @param value x, y and z values of Vec3A.
+		 *
+		 * @return The Vec3A with parameter value.
+		 */
+		constexpr Vec3A(T value) : x(value), y(value), z(value), pad(T()) {}
+
+		//---- Destructor ------------------------------------------------------
+
+		~Vec3A() = default;
+
+		//**** ACCESSORS *******************************************************
+		//---- Getters ---------------------------------------------------------
+		//---- Setters ---------------------------------------------------------
+		//---- Modify Operators ------------------------------------------------
+
+		Vec3A	&operator=(const Vec3A &vec3a) = default;
+
+		constexpr Vec3A	&operator+=(const Vec3A &vec3a)
+		{
+			*this = *this + vec3a;
+
+			return (*this);
+		}
+
+		constexpr Vec3A	&operator-=(const Vec3A &vec3a)
+		{
+			*this = *this - vec3a;
+
+			return (*this);
+		}
+
+		constexpr Vec3A	&operator*=(const T &value)
+		{
+			*this = *this * value;
+
+			return (*this);
+		}
+
+		constexpr Vec3A	&operator/=(const T &value)
+		{
+			*this = *this / value;
+
+			return (*this);
+		}
+
+		//---- Compare Operators -----------------------------------------------
+
+		constexpr bool	operator==(const Vec3A &vec3a) const
+		{
+			return (this->x == vec3a.x && this->y == vec3a.y && this->z == vec3a.z);
+		}
+
+		constexpr bool	operator!=(const Vec3A &vec3a) const
+		{
+			return (this->x != vec3a.x || this->y != vec3a.y || this->z != vec3a.z);
+		}
+
+		//---- Unary Operators -------------------------------------------------
+
+		constexpr Vec3A	operator-(void) const
+		{
+			return (Vec3A(-this->x, -this->y, -this->z));
+		}
+
+		//---- Cast Operators --------------------------------------------------
+
+		/**
+		 * @brief Convert to the packed Vec3.
+		 *
+		 * @return Vec3 with x, y and z of the Vec3A.
+		 */
+		operator Vec3<T>(void) const
+		{
+			return (Vec3<T>(this->x, this->y, this->z));
+		}
+
+		//---- Accessor Operators ----------------------------------------------
+
+		/**
+		 * @brief Access values by index.
+		 *
+		 * Index 0 is for x.
+		 * Index 1 is for y.
+		 * Index 2 is for z.
+		 *
+		 * @param n Index of the value wanted.
+		 *
+		 * @return The reference to value at the index.
+		 * @warning Checked only if GM_BOUNDS_CHECK is 1, abort when index is greater than 2.
+		 */
+		constexpr T	&operator[](unsigned int n) noexcept
+		{
+			GM_ASSERT_BOUNDS(n < 3, "Index out of vec3a bounds");
+
+			return (n == 0 ? this->x : (n == 1 ? this->y : this->z));
+		}
+
+		/**
+		 * @brief Const access values by index.
+		 *
+		 * Index 0 is for x.
+		 * Index 1 is for y.
+		 * Index 2 is for z.
+		 *
+		 * @param n Index of the value wanted.
+		 *
+		 * @return The const reference to value at the index.
+		 * @warning Checked only if GM_BOUNDS_CHECK is 1, abort when index is greater than 2.
+		 */
+		constexpr const T	&operator[](unsigned int n) const noexcept
+		{
+			GM_ASSERT_BOUNDS(n < 3, "Index out of vec3a bounds");
+
+			return (n == 0 ? this->x : (n == 1 ? this->y : this->z));
+		}
+
+		//**** PUBLIC METHODS **************************************************
+		//**** STATIC METHODS **************************************************
+
+	private:
+		// Always 0, so the 4 lanes can be used in simd computation
+		T	pad;
+	};
+
+	//**** EXTERNS OPERATORS ***************************************************
+	//---- Vector vector operator ----------------------------------------------
+
+	template <typename T>
+	constexpr Vec3A<T>	operator+(const Vec3A<T> &v1, const Vec3A<T> &v2)
+	{
+		return (Vec3A<T>(v1.x + v2.x, v1.y + v2.y, v1.z + v2.z));
+	}
+
+	template <typename T>
+	constexpr Vec3A<T>	operator-(const Vec3A<T> &v1, const Vec3A<T> &v2)
+	{
+		return (Vec3A<T>(v1.x - v2.x, v1.y - v2.y, v1.z - v2.z));
+	}
+
+	//---- Vector value operator -----------------------------------------------
+
+	template <typename T>
+	constexpr Vec3A<T>	operator*(const Vec3A<T> &vec3a, const T &value)
+	{
+		return (Vec3A<T>(vec3a.x * value, vec3a.y * value, vec3a.z * value));
+	}
+
+	template <typename T>
+	constexpr Vec3A<T>	operator*(const T &value, const Vec3A<T> &vec3a)
+	{
+		return (Vec3A<T>(vec3a.x * value, vec3a.y * value, vec3a.z * value));
+	}
+
+	template <typename T>
+	constexpr Vec3A<T>	operator/(const Vec3A<T> &vec3a, const T &value)
+	{
+		return (Vec3A<T>(vec3a.x / value, vec3a.y / value, vec3a.z / value));
+	}
+
+	//---- Print operator ------------------------------------------------------
+
+	template <typename T>
+	std::ostream	&operator<<(std::ostream &os, const Vec3A<T> &vec3a)
+	{
+		os << "(" << vec3a.x << "," << vec3a.y << "," << vec3a.z << ")";
+		return (os);
+	}
+
+	//**** FUNCTIONS ***********************************************************
+
+	/**
+	 * @brief Get Vec3A norm.
+	 *
+	 * @param vec3a Vec3A to get the norm.
+	 *
+	 * @return Norm of vec3a.
+	 */
+	template <typename T>
+	T	norm(const Vec3A<T> &vec3a)
+	{
+		return (__sqrt(vec3a.x * vec3a.x
+						+ vec3a.y * vec3a.y
+						+ vec3a.z * vec3a.z));
+	}
+
+	/**
+	 * @brief Get Vec3A norm squared.
+	 *
+	 * @param vec3a Vec3A to get the norm squared.
+	 *
+	 * @return Norm squared of vec3a.
+	 */
+	template <typename T>
+	T	norm2(const Vec3A<T> &vec3a)
+	{
+		return (vec3a.x * vec3a.x + vec3a.y * vec3a.y + vec3a.z * vec3a.z);
+	}
+
+	/**
+	 * @brief Normalize a Vec3A.
+	 *
+	 * @param vec3a Vec3A to normalize.
+	 *
+	 * @return Normalised vec3a, or vec3a if it's norm is 0.
+	 */
+	template <typename T>
+	Vec3A<T>	normalize(const Vec3A<T> &vec3a)
+	{
+		T	dst = norm2(vec3a);
+
+		const T	toDiv = dst == static_cast<T>(0) ? static_cast<T>(1) : static_cast<T>(1) / __sqrt(dst);
+
+		return (vec3a * toDiv);
+	}
+
+	/**
+	 * @brief Dot product between two Vec3A.
+	 *
+	 * @param v1 First Vec3A.
+	 * @param v2 Second Vec3A.
+	 *
+	 * @return Dot product of v1 with v2.
+	 */
+	template <typename T>
+	T	dot(const Vec3A<T> &v1, const Vec3A<T> &v2)
+	{
+		return (__dot(v1.x, v2.x, v1.y, v2.y, v1.z, v2.z));
+	}
+
+	/**
+	 * @brief Cross product between two Vec3A.
+	 *
+	 * @param v1 First Vec3A.
+	 * @param v2 Second Vec3A.
+	 *
+	 * @return Cross product of v1 with v2.
+	 */
+	template <typename T>
+	Vec3A<T>	cross(const Vec3A<T> &v1, const Vec3A<T> &v2)
+	{
+		return (Vec3A<T>((v1.y * v2.z) - (v1.z * v2.y),
+						(v1.z * v2.x) - (v1.x * v2.z),
+						(v1.x * v2.y) - (v1.y * v2.x)));
+	}
+
+	/**
+	 * @brief Get the hash of a Vec3A.
+	 *
+	 * @param vec3a Vec3A to hash.
+	 *
+	 * @return Hash of Vec3A, same as the hash of the equivalent Vec3.
+	 */
+	template <typename T>
+	std::size_t	hash(const Vec3A<T> &vec3a)
+	{
+		return (hash(static_cast<Vec3<T>>(vec3a)));
+	}
+
+	/**
+	 * @brief Get the hash of a Vec3A with small value for avoiding collision.
+	 *
+	 * @param vec3a Vec3A to hash.
+	 *
+	 * @return Hash of Vec3A, same as the hash of the equivalent Vec3.
+	 */
+	template <typename T>
+	std::size_t	hashSmall(const Vec3A<T> &vec3a)
+	{
+		return (hashSmall(static_cast<Vec3<T>>(vec3a)));
+	}
+
+	//**** SIMD SPECIALIZATION ************************************************
+# ifdef GM_SSE2
+
+	/**
+	 * @brief Internal function for Vec3A. Load the Vec3A in a register.
+	 *
+	 * @param vec3a The Vec3A to load.
+	 *
+	 * @return Register with x, y, z and 0.
+	 */
+	inline __m128	__simd(const Vec3A<float> &vec3a)
+	{
+		return (_mm_load_ps(&vec3a.x));
+	}
+
+	/**
+	 * @brief Internal function for Vec3A. Store a register in a Vec3A.
+	 *
+	 * @param simd Register with x, y, z and 0.
+	 *
+	 * @return The Vec3A with register values.
+	 */
+	inline Vec3A<float>	__vec3a(__m128 simd)
+	{
+		Vec3A<float>	res;
+
+		_mm_store_ps(&res.x, simd);
+
+		return (res);
+	}
+
+	/**
+	 * @brief Internal function for Vec3A. Set the pad lane of a register
+	 * back to 0, after a product or a division by inf, 0 or nan.
+	 *
+	 * @param simd The register.
+	 *
+	 * @return Register with x, y, z and 0.
+	 */
+	inline __m128	__clearPad(__m128 simd)
+	{
+		return (_mm_and_ps(simd, _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1))));
+	}
+
+	//---- Vector vector operator ----------------------------------------------
+
+	inline Vec3A<float>	operator+(const Vec3A<float> &v1, const Vec3A<float> &v2)
+	{
+		return (__vec3a(_mm_add_ps(__simd(v1), __simd(v2))));
+	}
+
+	inline Vec3A<float>	operator-(const Vec3A<float> &v1, const Vec3A<float> &v2)
+	{
+		return (__vec3a(_mm_sub_ps(__simd(v1), __simd(v2))));
+	}
+
+	//---- Vector value operator -----------------------------------------------
+
+	inline Vec3A<float>	operator*(const Vec3A<float> &vec3a, const float &value)
+	{
+		return (__vec3a(__clearPad(_mm_mul_ps(__simd(vec3a), _mm_set1_ps(value)))));
+	}
+
+	inline Vec3A<float>	operator*(const float &value, const Vec3A<float> &vec3a)
+	{
+		return (__vec3a(__clearPad(_mm_mul_ps(__simd(vec3a), _mm_set1_ps(value)))));
+	}
+
+	inline Vec3A<float>	operator/(const Vec3A<float> &vec3a, const float &value)
+	{
+		return (__vec3a(__clearPad(_mm_div_ps(__simd(vec3a), _mm_set1_ps(value)))));
+	}
+
+	//---- Functions -----------------------------------------------------------
+
+	/**
+	 * @brief Get Vec3A norm.
+	 *
+	 * @param vec3a Vec3A to get the norm.
+	 *
+	 * @return Norm of vec3a.
+	 */
+	inline float	norm(const Vec3A<float> &vec3a)
+	{
+		return (_mm_cvtss_f32(_mm_sqrt_ss(__dot4(__simd(vec3a), __simd(vec3a)))));
+	}
+
+	/**
+	 * @brief Get Vec3A norm squared.
+	 *
+	 * @param vec3a Vec3A to get the norm squared.
+	 *
+	 * @return Norm squared of vec3a.
+	 */
+	inline float	norm2(const Vec3A<float> &vec3a)
+	{
+		return (_mm_cvtss_f32(__dot4(__simd(vec3a), __simd(vec3a))));
+	}
+
+	/**
+	 * @brief Normalize a Vec3A.
+	 *
+	 * Exact square root and division.
+	 *
+	 * @param vec3a Vec3A to normalize.
+	 *
+	 * @return Normalised vec3a, or vec3a if it's norm is 0.
+	 */
+	inline Vec3A<float>	normalize(const Vec3A<float> &vec3a)
+	{
+		const __m128	simd = __simd(vec3a);
+		const __m128	dst = __dot4(simd, simd);
+
+		if (_mm_cvtss_f32(dst) == 0.0f)
+			return (vec3a);
+
+		return (__vec3a(_mm_div_ps(simd, _mm_sqrt_ps(dst))));
+	}
+
+	/**
+	 * @brief Dot product between two Vec3A.
+	 *
+	 * @param v1 First Vec3A.
+	 * @param v2 Second Vec3A.
+	 *
+	 * @return Dot product of v1 with v2.
+	 */
+	inline float	dot(const Vec3A<float> &v1, const Vec3A<float> &v2)
+	{
+#  if defined(GM_USE_FMA) && defined(GM_FMA)
+		return (_mm_cvtss_f32(__fusedDot3(__simd(v1), __simd(v2))));
+#  else
+		return (_mm_cvtss_f32(__dot4(__simd(v1), __simd(v2))));
+#  endif
+	}
+
+	/**
+	 * @brief Cross product between two Vec3A.
+	 *
+	 * @param v1 First Vec3A.
+	 * @param v2 Second Vec3A.
+	 *
+	 * @return Cross product of v1 with v2.
+	 */
+	inline Vec3A<float>	cross(const Vec3A<float> &v1, const Vec3A<float> &v2)
+	{
+		return (__vec3a(__cross3(__simd(v1), __simd(v2))));
+	}
+
+#  if defined(GM_USE_FMA) && defined(GM_FMA)
+	inline Vec3A<float>	__madd(const Vec3A<float> &a, const float &b, const Vec3A<float> &c)
+	{
+		return (__vec3a(__clearPad(_mm_fmadd_ps(__simd(a), _mm_set1_ps(b), __simd(c)))));
+	}
+#  endif
+
+# endif
+
+	//**** STATIC FUNCTIONS ****************************************************
+	//**** USINGS **************************************************************
+	//---- VEC3A ---------------------------------------------------------------
+
+	/**
+	 * @brief Class for 3d int vector padded to 4 values.
+	 */
+	using Vec3Ai = Vec3A<int>;
+	/**
+	 * @brief Class for 3d float vector padded to 4 values, computed with SSE.
+	 */
+	using Vec3Af = Vec3A<float>;
+	/**
+	 * @brief Class for 3d double vector padded to 4 values.
+	 */
+	using Vec3Ad = Vec3A<double>;
+
+	//**** CHECKS **************************************************************
+
+	static_assert(std::is_trivially_copyable<Vec3Ai>::value && std::is_trivially_destructible<Vec3Ai>::value,
+					"Vec3Ai must be trivially copyable");
+	static_assert(std::is_trivially_copyable<Vec3Af>::value && std::is_trivially_destructible<Vec3Af>::value,
+					"Vec3Af must be trivially copyable");
+	static_assert(std::is_trivially_copyable<Vec3Ad>::value && std::is_trivially_destructible<Vec3Ad>::value,
+					"Vec3Ad must be trivially copyable");
+	static_assert(alignof(Vec3Af) == 16 && sizeof(Vec3Af) == 16 && alignof(Vec3Ad) <= 16,
+					"Vec3A must fit the alignment of std::allocator");
+	static_assert(Vec3Ai(1, 2, 3) + Vec3Ai(3) * 2 == Vec3Ai(7, 8, 9),
+					"Vec3A must be constexpr");
+}
+
+#endif
@@ -0,0 +1,485 @@
+#ifndef GM_VEC3_SOA_HPP
+# define GM_VEC3_SOA_HPP
+
+# include <gmath/SoABuffer.hpp>
+# include <gmath/Vec3.hpp>
+
+#include <cstddef>
+#include <iostream>
+
+namespace gm {
+	//**** STATIC FUNCTIONS DEFINE *********************************************
+	//**** CLASS DEFINE ********************************************************
+
+	/**
+	 * @brief Reference to one vector of a Vec3SoA.
+	 *
+	 * @tparam T Type of value in the vector.
+	 *
+	 * Read and write the vector like a Vec3, components are references to
+	 * the Vec3SoA arrays.
+	 */
+	template <typename T>
+	class Vec3SoARef
+	{
+	public:
+		T	&x;
+		T	&y;
+		T	&z;
+
+		//**** INITIALISION ****************************************************
+		//---- Constructors ----------------------------------------------------
+
+		/**
+		 * @brief Constructor of Vec3SoARef class.
+		 *
+		 * @param x Reference to x value.
+		 * @param y Reference to y value.
+		 * @param z Reference to z value.
+		 *
+		 * @return The Vec3SoARef on x, y and z.
+		 */
+		Vec3SoARef(T &x, T &y, T &z) : x(x), y(y), z(z) {}
+
+		/**
+		 * @brief Copy constructor of Vec3SoARef class.
+		 *
+		 * @param ref The Vec3SoARef to copy.
+		 *
+		 * @return The Vec3SoARef on same values than parameter.
+		 */
+		Vec3SoARef(const Vec3SoARef &ref) : x(ref.x), y(ref.y), z(ref.z) {}
+
+		//**** OPERATORS *******************************************************
+		//---- Copy operator ---------------------------------------------------
+
+		/**
+		 * @brief Copy the values of another vector of a Vec3SoA.
+		 *
+		 * @param ref The Vec3SoARef to copy values.
+		 *
+		 * @return Reference to the Vec3SoARef.
+		 */
+		Vec3SoARef	&operator=(const Vec3SoARef &ref)
+		{
+			return (*this = Vec3<T>(ref));
+		}
+
+		/**
+		 * @brief Copy the values of a Vec3.
+		 *
+		 * @param vec3 The Vec3 to copy.
+		 *
+		 * @return Reference to the Vec3SoARef.
+		 */
+		Vec3SoARef	&operator=(const Vec3<T> &vec3)
+		{
+			this->x = vec3.x;
+			this->y = vec3.y;
+			this->z = vec3.z;
+			return (*this);
+		}
+
+		//---- Arithmetic operators --------------------------------------------
+
+		/**
+		 * @brief Add a Vec3 to the vector.
+		 *
+		 * @param vec3 The Vec3 to add.
+		 *
+		 * @return Reference to the Vec3SoARef.
+		 */
+		Vec3SoARef	&operator+=(const Vec3<T> &vec3)
+		{
+			this->x += vec3.x;
+			this->y += vec3.y;
+			this->z += vec3.z;
+			return (*this);
+		}
+
+		/**
+		 * @brief Subtract a Vec3 to the vector.
+		 *
+		 * @param vec3 The Vec3 to subtract.
+		 *
+		 * @return Reference to the Vec3SoARef.
+		 */
+		Vec3SoARef	&operator-=(const Vec3<T> &vec3)
+		{
+			this->x -= vec3.x;
+			this->y -= vec3.y;
+			this->z -= vec3.z;
+			return (*this);
+		}
+
+		/**
+		 * @brief Multiply the vector by a value.
+		 *
+		 * @param value The value to multiply.
+		 *
+		 * @return Reference to the Vec3SoARef.
+		 */
+		Vec3SoARef	&operator*=(const T &value)
+		{
+			this->x *= value;
+			this->y *= value;
+			this->z *= value;
+			return (*this);
+		}
+
+		/**
+		 * @brief Divide the vector by a value.
+		 *
+		 * @param value The value to divide.
+		 *
+		 * @return Reference to the Vec3SoARef.
+		 */
+		Vec3SoARef	&operator/=(const T &value)
+		{
+			this->x /= value;
+			this->y /= value;
+			this->z /= value;
+			return (*this);
+		}
+
+		//---- Compare Operators -----------------------------------------------
+
+		bool	operator==(const Vec3<T> &vec3) const
+		{
+			return (Vec3<T>(*this) == vec3);
+		}
+
+		bool	operator!=(const Vec3<T> &vec3) const
+		{
+			return (Vec3<T>(*this) != vec3);
+		}
+
+		//---- Unary Operators -------------------------------------------------
+
+		Vec3<T>	operator-(void) const
+		{
+			return (-Vec3<T>(*this));
+		}
+
+		//---- Cast operator ---------------------------------------------------
+
+		/**
+		 * @brief Get the values as a Vec3.
+		 *
+		 * @return The Vec3 with the referenced values.
+		 */
+		operator Vec3<T>(void) const
+		{
+			return (Vec3<T>(this->x, this->y, this->z));
+		}
+	};
+
+	/**
+	 * @brief Class for 3d vectors stored as structure of arrays.
+	 *
+	 * @tparam T Type of value in the vectors.
+	 *
+	 * x, y and z values are stored in three aligned arrays, so operations on
+	 * all vectors run at full simd width. Bulk operations (add, sub, scale,
+	 * dot, cross, norm, normalize) are in SoABuffer.hpp.
+	 */
+	template <typename T>
+	class Vec3SoA : public SoABuffer<T, 3>
+	{
+	public:
+		//**** INITIALISION ****************************************************
+		//---- Constructors ----------------------------------------------------
+
+		/**
+		 * @brief Default constructor of Vec3SoA class.
+		 *
+		 * @return The Vec3SoA without vectors.
+		 */
+		Vec3SoA(void) : SoABuffer<T, 3>() {}
+
+		/**
+		 * @brief Constructor of Vec3SoA class.
+		 *
+		 * @param size Number of vectors.
+		 *
+		 * @return The Vec3SoA with size vectors at 0.
+		 */
+		explicit Vec3SoA(std::size_t size) : SoABuffer<T, 3>(size) {}
+
+		/**
+		 * @brief Constructor of Vec3SoA class from an array of Vec3.
+		 *
+		 * @param vecs The Vec3 array.
+		 * @param size Number of Vec3 in array.
+		 *
+		 * @return The Vec3SoA with the vectors of array.
+		 */
+		Vec3SoA(const Vec3<T> *vecs, std::size_t size) : SoABuffer<T, 3>(size)
+		{
+			for (std::size_t i = 0; i < size; i++)
+				(*this)[i] = vecs[i];
+		}
+
+		//**** ACCESSORS *******************************************************
+		//---- Getters ---------------------------------------------------------
+
+		/**
+		 * @brief Get the array of x values.
+		 *
+		 * @return Pointer to size values.
+		 */
+		T	*getX(void) { return (this->data); }
+		const T	*getX(void) const { return (this->data); }
+
+		/**
+		 * @brief Get the array of y values.
+		 *
+		 * @return Pointer to size values.
+		 */
+		T	*getY(void) { return (this->data + this->cap); }
+		const T	*getY(void) const { return (this->data + this->cap); }
+
+		/**
+		 * @brief Get the array of z values.
+		 *
+		 * @return Pointer to size values.
+		 */
+		T	*getZ(void) { return (this->data + 2 * this->cap); }
+		const T	*getZ(void) const { return (this->data + 2 * this->cap); }
+
+		//**** OPERATORS *******************************************************
+		//---- Access operators ------------------------------------------------
+
+		/**
+		 * @brief Access to a vector.
+		 *
+		 * @param i Index of the vector.
+		 *
+		 * @return Reference to the vector, usable as a Vec3.
+		 *
+		 * @warning Checked only if GM_BOUNDS_CHECK is 1, abort when i >= size.
+		 */
+		Vec3SoARef<T>	operator[](std::size_t i) noexcept
+		{
+			GM_ASSERT_BOUNDS(i < this->count, "Index out of vec3 soa bounds");
+			return (Vec3SoARef<T>(this->getX()[i], this->getY()[i], this->getZ()[i]));
+		}
+
+		/**
+		 * @brief Get a vector.
+		 *
+		 * @param i Index of the vector.
+		 *
+		 * @return Copy of the vector.
+		 *
+		 * @warning Checked only if GM_BOUNDS_CHECK is 1, abort when i >= size.
+		 */
+		Vec3<T>	operator[](std::size_t i) const noexcept
+		{
+			GM_ASSERT_BOUNDS(i < this->count, "Index out of vec3 soa bounds");
+			return (Vec3<T>(this->getX()[i], this->getY()[i], this->getZ()[i]));
+		}
+
+		//**** PUBLIC METHODS **************************************************
+
+		/**
+		 * @brief Add a vector at the end.
+		 *
+		 * @param vec3 The vector to add.
+		 */
+		void	pushBack(const Vec3<T> &vec3)
+		{
+			const std::size_t	i = this->grow();
+
+			this->getX()[i] = vec3.x;
+			this->getY()[i] = vec3.y;
+			this->getZ()[i] = vec3.z;
+		}
+	};
+
+	//**** EXTERNS OPERATORS ***************************************************
+	//---- Print operator ------------------------------------------------------
+
+	template <typename T>
+	std::ostream	&operator<<(std::ostream &os, const Vec3SoARef<T> &ref)
+	{
+		os << Vec3<T>(ref);
+		return (os);
+	}
+
+	//---- Vector vector operator ----------------------------------------------
+	// The operators of Vec3 are templates, the proxy is not converted when
+	// deducing T
+
+	template <typename T>
+	Vec3<T>	operator+(const Vec3SoARef<T> &ref, const Vec3<T> &vec3)
+	{
+		return (Vec3<T>(ref) + vec3);
+	}
+
+	template <typename T>
+	Vec3<T>	operator+(const Vec3<T> &vec3, const Vec3SoARef<T> &ref)
+	{
+		return (vec3 + Vec3<T>(ref));
+	}
+
+	template <typename T>
+	Vec3<T>	operator+(const Vec3SoARef<T> &r1, const Vec3SoARef<T> &r2)
+	{
+		return (Vec3<T>(r1) + Vec3<T>(r2));
+	}
+
+	template <typename T>
+	Vec3<T>	operator-(const Vec3SoARef<T> &ref, const Vec3<T> &vec3)
+	{
+		return (Vec3<T>(ref) - vec3);
+	}
+
+	template <typename T>
+	Vec3<T>	operator-(const Vec3<T> &vec3, const Vec3SoARef<T> &ref)
+	{
+		return (vec3 - Vec3<T>(ref));
+	}
+
+	template <typename T>
+	Vec3<T>	operator-(const Vec3SoARef<T> &r1, const Vec3SoARef<T> &r2)
+	{
+		return (Vec3<T>(r1) - Vec3<T>(r2));
+	}
+
+	//---- Vector value operator -----------------------------------------------
+
+	template <typename T>
+	Vec3<T>	operator*(const Vec3SoARef<T> &ref, const T &value)
+	{
+		return (Vec3<T>(ref) * value);
+	}
+
+	template <typename T>
+	Vec3<T>	operator*(const T &value, const Vec3SoARef<T> &ref)
+	{
+		return (value * Vec3<T>(ref));
+	}
+
+	template <typename T>
+	Vec3<T>	operator/(const Vec3SoARef<T> &ref, const T &value)
+	{
+		return (Vec3<T>(ref) / value);
+	}
+
+	//**** FUNCTIONS ***********************************************************
+
+	/**
+	 * @brief Norm of a vector of a Vec3SoA, same as with a Vec3.
+	 *
+	 * @param ref The vector of the Vec3SoA.
+	 *
+	 * @return The norm.
+	 */
+	template <typename T>
+	T	norm(const Vec3SoARef<T> &ref)
+	{
+		return (norm(Vec3<T>(ref)));
+	}
+
+	/**
+	 * @brief Norm squared of a vector of a Vec3SoA, same as with a Vec3.
+	 *
+	 * @param ref The vector of the Vec3SoA.
+	 *
+	 * @return The norm squared.
+	 */
+	template <typename T>
+	T	norm2(const Vec3SoARef<T> &ref)
+	{
+		return (norm2(Vec3<T>(ref)));
+	}
+
+	/**
+	 * @brief Normalize a vector of a Vec3SoA, same as with a Vec3.
+	 *
+	 * @param ref The vector of the Vec3SoA.
+	 *
+	 * @return Normalised copy of the vector, or the vector if it's norm is 0.
+	 */
+	template <typename T>
+	Vec3<T>	normalize(const Vec3SoARef<T> &ref)
+	{
+		return (normalize(Vec3<T>(ref)));
+	}
+
+	/**
+	 * @brief Dot product with a vector of a Vec3SoA, same as with a Vec3.
+	 *
+	 * @param ref The vector of the Vec3SoA.
+	 * @param vec3 The other vector.
+	 *
+	 * @return Dot product of the vectors.
+	 */
+	template <typename T>
+	T	dot(const Vec3SoARef<T> &ref, const Vec3<T> &vec3)
+	{
+		return (dot(Vec3<T>(ref), vec3));
+	}
+
+	template <typename T>
+	T	dot(const Vec3<T> &vec3, const Vec3SoARef<T> &ref)
+	{
+		return (dot(vec3, Vec3<T>(ref)));
+	}
+
+	template <typename T>
+	T	dot(const Vec3SoARef<T> &r1, const Vec3SoARef<T> &r2)
+	{
+		return (dot(Vec3<T>(r1), Vec3<T>(r2)));
+	}
+
+	/**
+	 * @brief Cross product with a vector of a Vec3SoA, same as with a Vec3.
+	 *
+	 * @param ref The vector of the Vec3SoA.
+	 * @param vec3 The other vector.
+	 *
+	 * @return Cross product of the vectors.
+	 */
+	template <typename T>
+	Vec3<T>	cross(const Vec3SoARef<T> &ref, const Vec3<T> &vec3)
+	{
+		return (cross(Vec3<T>(ref), vec3));
+	}
+
+	template <typename T>
+	Vec3<T>	cross(const Vec3<T> &vec3, const Vec3SoARef<T> &ref)
+	{
+		return (cross(vec3, Vec3<T>(ref)));
+	}
+
+	template <typename T>
+	Vec3<T>	cross(const Vec3SoARef<T> &r1, const Vec3SoARef<T> &r2)
+	{
+		return (cross(Vec3<T>(r1), Vec3<T>(r2)));
+	}
+
+	//**** USINGS **************************************************************
+	//---- VEC3SOA -------------------------------------------------------------
+
+	/**
+	 * @brief Class for 3d unsigned int vectors stored as structure of arrays.
+	 */
+	using Vec3SoAu = Vec3SoA<unsigned int>;
+	/**
+	 * @brief Class for 3d int vectors stored as structure of arrays.
+	 */
+	using Vec3SoAi = Vec3SoA<int>;
+	/**
+	 * @brief Class for 3d float vectors stored as structure of arrays, bulk
+	 * operations use simd kernels.
+	 */
+	using Vec3SoAf = Vec3SoA<float>;
+	/**
+	 * @brief Class for 3d double vectors stored as structure of arrays.
+	 */
+	using Vec3SoAd = Vec3SoA<double>;
+}
+
+#endif
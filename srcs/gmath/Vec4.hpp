@@ -3,10 +3,13 @@
 
 # include <gmath/Vec2.hpp>
 # include <gmath/Vec3.hpp>
+# include <gmath/simd.hpp>
 
 #include <cmath>
 #include <iostream>
+#include <limits>
 #include <stdexcept>
+#include <type_traits>
 
 namespace gm {
 	//**** STATIC FUNCTIONS DEFINE *********************************************
@@ -36,13 +39,7 @@ namespace gm {
 		 *
 		 * @return The Vec4 with values at 0.
 		 */
-		Vec4(void)
-		{
-			this->x = T();
-			this->y = T();
-			this->z = T();
-			this->w = T();
-		}
+		constexpr Vec4(void) : x(T()), y(T()), z(T()), w(T()) {}
 
 		/**
 		 * @brief Copy constructor of Vec4 class.
@@ -51,13 +48,7 @@ namespace gm {
 		 *
 		 * @return The Vec4 copied from parameter.
 		 */
-		Vec4(const Vec4 &vec4)
-		{
-			this->x = vec4.x;
-			this->y = vec4.y;
-			this->z = vec4.z;
-			this->w = vec4.w;
-		}
+		Vec4(const Vec4 &vec4) = default;
 
 		/**
 		 * @brief Constructor of Vec4 class from Vec2.
@@ -66,13 +57,7 @@ namespace gm {
 		 *
 		 * @return Vec4 with x and y from parameter and z and w at 0.
 		 */
-		Vec4(const Vec2<T> &vec2)
-		{
-			this->x = vec2.x;
-			this->y = vec2.y;
-			this->z = T();
-			this->w = T();
-		}
+		constexpr Vec4(const Vec2<T> &vec2) : x(vec2.x), y(vec2.y), z(T()), w(T()) {}
 
 		/**
 		 * @brief Constructor of Vec4 class from Vec2.
@@ -82,13 +67,7 @@ namespace gm {
 		 *
 		 * @return Vec4 with x and y from vec2, z from z and w at 0.
 		 */
-		Vec4(const Vec2<T> &vec2, T z)
-		{
-			this->x = vec2.x;
-			this->y = vec2.y;
-			this->z = z;
-			this->w = T();
-		}
+		constexpr Vec4(const Vec2<T> &vec2, T z) : x(vec2.x), y(vec2.y), z(z), w(T()) {}
 
 		/**
 		 * @brief Constructor of Vec4 class from Vec2.
@@ -99,13 +78,7 @@ namespace gm {
 		 *
 		 * @return Vec4 with x and y from vec2, z and w from parameters.
 		 */
-		Vec4(const Vec2<T> &vec2, T z, T w)
-		{
-			this->x = vec2.x;
-			this->y = vec2.y;
-			this->z = z;
-			this->w = w;
-		}
+		constexpr Vec4(const Vec2<T> &vec2, T z, T w) : x(vec2.x), y(vec2.y), z(z), w(w) {}
 
 		/**
 		 * @brief Constructor of Vec4 class from Vec3.
@@ -114,13 +87,7 @@ namespace gm {
 		 *
 		 * @return Vec4 with x, y and z from vec3 and w at 0.
 		 */
-		Vec4(const Vec3<T> &vec3)
-		{
-			this->x = vec3.x;
-			this->y = vec3.y;
-			this->z = vec3.z;
-			this->w = T();
-		}
+		constexpr Vec4(const Vec3<T> &vec3) : x(vec3.x), y(vec3.y), z(vec3.z), w(T()) {}
 
 		/**
 		 * @brief Constructor of Vec4 class from Vec3.
@@ -130,13 +97,7 @@ namespace gm {
 		 *
 		 * @return Vec4 with x, y and z from vec3 and w at w.
 		 */
-		Vec4(const Vec3<T> &vec3, T w)
-		{
-			this->x = vec3.x;
-			this->y = vec3.y;
-			this->z = vec3.z;
-			this->w = w;
-		}
+		constexpr Vec4(const Vec3<T> &vec3, T w) : x(vec3.x), y(vec3.y), z(vec3.z), w(w) {}
 
 		/**
 		 * @brief Constructor of Vec4 class.
@@ -148,13 +109,7 @@ namespace gm {
 		 *
 		 * @return The Vec4 with parameter values.
 		 */
-		Vec4(T x, T y, T z, T w)
-		{
-			this->x = x;
-			this->y = y;
-			this->z = z;
-			this->w = w;
-		}
+		constexpr Vec4(T x, T y, T z, T w) : x(x), y(y), z(z), w(w) {}
 
 		/**
 		 * @brief Constructor of Vec4 class.
@@ -163,39 +118,20 @@ namespace gm {
 		 *
 		 * @return The Vec4 with parameter value.
 		 */
-		Vec4(T value)
-		{
-			this->x = value;
-			this->y = value;
-			this->z = value;
-			this->w = value;
-		}
+		constexpr Vec4(T value) : x(value), y(value), z(value), w(value) {}
 
 		//---- Destructor ------------------------------------------------------
 
-		~Vec4()
-		{
-		}
+		~Vec4() = default;
 
 		//**** ACCESSORS *******************************************************
 		//---- Getters ---------------------------------------------------------
 		//---- Setters ---------------------------------------------------------
 		//---- Modify Operators ------------------------------------------------
 
-		Vec4	&operator=(const Vec4 &vec4)
-		{
-			if (this == &vec4)
-				return (*this);
-
-			this->x = vec4.x;
-			this->y = vec4.y;
-			this->z = vec4.z;
-			this->w = vec4.w;
-
-			return (*this);
-		}
+		Vec4	&operator=(const Vec4 &vec4) = default;
 
-		Vec4	&operator+=(const Vec4 &vec4)
+		constexpr Vec4	&operator+=(const Vec4 &vec4)
 		{
 			this->x += vec4.x;
 			this->y += vec4.y;
@@ -205,7 +141,7 @@ namespace gm {
 			return (*this);
 		}
 
-		Vec4	&operator-=(const Vec4 &vec4)
+		constexpr Vec4	&operator-=(const Vec4 &vec4)
 		{
 			this->x -= vec4.x;
 			this->y -= vec4.y;
@@ -215,7 +151,7 @@ namespace gm {
 			return (*this);
 		}
 
-		Vec4	&operator*=(const T &value)
+		constexpr Vec4	&operator*=(const T &value)
 		{
 			this->x *= value;
 			this->y *= value;
@@ -225,7 +161,7 @@ namespace gm {
 			return (*this);
 		}
 
-		Vec4	&operator/=(const T &value)
+		constexpr Vec4	&operator/=(const T &value)
 		{
 			this->x /= value;
 			this->y /= value;
@@ -237,19 +173,19 @@ namespace gm {
 
 		//---- Compare Operators -----------------------------------------------
 
-		bool	operator==(const Vec4 &vec4) const
+		constexpr bool	operator==(const Vec4 &vec4) const
 		{
 			return (this->x == vec4.x && this->y == vec4.y && this->z == vec4.z && this->w == vec4.w);
 		}
 
-		bool	operator!=(const Vec4 &vec4) const
+		constexpr bool	operator!=(const Vec4 &vec4) const
 		{
 			return (this->x != vec4.x || this->y != vec4.y || this->z != vec4.z || this->w != vec4.w);
 		}
 
 		//---- Unary Operators -------------------------------------------------
 
-		Vec4	operator-(void) const
+		constexpr Vec4	operator-(void) const
 		{
 			return (Vec4(-this->x, -this->y, -this->z, -this->w));
 		}
@@ -263,25 +199,17 @@ namespace gm {
 		 * Index 1 is for y.
 		 * Index 2 is for z.
 		 * Index 3 is for w.
-		 * Other index will return an exception.
 		 *
 		 * @param n Index of the value wanted.
 		 *
 		 * @return The reference to value at the index.
-		 * @exception Throw runtime_error when index is greater than 3.
+		 * @warning Checked only if GM_BOUNDS_CHECK is 1, abort when index is greater than 3.
 		 */
-		T	&operator[](unsigned int n)
+		constexpr T	&operator[](unsigned int n) noexcept
 		{
-			if (n == 0)
-				return (this->x);
-			if (n == 1)
-				return (this->y);
-			if (n == 2)
-				return (this->z);
-			if (n == 3)
-				return (this->w);
+			GM_ASSERT_BOUNDS(n < 4, "Index out of vec4 bounds");
 
-			throw std::runtime_error("Index out of vec4 bounds");
+			return (n == 0 ? this->x : (n == 1 ? this->y : (n == 2 ? this->z : this->w)));
 		}
 
 		/**
@@ -291,25 +219,17 @@ namespace gm {
 		 * Index 1 is for y.
 		 * Index 2 is for z.
 		 * Index 3 is for w.
-		 * Other index will return an exception.
 		 *
 		 * @param n Index of the value wanted.
 		 *
 		 * @return The const reference to value at the index.
-		 * @exception Throw runtime_error when index is greater than 3.
+		 * @warning Checked only if GM_BOUNDS_CHECK is 1, abort when index is greater than 3.
 		 */
-		const T	&operator[](unsigned int n) const
+		constexpr const T	&operator[](unsigned int n) const noexcept
 		{
-			if (n == 0)
-				return (this->x);
-			if (n == 1)
-				return (this->y);
-			if (n == 2)
-				return (this->z);
-			if (n == 3)
-				return (this->w);
+			GM_ASSERT_BOUNDS(n < 4, "Index out of vec4 bounds");
 
-			throw std::runtime_error("Index out of vec4 bounds");
+			return (n == 0 ? this->x : (n == 1 ? this->y : (n == 2 ? this->z : this->w)));
 		}
 
 		//**** PUBLIC METHODS **************************************************
@@ -320,7 +240,7 @@ namespace gm {
 		 *
 		 * @return A Vec2 with x and y as value.
 		 */
-		Vec2<T>	xy(void)
+		constexpr Vec2<T>	xy(void)
 		{
 			return	(Vec2<T>(this->x, this->y));
 		}
@@ -330,7 +250,7 @@ namespace gm {
 		 *
 		 * @return A Vec2 with y and z as value.
 		 */
-		Vec2<T>	yz(void)
+		constexpr Vec2<T>	yz(void)
 		{
 			return	(Vec2<T>(this->y, this->z));
 		}
@@ -340,7 +260,7 @@ namespace gm {
 		 *
 		 * @return A Vec2 with z and w as value.
 		 */
-		Vec2<T>	zw(void)
+		constexpr Vec2<T>	zw(void)
 		{
 			return	(Vec2<T>(this->z, this->w));
 		}
@@ -350,7 +270,7 @@ namespace gm {
 		 *
 		 * @return A Vec2 with x and z as value.
 		 */
-		Vec2<T>	xz(void)
+		constexpr Vec2<T>	xz(void)
 		{
 			return	(Vec2<T>(this->x, this->z));
 		}
@@ -360,7 +280,7 @@ namespace gm {
 		 *
 		 * @return A Vec2 with x and w as value.
 		 */
-		Vec2<T>	xw(void)
+		constexpr Vec2<T>	xw(void)
 		{
 			return	(Vec2<T>(this->x, this->w));
 		}
@@ -370,7 +290,7 @@ namespace gm {
 		 *
 		 * @return A Vec2 with y and w as value.
 		 */
-		Vec2<T>	yw(void)
+		constexpr Vec2<T>	yw(void)
 		{
 			return	(Vec2<T>(this->y, this->w));
 		}
@@ -382,7 +302,7 @@ namespace gm {
 		 *
 		 * @return A Vec3 with x, y and z as value.
 		 */
-		Vec3<T>	xyz(void)
+		constexpr Vec3<T>	xyz(void)
 		{
 			return	(Vec3<T>(this->x, this->y, this->z));
 		}
@@ -392,7 +312,7 @@ namespace gm {
 		 *
 		 * @return A Vec3 with y, z and w as value.
 		 */
-		Vec3<T>	yzw(void)
+		constexpr Vec3<T>	yzw(void)
 		{
 			return	(Vec3<T>(this->y, this->z, this->w));
 		}
@@ -402,7 +322,7 @@ namespace gm {
 		 *
 		 * @return A Vec3 with x, z and w as value.
 		 */
-		Vec3<T>	xzw(void)
+		constexpr Vec3<T>	xzw(void)
 		{
 			return	(Vec3<T>(this->x, this->z, this->w));
 		}
@@ -415,13 +335,13 @@ namespace gm {
 	//---- Vector vector operator ----------------------------------------------
 
 	template <typename T>
-	Vec4<T>	operator+(const Vec4<T> &v1, const Vec4<T> &v2)
+	constexpr Vec4<T>	operator+(const Vec4<T> &v1, const Vec4<T> &v2)
 	{
 		return (Vec4<T>(v1.x + v2.x, v1.y + v2.y, v1.z + v2.z, v1.w + v2.w));
 	}
 
 	template <typename T>
-	Vec4<T>	operator-(const Vec4<T> &v1, const Vec4<T> &v2)
+	constexpr Vec4<T>	operator-(const Vec4<T> &v1, const Vec4<T> &v2)
 	{
 		return (Vec4<T>(v1.x - v2.x, v1.y - v2.y, v1.z - v2.z, v1.w - v2.w));
 	}
@@ -429,19 +349,19 @@ namespace gm {
 	//---- Vector value operator -----------------------------------------------
 
 	template <typename T>
-	Vec4<T>	operator*(const Vec4<T> &vec4, const T &value)
+	constexpr Vec4<T>	operator*(const Vec4<T> &vec4, const T &value)
 	{
 		return (Vec4<T>(vec4.x * value, vec4.y * value, vec4.z * value, vec4.w * value));
 	}
 
 	template <typename T>
-	Vec4<T>	operator*(const T &value, const Vec4<T> &vec4)
+	constexpr Vec4<T>	operator*(const T &value, const Vec4<T> &vec4)
 	{
 		return (Vec4<T>(vec4.x * value, vec4.y * value, vec4.z * value, vec4.w * value));
 	}
 
 	template <typename T>
-	Vec4<T>	operator/(const Vec4<T> &vec4, const T &value)
+	constexpr Vec4<T>	operator/(const Vec4<T> &vec4, const T &value)
 	{
 		return (Vec4<T>(vec4.x / value, vec4.y / value, vec4.z / value, vec4.w / value));
 	}
@@ -467,10 +387,10 @@ namespace gm {
 	template <typename T>
 	T	norm(const Vec4<T> &vec4)
 	{
-		return (static_cast<T>(sqrt(static_cast<double>(vec4.x * vec4.x
-														+ vec4.y * vec4.y
-														+ vec4.z * vec4.z
-														+ vec4.w * vec4.w))));
+		return (__sqrt(vec4.x * vec4.x
+						+ vec4.y * vec4.y
+						+ vec4.z * vec4.z
+						+ vec4.w * vec4.w));
 	}
 
 	/**
@@ -498,13 +418,46 @@ namespace gm {
 	{
 		T	dst = norm2(vec4);
 
-		if (dst == static_cast<T>(0) || dst == static_cast<T>(1))
-			return (vec4);
+		const T	toDiv = dst == static_cast<T>(0) ? static_cast<T>(1) : static_cast<T>(1) / __sqrt(dst);
 
-		T	toDiv = static_cast<T>(1) / static_cast<T>(sqrt(static_cast<double>(dst)));
 		return (vec4 * toDiv);
 	}
 
+	/**
+	 * @brief Normalize a Vec4 with an approximated reciprocal square root.
+	 *
+	 * For float with SSE, hardware estimate and one Newton-Raphson step:
+	 * relative error on each component below 4e-7. Exact for other types.
+	 *
+	 * @param vec4 Vec4 to normalize, must not be null.
+	 *
+	 * @return Normalised vec4.
+	 */
+	template <typename T>
+	Vec4<T>	normalizeFast(const Vec4<T> &vec4)
+	{
+		return (vec4 * __rsqrt(norm2(vec4)));
+	}
+
+	/**
+	 * @brief Normalize a Vec4 without branch, null if it is too small.
+	 *
+	 * @param vec4 Vec4 to normalize.
+	 * @param epsilon Norm under which the result is a null Vec4.
+	 *
+	 * @return Normalised vec4, or a null Vec4 if it's norm is not above epsilon.
+	 */
+	template <typename T>
+	Vec4<T>	normalizeSafe(const Vec4<T> &vec4, T epsilon = std::numeric_limits<T>::epsilon())
+	{
+		const T	dst = norm2(vec4);
+		const T	minDst = epsilon * epsilon;
+		// sqrt of a valid value, then a select
+		const T	toDiv = static_cast<T>(1) / __sqrt(dst > minDst ? dst : minDst);
+
+		return (vec4 * (dst > minDst ? toDiv : static_cast<T>(0)));
+	}
+
 	/**
 	 * @brief Dot product between two Vec4.
 	 *
@@ -516,8 +469,46 @@ namespace gm {
 	template <typename T>
 	T	dot(const Vec4<T> &v1, const Vec4<T> &v2)
 	{
-		return (v1.x * v2.x + v1.y * v2.y + v1.z * v2.z + v1.w * v2.w);
+		return (__dot(v1.x, v2.x, v1.y, v2.y, v1.z, v2.z, v1.w, v2.w));
+	}
+
+	/**
+	 * @brief Fused multiply-add on each component.
+	 *
+	 * @param a First Vec4.
+	 * @param b Second Vec4.
+	 * @param c Vec4 to add.
+	 *
+	 * @return Result of a * b + c with a single rounding per component.
+	 */
+	template <typename T>
+	constexpr Vec4<T>	fma(const Vec4<T> &a, const Vec4<T> &b, const Vec4<T> &c)
+	{
+		return (Vec4<T>(fma(a.x, b.x, c.x), fma(a.y, b.y, c.y), fma(a.z, b.z, c.z), fma(a.w, b.w, c.w)));
+	}
+
+	/**
+	 * @brief Fused multiply-add of a Vec4 by a scalar.
+	 *
+	 * @param a The Vec4.
+	 * @param b The scalar.
+	 * @param c Vec4 to add.
+	 *
+	 * @return Result of a * b + c with a single rounding per component.
+	 */
+	template <typename T>
+	constexpr Vec4<T>	fma(const Vec4<T> &a, const T &b, const Vec4<T> &c)
+	{
+		return (Vec4<T>(fma(a.x, b, c.x), fma(a.y, b, c.y), fma(a.z, b, c.z), fma(a.w, b, c.w)));
+	}
+
+# ifdef GM_USE_FMA
+	template <typename T>
+	constexpr Vec4<T>	__madd(const Vec4<T> &a, const T &b, const Vec4<T> &c)
+	{
+		return (Vec4<T>(__madd(a.x, b, c.x), __madd(a.y, b, c.y), __madd(a.z, b, c.z), __madd(a.w, b, c.w)));
 	}
+# endif
 
 	/**
 	 * @brief Get the hash of a Vec4.
@@ -559,6 +550,505 @@ namespace gm {
 		return (hash);
 	}
 
+	//**** SIMD SPECIALIZATION ************************************************
+# ifdef GM_SSE2
+
+	/**
+	 * @brief Class for 4d float vector, SSE version.
+	 *
+	 * Same api than the generic Vec4, values are 16 bytes aligned so they are
+	 * loaded in one __m128 register for every operation.
+	 *
+	 * The class is design to be used with graphic librairy like OpenGL or Vulkan.
+	 */
+	template <>
+	class alignas(16) Vec4<float>
+	{
+	public:
+		float	x;
+		float	y;
+		float	z;
+		float	w;
+
+		//**** INITIALISION ****************************************************
+		//---- Constructors ----------------------------------------------------
+
+		/**
+		 * @brief Default constructor of Vec4 class.
+		 *
+		 * @return The Vec4 with values at 0.
+		 */
+		constexpr Vec4(void) : x(0.0f), y(0.0f), z(0.0f), w(0.0f) {}
+
+		/**
+		 * @brief Copy constructor of Vec4 class.
+		 *
+		 * @param vec4 The Vec4 to copy.
+		 *
+		 * @return The Vec4 copied from parameter.
+		 */
+		Vec4(const Vec4 &vec4) = default;
+
+		/**
+		 * @brief Constructor of Vec4 class from a register.
+		 *
+		 * @param simd The register with x, y, z and w values.
+		 *
+		 * @return The Vec4 with register values.
+		 */
+		explicit Vec4(__m128 simd)
+		{
+			_mm_store_ps(&this->x, simd);
+		}
+
+		/**
+		 * @brief Constructor of Vec4 class from Vec2.
+		 *
+		 * @param vec2 The vec2 to based on.
+		 *
+		 * @return Vec4 with x and y from parameter and z and w at 0.
+		 */
+		constexpr Vec4(const Vec2<float> &vec2) : x(vec2.x), y(vec2.y), z(0.0f), w(0.0f) {}
+
+		/**
+		 * @brief Constructor of Vec4 class from Vec2.
+		 *
+		 * @param vec2 The Vec2 to based on.
+		 * @param z The z of the Vec4.
+		 *
+		 * @return Vec4 with x and y from vec2, z from z and w at 0.
+		 */
+		constexpr Vec4(const Vec2<float> &vec2, float z) : x(vec2.x), y(vec2.y), z(z), w(0.0f) {}
+
+		/**
+		 * @brief Constructor of Vec4 class from Vec2.
+		 *
+		 * @param vec2 The Vec2 to based on.
+		 * @param z The z of the Vec4.
+		 * @param w The w of the Vec4.
+		 *
+		 * @return Vec4 with x and y from vec2, z and w from parameters.
+		 */
+		constexpr Vec4(const Vec2<float> &vec2, float z, float w) : x(vec2.x), y(vec2.y), z(z), w(w) {}
+
+		/**
+		 * @brief Constructor of Vec4 class from Vec3.
+		 *
+		 * @param vec3 The Vec3 to based on.
+		 *
+		 * @return Vec4 with x, y and z from vec3 and w at 0.
+		 */
+		constexpr Vec4(const Vec3<float> &vec3) : x(vec3.x), y(vec3.y), z(vec3.z), w(0.0f) {}
+
+		/**
+		 * @brief Constructor of Vec4 class from Vec3.
+		 *
+		 * @param vec3 The Vec3 to based on.
+		 * @param w The w of the Vec4.
+		 *
+		 * @return Vec4 with x, y and z from vec3 and w at w.
+		 */
+		constexpr Vec4(const Vec3<float> &vec3, float w) : x(vec3.x), y(vec3.y), z(vec3.z), w(w) {}
+
+		/**
+		 * @brief Constructor of Vec4 class.
+		 *
+		 * @param x x value of the Vec4.
+		 * @param y y value of the Vec4.
+		 * @param z z value of the Vec4.
+		 * @param w w value of the Vec4.
+		 *
+		 * @return The Vec4 with parameter values.
+		 */
+		constexpr Vec4(float x, float y, float z, float w) : x(x), y(y), z(z), w(w) {}
+
+		/**
+		 * @brief Constructor of Vec4 class.
+		 *
+		 * @param value x, y, z and w values of Vec4.
+		 *
+		 * @return The Vec4 with parameter value.
+		 */
+		constexpr Vec4(float value) : x(value), y(value), z(value), w(value) {}
+
+		//---- Destructor ------------------------------------------------------
+
+		~Vec4() = default;
+
+		//**** ACCESSORS *******************************************************
+		//---- Getters ---------------------------------------------------------
+
+		/**
+		 * @brief Load the values in a register.
+		 *
+		 * @return The register with x, y, z and w values.
+		 */
+		__m128	simd(void) const
+		{
+			return (_mm_load_ps(&this->x));
+		}
+
+		//---- Setters ---------------------------------------------------------
+		//---- Modify Operators ------------------------------------------------
+
+		Vec4	&operator=(const Vec4 &vec4) = default;
+
+		Vec4	&operator+=(const Vec4 &vec4)
+		{
+			_mm_store_ps(&this->x, _mm_add_ps(this->simd(), vec4.simd()));
+
+			return (*this);
+		}
+
+		Vec4	&operator-=(const Vec4 &vec4)
+		{
+			_mm_store_ps(&this->x, _mm_sub_ps(this->simd(), vec4.simd()));
+
+			return (*this);
+		}
+
+		Vec4	&operator*=(const float &value)
+		{
+			_mm_store_ps(&this->x, _mm_mul_ps(this->simd(), _mm_set1_ps(value)));
+
+			return (*this);
+		}
+
+		Vec4	&operator/=(const float &value)
+		{
+			_mm_store_ps(&this->x, _mm_div_ps(this->simd(), _mm_set1_ps(value)));
+
+			return (*this);
+		}
+
+		//---- Compare Operators -----------------------------------------------
+
+		bool	operator==(const Vec4 &vec4) const
+		{
+			return (_mm_movemask_ps(_mm_cmpeq_ps(this->simd(), vec4.simd())) == 0xF);
+		}
+
+		bool	operator!=(const Vec4 &vec4) const
+		{
+			return (_mm_movemask_ps(_mm_cmpeq_ps(this->simd(), vec4.simd())) != 0xF);
+		}
+
+		//---- Unary Operators -------------------------------------------------
+
+		Vec4	operator-(void) const
+		{
+			return (Vec4(_mm_xor_ps(this->simd(), _mm_set1_ps(-0.0f))));
+		}
+
+		//---- Accessor Operators ----------------------------------------------
+
+		/**
+		 * @brief Access values by index.
+		 *
+		 * Index 0 is for x.
+		 * Index 1 is for y.
+		 * Index 2 is for z.
+		 * Index 3 is for w.
+		 *
+		 * @param n Index of the value wanted.
+		 *
+		 * @return The reference to value at the index.
+		 * @warning Checked only if GM_BOUNDS_CHECK is 1, abort when index is greater than 3.
+		 */
+		float	&operator[](unsigned int n) noexcept
+		{
+			GM_ASSERT_BOUNDS(n < 4, "Index out of vec4 bounds");
+
+			return (n == 0 ? this->x : (n == 1 ? this->y : (n == 2 ? this->z : this->w)));
+		}
+
+		/**
+		 * @brief Const access values by index.
+		 *
+		 * Index 0 is for x.
+		 * Index 1 is for y.
+		 * Index 2 is for z.
+		 * Index 3 is for w.
+		 *
+		 * @param n Index of the value wanted.
+		 *
+		 * @return The const reference to value at the index.
+		 * @warning Checked only if GM_BOUNDS_CHECK is 1, abort when index is greater than 3.
+		 */
+		const float	&operator[](unsigned int n) const noexcept
+		{
+			GM_ASSERT_BOUNDS(n < 4, "Index out of vec4 bounds");
+
+			return (n == 0 ? this->x : (n == 1 ? this->y : (n == 2 ? this->z : this->w)));
+		}
+
+		//**** PUBLIC METHODS **************************************************
+		//---- To vec2 ---------------------------------------------------------
+
+		/**
+		 * @brief Create a Vec2 from a subpart of the Vec4.
+		 *
+		 * @return A Vec2 with x and y as value.
+		 */
+		Vec2<float>	xy(void)
+		{
+			return	(Vec2<float>(this->x, this->y));
+		}
+
+		/**
+		 * @brief Create a Vec2 from a subpart of the Vec4.
+		 *
+		 * @return A Vec2 with y and z as value.
+		 */
+		Vec2<float>	yz(void)
+		{
+			return	(Vec2<float>(this->y, this->z));
+		}
+
+		/**
+		 * @brief Create a Vec2 from a subpart of the Vec4.
+		 *
+		 * @return A Vec2 with z and w as value.
+		 */
+		Vec2<float>	zw(void)
+		{
+			return	(Vec2<float>(this->z, this->w));
+		}
+
+		/**
+		 * @brief Create a Vec2 from a subpart of the Vec4.
+		 *
+		 * @return A Vec2 with x and z as value.
+		 */
+		Vec2<float>	xz(void)
+		{
+			return	(Vec2<float>(this->x, this->z));
+		}
+
+		/**
+		 * @brief Create a Vec2 from a subpart of the Vec4.
+		 *
+		 * @return A Vec2 with x and w as value.
+		 */
+		Vec2<float>	xw(void)
+		{
+			return	(Vec2<float>(this->x, this->w));
+		}
+
+		/**
+		 * @brief Create a Vec2 from a subpart of the Vec4.
+		 *
+		 * @return A Vec2 with y and w as value.
+		 */
+		Vec2<float>	yw(void)
+		{
+			return	(Vec2<float>(this->y, this->w));
+		}
+
+		//---- To vec3 ---------------------------------------------------------
+
+		/**
+		 * @brief Create a Vec3 from a subpart of the Vec4.
+		 *
+		 * @return A Vec3 with x, y and z as value.
+		 */
+		Vec3<float>	xyz(void)
+		{
+			return	(Vec3<float>(this->x, this->y, this->z));
+		}
+
+		/**
+		 * @brief Create a Vec3 from a subpart of the Vec4.
+		 *
+		 * @return A Vec3 with y, z and w as value.
+		 */
+		Vec3<float>	yzw(void)
+		{
+			return	(Vec3<float>(this->y, this->z, this->w));
+		}
+
+		/**
+		 * @brief Create a Vec3 from a subpart of the Vec4.
+		 *
+		 * @return A Vec3 with x, z and w as value.
+		 */
+		Vec3<float>	xzw(void)
+		{
+			return	(Vec3<float>(this->x, this->z, this->w));
+		}
+
+	private:
+
+	};
+
+	//---- Vector vector operator ----------------------------------------------
+
+	inline Vec4<float>	operator+(const Vec4<float> &v1, const Vec4<float> &v2)
+	{
+		return (Vec4<float>(_mm_add_ps(v1.simd(), v2.simd())));
+	}
+
+	inline Vec4<float>	operator-(const Vec4<float> &v1, const Vec4<float> &v2)
+	{
+		return (Vec4<float>(_mm_sub_ps(v1.simd(), v2.simd())));
+	}
+
+	//---- Vector value operator -----------------------------------------------
+
+	inline Vec4<float>	operator*(const Vec4<float> &vec4, const float &value)
+	{
+		return (Vec4<float>(_mm_mul_ps(vec4.simd(), _mm_set1_ps(value))));
+	}
+
+	inline Vec4<float>	operator*(const float &value, const Vec4<float> &vec4)
+	{
+		return (Vec4<float>(_mm_mul_ps(vec4.simd(), _mm_set1_ps(value))));
+	}
+
+	inline Vec4<float>	operator/(const Vec4<float> &vec4, const float &value)
+	{
+		return (Vec4<float>(_mm_div_ps(vec4.simd(), _mm_set1_ps(value))));
+	}
+
+	//---- Functions -----------------------------------------------------------
+
+	/**
+	 * @brief Get Vec4 norm.
+	 *
+	 * @param vec4 Vec4 to get the norm.
+	 *
+	 * @return Norm of vec4.
+	 */
+	inline float	norm(const Vec4<float> &vec4)
+	{
+		return (_mm_cvtss_f32(_mm_sqrt_ss(__dot4(vec4.simd(), vec4.simd()))));
+	}
+
+	/**
+	 * @brief Get Vec4 norm squared.
+	 *
+	 * @param vec4 Vec4 to get the norm squared.
+	 *
+	 * @return Norm squared of vec4.
+	 */
+	inline float	norm2(const Vec4<float> &vec4)
+	{
+		return (_mm_cvtss_f32(__dot4(vec4.simd(), vec4.simd())));
+	}
+
+	/**
+	 * @brief Normalize a Vec4.
+	 *
+	 * Exact square root and division, see normalizeFast for the estimate.
+	 *
+	 * @param vec4 Vec4 to normalize.
+	 *
+	 * @return Normalised vec4, or vec4 if it's norm is 0.
+	 */
+	inline Vec4<float>	normalize(const Vec4<float> &vec4)
+	{
+		const __m128	simd = vec4.simd();
+		const __m128	dst = __dot4(simd, simd);
+
+		if (_mm_cvtss_f32(dst) == 0.0f)
+			return (vec4);
+
+		return (Vec4<float>(_mm_div_ps(simd, _mm_sqrt_ps(dst))));
+	}
+
+	/**
+	 * @brief Normalize a Vec4 with an approximated reciprocal square root.
+	 *
+	 * Hardware estimate and one Newton-Raphson step: relative error on each
+	 * component below 4e-7.
+	 *
+	 * @param vec4 Vec4 to normalize, must not be null.
+	 *
+	 * @return Normalised vec4.
+	 */
+	inline Vec4<float>	normalizeFast(const Vec4<float> &vec4)
+	{
+		const __m128	simd = vec4.simd();
+
+		return (Vec4<float>(_mm_mul_ps(simd, __rsqrt(__dot4(simd, simd)))));
+	}
+
+	/**
+	 * @brief Normalize a Vec4 without branch, null if it is too small.
+	 *
+	 * Exact square root and division, the null result is a mask.
+	 *
+	 * @param vec4 Vec4 to normalize.
+	 * @param epsilon Norm under which the result is a null Vec4.
+	 *
+	 * @return Normalised vec4, or a null Vec4 if it's norm is not above epsilon.
+	 */
+	inline Vec4<float>	normalizeSafe(const Vec4<float> &vec4, float epsilon = std::numeric_limits<float>::epsilon())
+	{
+		const __m128	simd = vec4.simd();
+		const __m128	dst = __dot4(simd, simd);
+		const __m128	minDst = _mm_set1_ps(epsilon * epsilon);
+		const __m128	toDiv = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(_mm_max_ps(dst, minDst)));
+
+		return (Vec4<float>(_mm_and_ps(_mm_mul_ps(simd, toDiv), _mm_cmpgt_ps(dst, minDst))));
+	}
+
+	/**
+	 * @brief Dot product between two Vec4.
+	 *
+	 * @param v1 First Vec4.
+	 * @param v2 Second Vec4.
+	 *
+	 * @return Dot product of v1 with v2.
+	 */
+	inline float	dot(const Vec4<float> &v1, const Vec4<float> &v2)
+	{
+#  if defined(GM_USE_FMA) && defined(GM_FMA)
+		return (_mm_cvtss_f32(__fusedDot4(v1.simd(), v2.simd())));
+#  else
+		return (_mm_cvtss_f32(__dot4(v1.simd(), v2.simd())));
+#  endif
+	}
+
+#  ifdef GM_FMA
+	/**
+	 * @brief Fused multiply-add on each component.
+	 *
+	 * @param a First Vec4.
+	 * @param b Second Vec4.
+	 * @param c Vec4 to add.
+	 *
+	 * @return Result of a * b + c with a single rounding per component.
+	 */
+	inline Vec4<float>	fma(const Vec4<float> &a, const Vec4<float> &b, const Vec4<float> &c)
+	{
+		return (Vec4<float>(_mm_fmadd_ps(a.simd(), b.simd(), c.simd())));
+	}
+
+	/**
+	 * @brief Fused multiply-add of a Vec4 by a scalar.
+	 *
+	 * @param a The Vec4.
+	 * @param b The scalar.
+	 * @param c Vec4 to add.
+	 *
+	 * @return Result of a * b + c with a single rounding per component.
+	 */
+	inline Vec4<float>	fma(const Vec4<float> &a, const float &b, const Vec4<float> &c)
+	{
+		return (Vec4<float>(_mm_fmadd_ps(a.simd(), _mm_set1_ps(b), c.simd())));
+	}
+
+#   ifdef GM_USE_FMA
+	inline Vec4<float>	__madd(const Vec4<float> &a, const float &b, const Vec4<float> &c)
+	{
+		return (fma(a, b, c));
+	}
+#   endif
+#  endif
+
+# endif
+
 	//**** STATIC FUNCTIONS ****************************************************
 	//**** USINGS **************************************************************
 	//---- VEC4 ----------------------------------------------------------------
@@ -614,6 +1104,19 @@ namespace gm {
 	 * The class is design to be used with graphic librairy like OpenGL or Vulkan.
 	 */
 	using Point4d = Vec4<double>;
+
+	//**** CHECKS **************************************************************
+
+	static_assert(std::is_trivially_copyable<Vec4u>::value && std::is_trivially_destructible<Vec4u>::value,
+					"Vec4u must be trivially copyable");
+	static_assert(std::is_trivially_copyable<Vec4i>::value && std::is_trivially_destructible<Vec4i>::value,
+					"Vec4i must be trivially copyable");
+	static_assert(std::is_trivially_copyable<Vec4f>::value && std::is_trivially_destructible<Vec4f>::value,
+					"Vec4f must be trivially copyable");
+	static_assert(std::is_trivially_copyable<Vec4d>::value && std::is_trivially_destructible<Vec4d>::value,
+					"Vec4d must be trivially copyable");
+	static_assert(Vec4i(1, 2, 3, 4) + Vec4i(3) * 2 == Vec4i(7, 8, 9, 10),
+					"Vec4 must be constexpr");
 }
 
 #endif
@@ -0,0 +1,475 @@
+#ifndef GM_VEC4_SOA_HPP
+# define GM_VEC4_SOA_HPP
+
+# include <gmath/SoABuffer.hpp>
+# include <gmath/Vec4.hpp>
+
+#include <cstddef>
+#include <iostream>
+
+namespace gm {
+	//**** STATIC FUNCTIONS DEFINE *********************************************
+	//**** CLASS DEFINE ********************************************************
+
+	/**
+	 * @brief Reference to one vector of a Vec4SoA.
+	 *
+	 * @tparam T Type of value in the vector.
+	 *
+	 * Read and write the vector like a Vec4, components are references to
+	 * the Vec4SoA arrays.
+	 */
+	template <typename T>
+	class Vec4SoARef
+	{
+	public:
+		T	&x;
+		T	&y;
+		T	&z;
+		T	&w;
+
+		//**** INITIALISION ****************************************************
+		//---- Constructors ----------------------------------------------------
+
+		/**
+		 * @brief Constructor of Vec4SoARef class.
+		 *
+		 * @param x Reference to x value.
+		 * @param y Reference to y value.
+		 * @param z Reference to z value.
+		 * @param w Reference to w value.
+		 *
+		 * @return The Vec4SoARef on x, y, z and w.
+		 */
+		Vec4SoARef(T &x, T &y, T &z, T &w) : x(x), y(y), z(z), w(w) {}
+
+		/**
+		 * @brief Copy constructor of Vec4SoARef class.
+		 *
+		 * @param ref The Vec4SoARef to copy.
+		 *
+		 * @return The Vec4SoARef on same values than parameter.
+		 */
+		Vec4SoARef(const Vec4SoARef &ref) : x(ref.x), y(ref.y), z(ref.z), w(ref.w) {}
+
+		//**** OPERATORS *******************************************************
+		//---- Copy operator ---------------------------------------------------
+
+		/**
+		 * @brief Copy the values of another vector of a Vec4SoA.
+		 *
+		 * @param ref The Vec4SoARef to copy values.
+		 *
+		 * @return Reference to the Vec4SoARef.
+		 */
+		Vec4SoARef	&operator=(const Vec4SoARef &ref)
+		{
+			return (*this = Vec4<T>(ref));
+		}
+
+		/**
+		 * @brief Copy the values of a Vec4.
+		 *
+		 * @param vec4 The Vec4 to copy.
+		 *
+		 * @return Reference to the Vec4SoARef.
+		 */
+		Vec4SoARef	&operator=(const Vec4<T> &vec4)
+		{
+			this->x = vec4.x;
+			this->y = vec4.y;
+			this->z = vec4.z;
+			this->w = vec4.w;
+			return (*this);
+		}
+
+		//---- Arithmetic operators --------------------------------------------
+
+		/**
+		 * @brief Add a Vec4 to the vector.
+		 *
+		 * @param vec4 The Vec4 to add.
+		 *
+		 * @return Reference to the Vec4SoARef.
+		 */
+		Vec4SoARef	&operator+=(const Vec4<T> &vec4)
+		{
+			this->x += vec4.x;
+			this->y += vec4.y;
+			this->z += vec4.z;
+			this->w += vec4.w;
+			return (*this);
+		}
+
+		/**
+		 * @brief Subtract a Vec4 to the vector.
+		 *
+		 * @param vec4 The Vec4 to subtract.
+		 *
+		 * @return Reference to the Vec4SoARef.
+		 */
+		Vec4SoARef	&operator-=(const Vec4<T> &vec4)
+		{
+			this->x -= vec4.x;
+			this->y -= vec4.y;
+			this->z -= vec4.z;
+			this->w -= vec4.w;
+			return (*this);
+		}
+
+		/**
+		 * @brief Multiply the vector by a value.
+		 *
+		 * @param value The value to multiply.
+		 *
+		 * @return Reference to the Vec4SoARef.
+		 */
+		Vec4SoARef	&operator*=(const T &value)
+		{
+			this->x *= value;
+			this->y *= value;
+			this->z *= value;
+			this->w *= value;
+			return (*this);
+		}
+
+		/**
+		 * @brief Divide the vector by a value.
+		 *
+		 * @param value The value to divide.
+		 *
+		 * @return Reference to the Vec4SoARef.
+		 */
+		Vec4SoARef	&operator/=(const T &value)
+		{
+			this->x /= value;
+			this->y /= value;
+			this->z /= value;
+			this->w /= value;
+			return (*this);
+		}
+
+		//---- Compare Operators -----------------------------------------------
+
+		bool	operator==(const Vec4<T> &vec4) const
+		{
+			return (Vec4<T>(*this) == vec4);
+		}
+
+		bool	operator!=(const Vec4<T> &vec4) const
+		{
+			return (Vec4<T>(*this) != vec4);
+		}
+
+		//---- Unary Operators -------------------------------------------------
+
+		Vec4<T>	operator-(void) const
+		{
+			return (-Vec4<T>(*this));
+		}
+
+		//---- Cast operator ---------------------------------------------------
+
+		/**
+		 * @brief Get the values as a Vec4.
+		 *
+		 * @return The Vec4 with the referenced values.
+		 */
+		operator Vec4<T>(void) const
+		{
+			return (Vec4<T>(this->x, this->y, this->z, this->w));
+		}
+	};
+
+	/**
+	 * @brief Class for 4d vectors stored as structure of arrays.
+	 *
+	 * @tparam T Type of value in the vectors.
+	 *
+	 * x, y, z and w values are stored in four aligned arrays, so operations on
+	 * all vectors run at full simd width. Bulk operations (add, sub, scale,
+	 * dot, norm, normalize) are in SoABuffer.hpp.
+	 */
+	template <typename T>
+	class Vec4SoA : public SoABuffer<T, 4>
+	{
+	public:
+		//**** INITIALISION ****************************************************
+		//---- Constructors ----------------------------------------------------
+
+		/**
+		 * @brief Default constructor of Vec4SoA class.
+		 *
+		 * @return The Vec4SoA without vectors.
+		 */
+		Vec4SoA(void) : SoABuffer<T, 4>() {}
+
+		/**
+		 * @brief Constructor of Vec4SoA class.
+		 *
+		 * @param size Number of vectors.
+		 *
+		 * @return The Vec4SoA with size vectors at 0.
+		 */
+		explicit Vec4SoA(std::size_t size) : SoABuffer<T, 4>(size) {}
+
+		/**
+		 * @brief Constructor of Vec4SoA class from an array of Vec4.
+		 *
+		 * @param vecs The Vec4 array.
+		 * @param size Number of Vec4 in array.
+		 *
+		 * @return The Vec4SoA with the vectors of array.
+		 */
+		Vec4SoA(const Vec4<T> *vecs, std::size_t size) : SoABuffer<T, 4>(size)
+		{
+			for (std::size_t i = 0; i < size; i++)
+				(*this)[i] = vecs[i];
+		}
+
+		//**** ACCESSORS *******************************************************
+		//---- Getters ---------------------------------------------------------
+
+		/**
+		 * @brief Get the array of x values.
+		 *
+		 * @return Pointer to size values.
+		 */
+		T	*getX(void) { return (this->data); }
+		const T	*getX(void) const { return (this->data); }
+
+		/**
+		 * @brief Get the array of y values.
+		 *
+		 * @return Pointer to size values.
+		 */
+		T	*getY(void) { return (this->data + this->cap); }
+		const T	*getY(void) const { return (this->data + this->cap); }
+
+		/**
+		 * @brief Get the array of z values.
+		 *
+		 * @return Pointer to size values.
+		 */
+		T	*getZ(void) { return (this->data + 2 * this->cap); }
+		const T	*getZ(void) const { return (this->data + 2 * this->cap); }
+
+		/**
+		 * @brief Get the array of w values.
+		 *
+		 * @return Pointer to size values.
+		 */
+		T	*getW(void) { return (this->data + 3 * this->cap); }
+		const T	*getW(void) const { return (this->data + 3 * this->cap); }
+
+		//**** OPERATORS *******************************************************
+		//---- Access operators ------------------------------------------------
+
+		/**
+		 * @brief Access to a vector.
+		 *
+		 * @param i Index of the vector.
+		 *
+		 * @return Reference to the vector, usable as a Vec4.
+		 *
+		 * @warning Checked only if GM_BOUNDS_CHECK is 1, abort when i >= size.
+		 */
+		Vec4SoARef<T>	operator[](std::size_t i) noexcept
+		{
+			GM_ASSERT_BOUNDS(i < this->count, "Index out of vec4 soa bounds");
+			return (Vec4SoARef<T>(this->getX()[i], this->getY()[i], this->getZ()[i], this->getW()[i]));
+		}
+
+		/**
+		 * @brief Get a vector.
+		 *
+		 * @param i Index of the vector.
+		 *
+		 * @return Copy of the vector.
+		 *
+		 * @warning Checked only if GM_BOUNDS_CHECK is 1, abort when i >= size.
+		 */
+		Vec4<T>	operator[](std::size_t i) const noexcept
+		{
+			GM_ASSERT_BOUNDS(i < this->count, "Index out of vec4 soa bounds");
+			return (Vec4<T>(this->getX()[i], this->getY()[i], this->getZ()[i], this->getW()[i]));
+		}
+
+		//**** PUBLIC METHODS **************************************************
+
+		/**
+		 * @brief Add a vector at the end.
+		 *
+		 * @param vec4 The vector to add.
+		 */
+		void	pushBack(const Vec4<T> &vec4)
+		{
+			const std::size_t	i = this->grow();
+
+			this->getX()[i] = vec4.x;
+			this->getY()[i] = vec4.y;
+			this->getZ()[i] = vec4.z;
+			this->getW()[i] = vec4.w;
+		}
+	};
+
+	//**** EXTERNS OPERATORS ***************************************************
+	//---- Print operator ------------------------------------------------------
+
+	template <typename T>
+	std::ostream	&operator<<(std::ostream &os, const Vec4SoARef<T> &ref)
+	{
+		os << Vec4<T>(ref);
+		return (os);
+	}
+
+	//---- Vector vector operator ----------------------------------------------
+	// The operators of Vec4 are templates, the proxy is not converted when
+	// deducing T
+
+	template <typename T>
+	Vec4<T>	operator+(const Vec4SoARef<T> &ref, const Vec4<T> &vec4)
+	{
+		return (Vec4<T>(ref) + vec4);
+	}
+
+	template <typename T>
+	Vec4<T>	operator+(const Vec4<T> &vec4, const Vec4SoARef<T> &ref)
+	{
+		return (vec4 + Vec4<T>(ref));
+	}
+
+	template <typename T>
+	Vec4<T>	operator+(const Vec4SoARef<T> &r1, const Vec4SoARef<T> &r2)
+	{
+		return (Vec4<T>(r1) + Vec4<T>(r2));
+	}
+
+	template <typename T>
+	Vec4<T>	operator-(const Vec4SoARef<T> &ref, const Vec4<T> &vec4)
+	{
+		return (Vec4<T>(ref) - vec4);
+	}
+
+	template <typename T>
+	Vec4<T>	operator-(const Vec4<T> &vec4, const Vec4SoARef<T> &ref)
+	{
+		return (vec4 - Vec4<T>(ref));
+	}
+
+	template <typename T>
+	Vec4<T>	operator-(const Vec4SoARef<T> &r1, const Vec4SoARef<T> &r2)
+	{
+		return (Vec4<T>(r1) - Vec4<T>(r2));
+	}
+
+	//---- Vector value operator -----------------------------------------------
+
+	template <typename T>
+	Vec4<T>	operator*(const Vec4SoARef<T> &ref, const T &value)
+	{
+		return (Vec4<T>(ref) * value);
+	}
+
+	template <typename T>
+	Vec4<T>	operator*(const T &value, const Vec4SoARef<T> &ref)
+	{
+		return (value * Vec4<T>(ref));
+	}
+
+	template <typename T>
+	Vec4<T>	operator/(const Vec4SoARef<T> &ref, const T &value)
+	{
+		return (Vec4<T>(ref) / value);
+	}
+
+	//**** FUNCTIONS ***********************************************************
+
+	/**
+	 * @brief Norm of a vector of a Vec4SoA, same as with a Vec4.
+	 *
+	 * @param ref The vector of the Vec4SoA.
+	 *
+	 * @return The norm.
+	 */
+	template <typename T>
+	T	norm(const Vec4SoARef<T> &ref)
+	{
+		return (norm(Vec4<T>(ref)));
+	}
+
+	/**
+	 * @brief Norm squared of a vector of a Vec4SoA, same as with a Vec4.
+	 *
+	 * @param ref The vector of the Vec4SoA.
+	 *
+	 * @return The norm squared.
+	 */
+	template <typename T>
+	T	norm2(const Vec4SoARef<T> &ref)
+	{
+		return (norm2(Vec4<T>(ref)));
+	}
+
+	/**
+	 * @brief Normalize a vector of a Vec4SoA, same as with a Vec4.
+	 *
+	 * @param ref The vector of the Vec4SoA.
+	 *
+	 * @return Normalised copy of the vector, or the vector if it's norm is 0.
+	 */
+	template <typename T>
+	Vec4<T>	normalize(const Vec4SoARef<T> &ref)
+	{
+		return (normalize(Vec4<T>(ref)));
+	}
+
+	/**
+	 * @brief Dot product with a vector of a Vec4SoA, same as with a Vec4.
+	 *
+	 * @param ref The vector of the Vec4SoA.
+	 * @param vec4 The other vector.
+	 *
+	 * @return Dot product of the vectors.
+	 */
+	template <typename T>
+	T	dot(const Vec4SoARef<T> &ref, const Vec4<T> &vec4)
+	{
+		return (dot(Vec4<T>(ref), vec4));
+	}
+
+	template <typename T>
+	T	dot(const Vec4<T> &vec4, const Vec4SoARef<T> &ref)
+	{
+		return (dot(vec4, Vec4<T>(ref)));
+	}
+
+	template <typename T>
+	T	dot(const Vec4SoARef<T> &r1, const Vec4SoARef<T> &r2)
+	{
+		return (dot(Vec4<T>(r1), Vec4<T>(r2)));
+	}
+
+	//**** USINGS **************************************************************
+	//---- VEC4SOA -------------------------------------------------------------
+
+	/**
+	 * @brief Class for 4d unsigned int vectors stored as structure of arrays.
+	 */
+	using Vec4SoAu = Vec4SoA<unsigned int>;
+	/**
+	 * @brief Class for 4d int vectors stored as structure of arrays.
+	 */
+	using Vec4SoAi = Vec4SoA<int>;
+	/**
+	 * @brief Class for 4d float vectors stored as structure of arrays, bulk
+	 * operations use simd kernels.
+	 */
+	using Vec4SoAf = Vec4SoA<float>;
+	/**
+	 * @brief Class for 4d double vectors stored as structure of arrays.
+	 */
+	using Vec4SoAd = Vec4SoA<double>;
+}
+
+#endif
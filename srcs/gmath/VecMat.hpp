@@ -20,13 +20,13 @@ namespace gm {
 	 *
 	 * @result Result of mat2 * vec2.
 	 */
-	template <typename T>
-	Vec2<T>	operator*(const Mat2<T> &mat2, const Vec2<T> &vec2)
+	template <typename T, class L>
+	constexpr Vec2<T>	operator*(const Mat2<T, L> &mat2, const Vec2<T> &vec2)
 	{
 		Vec2<T>	res;
 
-		res.x = mat2.values[0] * vec2.x + mat2.values[1] * vec2.y;
-		res.y = mat2.values[2] * vec2.x + mat2.values[3] * vec2.y;
+		res.x = __dot(mat2.at(0, 0), vec2.x, mat2.at(1, 0), vec2.y);
+		res.y = __dot(mat2.at(0, 1), vec2.x, mat2.at(1, 1), vec2.y);
 
 		return (res);
 	}
@@ -39,13 +39,13 @@ namespace gm {
 	 *
 	 * @result Result of mat2 * vec2.
 	 */
-	template <typename T>
-	Vec2<T>	operator*(const Vec2<T> &vec2, const Mat2<T> &mat2)
+	template <typename T, class L>
+	constexpr Vec2<T>	operator*(const Vec2<T> &vec2, const Mat2<T, L> &mat2)
 	{
 		Vec2<T>	res;
 
-		res.x = mat2.values[0] * vec2.x + mat2.values[1] * vec2.y;
-		res.y = mat2.values[2] * vec2.x + mat2.values[3] * vec2.y;
+		res.x = __dot(mat2.at(0, 0), vec2.x, mat2.at(1, 0), vec2.y);
+		res.y = __dot(mat2.at(0, 1), vec2.x, mat2.at(1, 1), vec2.y);
 
 		return (res);
 	}
@@ -60,14 +60,14 @@ namespace gm {
 	 *
 	 * @result Result of mat3 * vec3.
 	 */
-	template <typename T>
-	Vec3<T>	operator*(const Mat3<T> &mat3, const Vec3<T> &vec3)
+	template <typename T, class L>
+	constexpr Vec3<T>	operator*(const Mat3<T, L> &mat3, const Vec3<T> &vec3)
 	{
 		Vec3<T>	res;
 
-		res.x = mat3.values[0] * vec3.x + mat3.values[1] * vec3.y + mat3.values[2] * vec3.z;
-		res.y = mat3.values[3] * vec3.x + mat3.values[4] * vec3.y + mat3.values[5] * vec3.z;
-		res.z = mat3.values[6] * vec3.x + mat3.values[7] * vec3.y + mat3.values[8] * vec3.z;
+		res.x = __dot(mat3.at(0, 0), vec3.x, mat3.at(1, 0), vec3.y, mat3.at(2, 0), vec3.z);
+		res.y = __dot(mat3.at(0, 1), vec3.x, mat3.at(1, 1), vec3.y, mat3.at(2, 1), vec3.z);
+		res.z = __dot(mat3.at(0, 2), vec3.x, mat3.at(1, 2), vec3.y, mat3.at(2, 2), vec3.z);
 
 		return (res);
 	}
@@ -80,14 +80,14 @@ namespace gm {
 	 *
 	 * @result Result of mat3 * vec3.
 	 */
-	template <typename T>
-	Vec3<T>	operator*(const Vec3<T> &vec3, const Mat3<T> &mat3)
+	template <typename T, class L>
+	constexpr Vec3<T>	operator*(const Vec3<T> &vec3, const Mat3<T, L> &mat3)
 	{
 		Vec3<T>	res;
 
-		res.x = mat3.values[0] * vec3.x + mat3.values[1] * vec3.y + mat3.values[2] * vec3.z;
-		res.y = mat3.values[3] * vec3.x + mat3.values[4] * vec3.y + mat3.values[5] * vec3.z;
-		res.z = mat3.values[6] * vec3.x + mat3.values[7] * vec3.y + mat3.values[8] * vec3.z;
+		res.x = __dot(mat3.at(0, 0), vec3.x, mat3.at(1, 0), vec3.y, mat3.at(2, 0), vec3.z);
+		res.y = __dot(mat3.at(0, 1), vec3.x, mat3.at(1, 1), vec3.y, mat3.at(2, 1), vec3.z);
+		res.z = __dot(mat3.at(0, 2), vec3.x, mat3.at(1, 2), vec3.y, mat3.at(2, 2), vec3.z);
 
 		return (res);
 	}
@@ -102,15 +102,15 @@ namespace gm {
 	 *
 	 * @result Result of mat4 * vec4.
 	 */
-	template <typename T>
-	Vec4<T>	operator*(const Mat4<T> &mat4, const Vec4<T> &vec4)
+	template <typename T, class L>
+	constexpr Vec4<T>	operator*(const Mat4<T, L> &mat4, const Vec4<T> &vec4)
 	{
 		Vec4<T>	res;
 
-		res.x = mat4.values[ 0] * vec4.x + mat4.values[ 1] * vec4.y + mat4.values[ 2] * vec4.z + mat4.values[ 3] * vec4.z;
-		res.y = mat4.values[ 4] * vec4.x + mat4.values[ 5] * vec4.y + mat4.values[ 6] * vec4.z + mat4.values[ 7] * vec4.z;
-		res.z = mat4.values[ 8] * vec4.x + mat4.values[ 9] * vec4.y + mat4.values[10] * vec4.z + mat4.values[11] * vec4.z;
-		res.w = mat4.values[12] * vec4.x + mat4.values[13] * vec4.y + mat4.values[14] * vec4.z + mat4.values[15] * vec4.z;
+		res.x = __dot(mat4.at(0, 0), vec4.x, mat4.at(1, 0), vec4.y, mat4.at(2, 0), vec4.z, mat4.at(3, 0), vec4.w);
+		res.y = __dot(mat4.at(0, 1), vec4.x, mat4.at(1, 1), vec4.y, mat4.at(2, 1), vec4.z, mat4.at(3, 1), vec4.w);
+		res.z = __dot(mat4.at(0, 2), vec4.x, mat4.at(1, 2), vec4.y, mat4.at(2, 2), vec4.z, mat4.at(3, 2), vec4.w);
+		res.w = __dot(mat4.at(0, 3), vec4.x, mat4.at(1, 3), vec4.y, mat4.at(2, 3), vec4.z, mat4.at(3, 3), vec4.w);
 
 		return (res);
 	}
@@ -123,20 +123,43 @@ namespace gm {
 	 *
 	 * @result Result of mat4 * vec4.
 	 */
-	template <typename T>
-	Vec4<T>	operator*(const Vec4<T> &vec4, const Mat4<T> &mat4)
+	template <typename T, class L>
+	constexpr Vec4<T>	operator*(const Vec4<T> &vec4, const Mat4<T, L> &mat4)
 	{
 		Vec4<T>	res;
 
-		res.x = mat4.values[ 0] * vec4.x + mat4.values[ 1] * vec4.y + mat4.values[ 2] * vec4.z + mat4.values[ 3] * vec4.z;
-		res.y = mat4.values[ 4] * vec4.x + mat4.values[ 5] * vec4.y + mat4.values[ 6] * vec4.z + mat4.values[ 7] * vec4.z;
-		res.z = mat4.values[ 8] * vec4.x + mat4.values[ 9] * vec4.y + mat4.values[10] * vec4.z + mat4.values[11] * vec4.z;
-		res.w = mat4.values[12] * vec4.x + mat4.values[13] * vec4.y + mat4.values[14] * vec4.z + mat4.values[15] * vec4.z;
+		res.x = __dot(mat4.at(0, 0), vec4.x, mat4.at(1, 0), vec4.y, mat4.at(2, 0), vec4.z, mat4.at(3, 0), vec4.w);
+		res.y = __dot(mat4.at(0, 1), vec4.x, mat4.at(1, 1), vec4.y, mat4.at(2, 1), vec4.z, mat4.at(3, 1), vec4.w);
+		res.z = __dot(mat4.at(0, 2), vec4.x, mat4.at(1, 2), vec4.y, mat4.at(2, 2), vec4.z, mat4.at(3, 2), vec4.w);
+		res.w = __dot(mat4.at(0, 3), vec4.x, mat4.at(1, 3), vec4.y, mat4.at(2, 3), vec4.z, mat4.at(3, 3), vec4.w);
 
 		return (res);
 	}
 
 	//**** VECTOR ROTATE *******************************************************
+	// Rotations are computed directly from the cosinus and sinus, without
+	// building a matrix. Same results as the Mat2, Mat3 and Mat4 rotations.
+
+	/**
+	 * @brief Internal function for rotate. Rodrigues rotation formula.
+	 *
+	 * @param vec3 The Vec3 to rotate.
+	 * @param axis Normalized axis of the rotation.
+	 * @param tmpCos Cosinus of the angle.
+	 * @param tmpSin Sinus of the angle.
+	 *
+	 * @return vec3 * cos + cross(axis, vec3) * sin + axis * dot(axis, vec3) * (1 - cos).
+	 */
+	template <typename T>
+	constexpr Vec3<T>	__rodrigues(const Vec3<T> &vec3, const Vec3<T> &axis, T tmpCos, T tmpSin)
+	{
+		const T	projection = (axis.x * vec3.x + axis.y * vec3.y + axis.z * vec3.z) * (static_cast<T>(1) - tmpCos);
+
+		return (Vec3<T>(vec3.x * tmpCos + (axis.y * vec3.z - axis.z * vec3.y) * tmpSin + axis.x * projection,
+						vec3.y * tmpCos + (axis.z * vec3.x - axis.x * vec3.z) * tmpSin + axis.y * projection,
+						vec3.z * tmpCos + (axis.x * vec3.y - axis.y * vec3.x) * tmpSin + axis.z * projection));
+	}
+
 	//---- Vec2 ----------------------------------------------------------------
 
 	/**
@@ -150,9 +173,12 @@ namespace gm {
 	template <typename T>
 	Vec2<T>	rotate(const Vec2<T> &vec2, T radians)
 	{
-		const Mat2<T>	matRot = Mat2<T>::rotation(radians);
+		T	tmpCos;
+		T	tmpSin;
+
+		__sincos(radians, tmpSin, tmpCos);
 
-		return (matRot * vec2);
+		return (Vec2<T>(vec2.x * tmpCos - vec2.y * tmpSin, vec2.x * tmpSin + vec2.y * tmpCos));
 	}
 
 	/**
@@ -167,9 +193,7 @@ namespace gm {
 	template <typename T>
 	Vec2<T>	rotateArround(const Vec2<T> &vec2, const Vec2<T> &point, T radians)
 	{
-		const Mat2<T>	matRot = Mat2<T>::rotation(radians);
-
-		return ((matRot * (vec2 - point)) + point);
+		return (rotate(vec2 - point, radians) + point);
 	}
 
 	//---- Vec3 ----------------------------------------------------------------
@@ -186,9 +210,12 @@ namespace gm {
 	template <typename T>
 	Vec3<T>	rotate(const Vec3<T> &vec3, const Vec3<T> &axis, T radians)
 	{
-		const Mat3<T>	matRot = Mat3<T>::rotation(axis, radians);
+		T	tmpCos;
+		T	tmpSin;
 
-		return (matRot * vec3);
+		__sincos(static_cast<T>(-radians), tmpSin, tmpCos);
+
+		return (__rodrigues(vec3, axis, tmpCos, tmpSin));
 	}
 
 	/**
@@ -204,9 +231,7 @@ namespace gm {
 	template <typename T>
 	Vec3<T>	rotateArround(const Vec3<T> &vec3, const Vec3<T> &point, const Vec3<T> &axis, T radians)
 	{
-		const Mat3<T>	matRot = Mat3<T>::rotation(axis, radians);
-
-		return ((matRot * (vec3 - point)) + point);
+		return (rotate(vec3 - point, axis, radians) + point);
 	}
 
 	//---- Vec4 ----------------------------------------------------------------
@@ -218,14 +243,14 @@ namespace gm {
 	 * @param axis Vec3 to tell on wich axis the rotation will be done. It must be normalized.
 	 * @param radians The angle in radians.
 	 *
-	 * @return Vec4 rotate by axis and angle in radians in 3D.
+	 * @return Vec4 rotate by axis and angle in radians in 3D, w is unchanged.
 	 */
 	template <typename T>
 	Vec4<T>	rotate(const Vec4<T> &vec4, const Vec3<T> &axis, T radians)
 	{
-		const Mat4<T>	matRot = Mat4<T>::rotation(axis, radians);
+		const Vec3<T>	res = rotate(Vec3<T>(vec4.x, vec4.y, vec4.z), axis, radians);
 
-		return (matRot * vec4);
+		return (Vec4<T>(res.x, res.y, res.z, vec4.w));
 	}
 
 	/**
@@ -236,14 +261,14 @@ namespace gm {
 	 * @param axis Vec3 to tell on wich axis the rotation will be done. It must be normalized.
 	 * @param radians The angle in radians.
 	 *
-	 * @return Vec4 rotate by axis and angle in radians arround point in 3D.
+	 * @return Vec4 rotate by axis and angle in radians arround point in 3D, w is unchanged.
 	 */
 	template <typename T>
 	Vec4<T>	rotateArround(const Vec4<T> &vec4, const Vec4<T> &point, const Vec3<T> &axis, T radians)
 	{
-		const Mat4<T>	matRot = Mat4<T>::rotation(axis, radians);
+		const Vec3<T>	res = rotate(Vec3<T>(vec4.x - point.x, vec4.y - point.y, vec4.z - point.z), axis, radians);
 
-		return ((matRot * (vec4 - point)) + point);
+		return (Vec4<T>(res.x + point.x, res.y + point.y, res.z + point.z, vec4.w));
 	}
 }
 
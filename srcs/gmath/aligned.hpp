@@ -0,0 +1,101 @@
+#ifndef GM_ALIGNED_HPP
+# define GM_ALIGNED_HPP
+
+# include <gmath/Vec4.hpp>
+# include <gmath/Mat3.hpp>
+# include <gmath/Mat4.hpp>
+# include <gmath/memory.hpp>
+
+# include <cstddef>
+# include <type_traits>
+
+namespace gm {
+	//**** CLASS DEFINE ********************************************************
+
+	/**
+	 * @brief Vector or matrix aligned on A bytes.
+	 *
+	 * @tparam V The vector or matrix type.
+	 * @tparam A Alignment, a power of two not below the alignment of V.
+	 *
+	 * Same members and operators as V, results of operators are V and
+	 * convert back implicitly. A Mat4f aligned on 64 bytes is one cache line,
+	 * on 32 bytes two avx registers. Size is rounded up to A, so arrays keep
+	 * every element aligned.
+	 *
+	 * @warning An array of Aligned can be given where an array of V is
+	 * waited only if both sizes are equal, not for Mat3fA.
+	 */
+	template <typename V, std::size_t A>
+	class alignas(A) Aligned : public V
+	{
+		static_assert(A != 0 && (A & (A - 1)) == 0, "Aligned alignment must be a power of two");
+		static_assert(A >= alignof(V), "Aligned alignment must not be below the alignment of V");
+	public:
+		using V::V;
+
+		//**** INITIALISION ****************************************************
+		//---- Constructors ----------------------------------------------------
+
+		/**
+		 * @brief Default constructor of Aligned class.
+		 *
+		 * @return The default V.
+		 */
+		constexpr Aligned(void) : V() {}
+
+		/**
+		 * @brief Constructor of Aligned class from V.
+		 *
+		 * @param value The value to copy.
+		 *
+		 * @return The aligned copy of value.
+		 */
+		constexpr Aligned(const V &value) : V(value) {}
+	};
+
+	//**** USINGS **************************************************************
+
+	/**
+	 * @brief Vec4 float aligned on 16 bytes, also without GM_SSE2.
+	 */
+	using Vec4fA = Aligned<Vec4<float>, 16>;
+
+	/**
+	 * @brief Vec4 double aligned on 32 bytes, one avx register.
+	 */
+	using Vec4dA = Aligned<Vec4<double>, 32>;
+
+	/**
+	 * @brief Mat3 float aligned on 16 bytes, 48 bytes long.
+	 */
+	using Mat3fA = Aligned<Mat3<float>, 16>;
+
+	/**
+	 * @brief Mat4 float aligned on 64 bytes, one cache line.
+	 */
+	using Mat4fA = Aligned<Mat4<float>, 64>;
+
+	/**
+	 * @brief Mat4 double aligned on 64 bytes, two cache lines.
+	 */
+	using Mat4dA = Aligned<Mat4<double>, 64>;
+
+	//**** CHECKS **************************************************************
+	// Arrays of aligned types are given to the batch functions of the base
+	// type, so the size must not change when it's already a multiple of A.
+
+	static_assert(alignof(Vec4fA) == 16 && alignof(Vec4dA) == 32 && alignof(Mat3fA) == 16
+					&& alignof(Mat4fA) == 64 && alignof(Mat4dA) == 64,
+					"aligned types must have their alignment");
+	static_assert(sizeof(Vec4fA) == sizeof(Vec4<float>) && sizeof(Vec4dA) == sizeof(Vec4<double>)
+					&& sizeof(Mat4fA) == sizeof(Mat4<float>)
+					&& sizeof(Mat4dA) == sizeof(Mat4<double>),
+					"aligned types must be usable as arrays of their base type");
+	static_assert(std::is_trivially_copyable<Mat4fA>::value && std::is_trivially_copyable<Mat3fA>::value,
+					"aligned types must be trivially copyable");
+	static_assert(GM_SIMD_ALIGNMENT % alignof(Mat4fA) == 0,
+					"Buffer of aligned types must keep the default alignment");
+}
+
+#endif
@@ -0,0 +1,165 @@
+#ifndef GM_BATCH_HPP
+# define GM_BATCH_HPP
+
+# include <gmath/dispatch.hpp>
+# include <gmath/memory.hpp>
+
+# include <cstddef>
+
+//**** FUNCTIONS ***************************************************************
+
+namespace gm {
+	/**
+	 * @brief Add two float arrays, with the best simd level of the cpu.
+	 *
+	 * @param a First array.
+	 * @param b Second array.
+	 * @param res Result array, can be a or b.
+	 * @param count Number of values in arrays.
+	 */
+	inline void	add(const float *a, const float *b, float *res, std::size_t count)
+	{
+		kernels().add(a, b, res, count);
+	}
+
+	/**
+	 * @brief Subtract two float arrays, with the best simd level of the cpu.
+	 *
+	 * @param a First array.
+	 * @param b Second array, subtracted to a.
+	 * @param res Result array, can be a or b.
+	 * @param count Number of values in arrays.
+	 */
+	inline void	sub(const float *a, const float *b, float *res, std::size_t count)
+	{
+		kernels().sub(a, b, res, count);
+	}
+
+	/**
+	 * @brief Multiply two float arrays value by value, with the best simd
+	 * level of the cpu.
+	 *
+	 * @param a First array.
+	 * @param b Second array.
+	 * @param res Result array, can be a or b.
+	 * @param count Number of values in arrays.
+	 */
+	inline void	mul(const float *a, const float *b, float *res, std::size_t count)
+	{
+		kernels().mul(a, b, res, count);
+	}
+
+	/**
+	 * @brief Multiply a float array by a value, with the best simd level of
+	 * the cpu.
+	 *
+	 * @param a The array.
+	 * @param value The value to multiply.
+	 * @param res Result array, can be a.
+	 * @param count Number of values in arrays.
+	 */
+	inline void	scale(const float *a, float value, float *res, std::size_t count)
+	{
+		kernels().scale(a, value, res, count);
+	}
+
+	/**
+	 * @brief Compute a * value + b on float arrays, with the best simd level
+	 * of the cpu.
+	 *
+	 * @param a The array to multiply.
+	 * @param value The value to multiply.
+	 * @param b The array to add.
+	 * @param res Result array, can be a or b.
+	 * @param count Number of values in arrays.
+	 */
+	inline void	madd(const float *a, float value, const float *b, float *res, std::size_t count)
+	{
+		kernels().madd(a, value, b, res, count);
+	}
+
+	//---- Buffers -------------------------------------------------------------
+	// Same functions on Buffer, res is resized to the size of a. The
+	// alignment is checked at compile time.
+
+	/**
+	 * @brief Add two float Buffers, with the best simd level of the cpu.
+	 *
+	 * @exception Throw an exception if a and b have different sizes.
+	 */
+	template <std::size_t A, std::size_t B, std::size_t R>
+	void	add(const Buffer<float, A> &a, const Buffer<float, B> &b, Buffer<float, R> &res)
+	{
+		__checkBatchBuffer<A>();
+		__checkBatchBuffer<B>();
+		__checkBatchBuffer<R>();
+		__checkBatchSize(a.size(), b.size());
+		res.resize(a.size());
+		add(a.data(), b.data(), res.data(), a.size());
+	}
+
+	/**
+	 * @brief Subtract two float Buffers, with the best simd level of the cpu.
+	 *
+	 * @exception Throw an exception if a and b have different sizes.
+	 */
+	template <std::size_t A, std::size_t B, std::size_t R>
+	void	sub(const Buffer<float, A> &a, const Buffer<float, B> &b, Buffer<float, R> &res)
+	{
+		__checkBatchBuffer<A>();
+		__checkBatchBuffer<B>();
+		__checkBatchBuffer<R>();
+		__checkBatchSize(a.size(), b.size());
+		res.resize(a.size());
+		sub(a.data(), b.data(), res.data(), a.size());
+	}
+
+	/**
+	 * @brief Multiply two float Buffers value by value, with the best simd
+	 * level of the cpu.
+	 *
+	 * @exception Throw an exception if a and b have different sizes.
+	 */
+	template <std::size_t A, std::size_t B, std::size_t R>
+	void	mul(const Buffer<float, A> &a, const Buffer<float, B> &b, Buffer<float, R> &res)
+	{
+		__checkBatchBuffer<A>();
+		__checkBatchBuffer<B>();
+		__checkBatchBuffer<R>();
+		__checkBatchSize(a.size(), b.size());
+		res.resize(a.size());
+		mul(a.data(), b.data(), res.data(), a.size());
+	}
+
+	/**
+	 * @brief Multiply a float Buffer by a value, with the best simd level of
+	 * the cpu.
+	 */
+	template <std::size_t A, std::size_t R>
+	void	scale(const Buffer<float, A> &a, float value, Buffer<float, R> &res)
+	{
+		__checkBatchBuffer<A>();
+		__checkBatchBuffer<R>();
+		res.resize(a.size());
+		scale(a.data(), value, res.data(), a.size());
+	}
+
+	/**
+	 * @brief Compute a * value + b on float Buffers, with the best simd level
+	 * of the cpu.
+	 *
+	 * @exception Throw an exception if a and b have different sizes.
+	 */
+	template <std::size_t A, std::size_t B, std::size_t R>
+	void	madd(const Buffer<float, A> &a, float value, const Buffer<float, B> &b, Buffer<float, R> &res)
+	{
+		__checkBatchBuffer<A>();
+		__checkBatchBuffer<B>();
+		__checkBatchBuffer<R>();
+		__checkBatchSize(a.size(), b.size());
+		res.resize(a.size());
+		madd(a.data(), value, b.data(), res.data(), a.size());
+	}
+}
+
+#endif
@@ -0,0 +1,352 @@
+#ifndef GM_BLOCK_LAYOUT_HPP
+# define GM_BLOCK_LAYOUT_HPP
+
+# include <gmath/Vec2.hpp>
+# include <gmath/Vec3.hpp>
+# include <gmath/Vec4.hpp>
+# include <gmath/Mat2.hpp>
+# include <gmath/Mat3.hpp>
+# include <gmath/Mat4.hpp>
+
+# include <cstddef>
+# include <cstring>
+# include <tuple>
+# include <type_traits>
+# include <utility>
+
+//**** BLOCK LAYOUT ************************************************************
+// Write values in the std140 (uniform blocks) or std430 (storage blocks)
+// layout of GLSL, straight into a mapped buffer. Offsets are computed at
+// compile time from the list of member types:
+//   scalar        32 or 64 bits, aligned on its size
+//   vec2          aligned on 2 scalars
+//   vec3, vec4    aligned on 4 scalars, vec3 is 3 scalars long
+//   matN          N column vectors, as an array of N vecN
+//   array         elements every stride, alignment and stride of the element
+//                 rounded up to 16 bytes in std140
+// Matrices are written in column-major order, the default of GLSL, whatever
+// their storage order. Padding bytes are left untouched.
+
+namespace gm {
+	//**** TYPES ***************************************************************
+
+	/**
+	 * @brief Layout rules of uniform blocks.
+	 */
+	struct Std140
+	{
+		/**
+		 * @brief Alignment of arrays, matrices and structures.
+		 *
+		 * @param alignment Alignment of the element.
+		 *
+		 * @return The alignment rounded up to a vec4.
+		 */
+		static constexpr std::size_t	arrayAlignment(std::size_t alignment)
+		{
+			return (alignment < 16 ? 16 : alignment);
+		}
+	};
+
+	/**
+	 * @brief Layout rules of storage blocks, and uniform blocks with the
+	 * scalar block layout of Vulkan off.
+	 */
+	struct Std430
+	{
+		/**
+		 * @brief Alignment of arrays, matrices and structures.
+		 *
+		 * @param alignment Alignment of the element.
+		 *
+		 * @return The alignment of the element.
+		 */
+		static constexpr std::size_t	arrayAlignment(std::size_t alignment)
+		{
+			return (alignment);
+		}
+	};
+
+	//**** STATIC FUNCTIONS DEFINE *********************************************
+
+	/**
+	 * @brief Internal function for block layout. Round up to a multiple.
+	 *
+	 * @param value The value.
+	 * @param alignment The multiple, not 0.
+	 *
+	 * @return The smallest multiple of alignment not below value.
+	 */
+	constexpr std::size_t	__roundUp(std::size_t value, std::size_t alignment)
+	{
+		return ((value + alignment - 1) / alignment * alignment);
+	}
+
+	//**** TRAITS **************************************************************
+
+	/**
+	 * @brief Alignment, size and writer of a GLSL type.
+	 *
+	 * Defined for 32 and 64 bits scalars, Vec2, Vec3, Vec4, Mat2, Mat3, Mat4
+	 * and arrays of them.
+	 *
+	 * @tparam R Layout rules, Std140 or Std430.
+	 * @tparam T The C++ type.
+	 */
+	template <class R, typename T, typename = void>
+	struct GlslType;
+
+	template <class R, typename T>
+	struct GlslType<R, T, typename std::enable_if<std::is_arithmetic<T>::value
+									&& !std::is_same<T, bool>::value
+									&& (sizeof(T) == 4 || sizeof(T) == 8)>::type>
+	{
+		static constexpr std::size_t	alignment = sizeof(T);
+		static constexpr std::size_t	size = sizeof(T);
+
+		static void	write(unsigned char *dst, const T &value)
+		{
+			std::memcpy(dst, &value, sizeof(T));
+		}
+	};
+
+	template <class R, typename T>
+	struct GlslType<R, Vec2<T> >
+	{
+		static constexpr std::size_t	alignment = 2 * GlslType<R, T>::size;
+		static constexpr std::size_t	size = 2 * GlslType<R, T>::size;
+
+		static void	write(unsigned char *dst, const Vec2<T> &vec2)
+		{
+			GlslType<R, T>::write(dst, vec2.x);
+			GlslType<R, T>::write(dst + sizeof(T), vec2.y);
+		}
+	};
+
+	template <class R, typename T>
+	struct GlslType<R, Vec3<T> >
+	{
+		static constexpr std::size_t	alignment = 4 * GlslType<R, T>::size;
+		static constexpr std::size_t	size = 3 * GlslType<R, T>::size;
+
+		static void	write(unsigned char *dst, const Vec3<T> &vec3)
+		{
+			GlslType<R, T>::write(dst, vec3.x);
+			GlslType<R, T>::write(dst + sizeof(T), vec3.y);
+			GlslType<R, T>::write(dst + 2 * sizeof(T), vec3.z);
+		}
+	};
+
+	template <class R, typename T>
+	struct GlslType<R, Vec4<T> >
+	{
+		static constexpr std::size_t	alignment = 4 * GlslType<R, T>::size;
+		static constexpr std::size_t	size = 4 * GlslType<R, T>::size;
+
+		static void	write(unsigned char *dst, const Vec4<T> &vec4)
+		{
+			GlslType<R, T>::write(dst, vec4.x);
+			GlslType<R, T>::write(dst + sizeof(T), vec4.y);
+			GlslType<R, T>::write(dst + 2 * sizeof(T), vec4.z);
+			GlslType<R, T>::write(dst + 3 * sizeof(T), vec4.w);
+		}
+	};
+
+	/**
+	 * @brief Internal type for block layout. Square matrix of N columns of
+	 * type V, laid out as an array of columns.
+	 */
+	template <class R, typename T, typename V, unsigned int N>
+	struct __GlslMatrix
+	{
+		static constexpr std::size_t	alignment = R::arrayAlignment(GlslType<R, V>::alignment);
+		static constexpr std::size_t	stride = __roundUp(GlslType<R, V>::size, alignment);
+		static constexpr std::size_t	size = N * stride;
+
+		template <typename M>
+		static void	write(unsigned char *dst, const M &mat)
+		{
+			for (unsigned int x = 0; x < N; x++)
+				for (unsigned int y = 0; y < N; y++)
+					GlslType<R, T>::write(dst + x * stride + y * sizeof(T), mat.at(x, y));
+		}
+	};
+
+	template <class R, typename T, class L>
+	struct GlslType<R, Mat2<T, L> > : public __GlslMatrix<R, T, Vec2<T>, 2> {};
+
+	template <class R, typename T, class L>
+	struct GlslType<R, Mat3<T, L> > : public __GlslMatrix<R, T, Vec3<T>, 3> {};
+
+	template <class R, typename T, class L>
+	struct GlslType<R, Mat4<T, L> > : public __GlslMatrix<R, T, Vec4<T>, 4> {};
+
+	template <class R, typename T, std::size_t N>
+	struct GlslType<R, T[N]>
+	{
+		static constexpr std::size_t	alignment = R::arrayAlignment(GlslType<R, T>::alignment);
+		static constexpr std::size_t	stride = __roundUp(GlslType<R, T>::size, alignment);
+		static constexpr std::size_t	size = N * stride;
+
+		static void	write(unsigned char *dst, const T (&values)[N])
+		{
+			for (std::size_t i = 0; i < N; i++)
+				GlslType<R, T>::write(dst + i * stride, values[i]);
+		}
+	};
+
+	//**** CLASS DEFINE ********************************************************
+
+	/**
+	 * @brief Compile time layout of a uniform or storage block.
+	 *
+	 * @tparam R Layout rules, Std140 or Std430.
+	 * @tparam M Types of the members, in declaration order. Arrays are
+	 * written T[N].
+	 *
+	 * BlockLayout<Std140, Mat4f, Vec3f, float, Vec4f[4]> is the layout of
+	 * uniform Block { mat4 a; vec3 b; float c; vec4 d[4]; }.
+	 */
+	template <class R, typename... M>
+	class BlockLayout
+	{
+	public:
+		/**
+		 * @brief Type of a member.
+		 */
+		template <std::size_t I>
+		using Member = typename std::tuple_element<I, std::tuple<M...> >::type;
+
+		//**** STATIC METHODS **************************************************
+
+		/**
+		 * @brief Offset of a member.
+		 *
+		 * @param index Index of the member, in declaration order.
+		 *
+		 * @return Offset in bytes from the start of the block.
+		 */
+		static constexpr std::size_t	offset(std::size_t index)
+		{
+			const std::size_t	alignments[] = {1, GlslType<R, M>::alignment...};
+			const std::size_t	sizes[] = {0, GlslType<R, M>::size...};
+			std::size_t			res = 0;
+
+			for (std::size_t i = 1; i <= index; i++)
+				res = __roundUp(res, alignments[i]) + sizes[i];
+			return (__roundUp(res, alignments[index + 1]));
+		}
+
+		/**
+		 * @brief Alignment of the block, when it's an element of an array or
+		 * a member of another block.
+		 *
+		 * @return The largest alignment of the members, rounded by the rules.
+		 */
+		static constexpr std::size_t	alignment(void)
+		{
+			const std::size_t	alignments[] = {1, GlslType<R, M>::alignment...};
+			std::size_t			res = 1;
+
+			for (std::size_t i = 1; i <= sizeof...(M); i++)
+				res = alignments[i] > res ? alignments[i] : res;
+			return (R::arrayAlignment(res));
+		}
+
+		/**
+		 * @brief Size of the block, the size to allocate.
+		 *
+		 * @return End of the last member, rounded up to the block alignment.
+		 */
+		static constexpr std::size_t	size(void)
+		{
+			const std::size_t	sizes[] = {0, GlslType<R, M>::size...};
+
+			return (__roundUp(offset(sizeof...(M) - 1) + sizes[sizeof...(M)], alignment()));
+		}
+
+		/**
+		 * @brief Write one member, the others are untouched.
+		 *
+		 * @param dst Start of the block in the mapped buffer.
+		 * @param value The value of the member.
+		 */
+		template <std::size_t I>
+		static void	write(void *dst, const Member<I> &value)
+		{
+			GlslType<R, Member<I> >::write(static_cast<unsigned char *>(dst) + offset(I), value);
+		}
+
+		/**
+		 * @brief Write every member.
+		 *
+		 * @param dst Start of the block in the mapped buffer, size() bytes.
+		 * @param values The values of the members, in declaration order.
+		 */
+		static void	pack(void *dst, const M &... values)
+		{
+			BlockLayout::packMembers(static_cast<unsigned char *>(dst), std::index_sequence_for<M...>(), values...);
+		}
+
+	private:
+		template <std::size_t... I>
+		static void	packMembers(unsigned char *dst, std::index_sequence<I...>, const M &... values)
+		{
+			const int	expand[] = {0, (GlslType<R, M>::write(dst + offset(I), values), 0)...};
+
+			static_cast<void>(expand);
+		}
+	};
+
+	//**** FUNCTIONS ***********************************************************
+
+	/**
+	 * @brief Distance between two elements of an array.
+	 *
+	 * @tparam R Layout rules, Std140 or Std430.
+	 * @tparam T Type of the elements.
+	 *
+	 * @return The stride in bytes.
+	 */
+	template <class R, typename T>
+	constexpr std::size_t	arrayStride(void)
+	{
+		return (GlslType<R, T[1]>::stride);
+	}
+
+	/**
+	 * @brief Write an array of any length, like the last member of a storage
+	 * block, with the stride of the rules.
+	 *
+	 * @tparam R Layout rules, Std140 or Std430.
+	 * @param dst Start of the array in the mapped buffer, count * arrayStride bytes.
+	 * @param values The elements.
+	 * @param count Number of elements.
+	 */
+	template <class R, typename T>
+	void	packArray(void *dst, const T *values, std::size_t count)
+	{
+		unsigned char	*bytes = static_cast<unsigned char *>(dst);
+
+		for (std::size_t i = 0; i < count; i++)
+			GlslType<R, T>::write(bytes + i * arrayStride<R, T>(), values[i]);
+	}
+
+	//**** CHECKS **************************************************************
+
+	static_assert(BlockLayout<Std140, Vec3<float>, float>::offset(1) == 12
+					&& BlockLayout<Std140, float, Vec3<float> >::offset(1) == 16,
+					"vec3 must be aligned on 16 bytes and leave its last 4 bytes");
+	static_assert(BlockLayout<Std140, Mat3<float> >::size() == 48 && BlockLayout<Std430, Mat3<float> >::size() == 48,
+					"mat3 must be 3 columns of 16 bytes");
+	static_assert(BlockLayout<Std140, Mat2<float> >::size() == 32 && BlockLayout<Std430, Mat2<float> >::size() == 16,
+					"mat2 columns must be 16 bytes apart in std140 only");
+	static_assert(arrayStride<Std140, float>() == 16 && arrayStride<Std430, float>() == 4
+					&& arrayStride<Std430, Vec3<float> >() == 16,
+					"array stride must follow the rules");
+	static_assert(BlockLayout<Std140, Mat4<float>, Vec3<float>, float, Vec2<float>[3], double>::offset(4) == 128
+					&& BlockLayout<Std140, Mat4<float>, Vec3<float>, float, Vec2<float>[3], double>::size() == 144,
+					"block layout must follow std140");
+}
+
+#endif
@@ -0,0 +1,876 @@
+#ifndef GM_COMPONENTWISE_HPP
+# define GM_COMPONENTWISE_HPP
+
+# include <gmath/config.hpp>
+# include <gmath/utils.hpp>
+# include <gmath/Vec2.hpp>
+# include <gmath/Vec3.hpp>
+# include <gmath/Vec4.hpp>
+# include <gmath/simd.hpp>
+# include <gmath/dispatch.hpp>
+
+# include <cmath>
+# include <cstddef>
+# include <type_traits>
+
+//**** COMPONENT-WISE **********************************************************
+// Functions of utils.hpp applied to each component of Vec2, Vec3 and Vec4,
+// like the GLSL ones. They use selects, not branches, so loops over vectors
+// can vectorize. Masks are Vec2b, Vec3b and Vec4b, made by the comparisons.
+
+namespace gm {
+	//**** STATIC FUNCTIONS DEFINE *********************************************
+
+	/**
+	 * @brief Internal trait for component-wise. Number of components of a
+	 * vector type, 0 for other types.
+	 */
+	template <typename V>
+	struct __VecComponents
+	{
+		static const unsigned int	value = 0;
+	};
+
+	template <typename T>
+	struct __VecComponents<Vec2<T> >
+	{
+		static const unsigned int	value = 2;
+	};
+
+	template <typename T>
+	struct __VecComponents<Vec3<T> >
+	{
+		static const unsigned int	value = 3;
+	};
+
+	template <typename T>
+	struct __VecComponents<Vec4<T> >
+	{
+		static const unsigned int	value = 4;
+	};
+
+	/**
+	 * @brief Internal type for component-wise. R, only when V is a Vec2, Vec3
+	 * or Vec4.
+	 */
+	template <typename V, typename R = V>
+	using __EnableVec = typename std::enable_if<(__VecComponents<V>::value > 0), R>::type;
+
+	/**
+	 * @brief Internal function for component-wise. Apply a function to each
+	 * component of one, two or three vectors.
+	 *
+	 * @param a First vector.
+	 * @param function Function taking one component of each vector.
+	 *
+	 * @return Vector of the results.
+	 */
+	template <typename A, typename F>
+	auto	__map(const Vec2<A> &a, F function) -> Vec2<decltype(function(a.x))>
+	{
+		return (Vec2<decltype(function(a.x))>(function(a.x), function(a.y)));
+	}
+
+	template <typename A, typename F>
+	auto	__map(const Vec3<A> &a, F function) -> Vec3<decltype(function(a.x))>
+	{
+		return (Vec3<decltype(function(a.x))>(function(a.x), function(a.y), function(a.z)));
+	}
+
+	template <typename A, typename F>
+	auto	__map(const Vec4<A> &a, F function) -> Vec4<decltype(function(a.x))>
+	{
+		return (Vec4<decltype(function(a.x))>(function(a.x), function(a.y), function(a.z), function(a.w)));
+	}
+
+	template <typename A, typename B, typename F>
+	auto	__map(const Vec2<A> &a, const Vec2<B> &b, F function) -> Vec2<decltype(function(a.x, b.x))>
+	{
+		return (Vec2<decltype(function(a.x, b.x))>(function(a.x, b.x), function(a.y, b.y)));
+	}
+
+	template <typename A, typename B, typename F>
+	auto	__map(const Vec3<A> &a, const Vec3<B> &b, F function) -> Vec3<decltype(function(a.x, b.x))>
+	{
+		return (Vec3<decltype(function(a.x, b.x))>(function(a.x, b.x), function(a.y, b.y), function(a.z, b.z)));
+	}
+
+	template <typename A, typename B, typename F>
+	auto	__map(const Vec4<A> &a, const Vec4<B> &b, F function) -> Vec4<decltype(function(a.x, b.x))>
+	{
+		return (Vec4<decltype(function(a.x, b.x))>(function(a.x, b.x), function(a.y, b.y),
+													function(a.z, b.z), function(a.w, b.w)));
+	}
+
+	template <typename A, typename B, typename C, typename F>
+	auto	__map(const Vec2<A> &a, const Vec2<B> &b, const Vec2<C> &c, F function)
+		-> Vec2<decltype(function(a.x, b.x, c.x))>
+	{
+		return (Vec2<decltype(function(a.x, b.x, c.x))>(function(a.x, b.x, c.x), function(a.y, b.y, c.y)));
+	}
+
+	template <typename A, typename B, typename C, typename F>
+	auto	__map(const Vec3<A> &a, const Vec3<B> &b, const Vec3<C> &c, F function)
+		-> Vec3<decltype(function(a.x, b.x, c.x))>
+	{
+		return (Vec3<decltype(function(a.x, b.x, c.x))>(function(a.x, b.x, c.x), function(a.y, b.y, c.y),
+														function(a.z, b.z, c.z)));
+	}
+
+	template <typename A, typename B, typename C, typename F>
+	auto	__map(const Vec4<A> &a, const Vec4<B> &b, const Vec4<C> &c, F function)
+		-> Vec4<decltype(function(a.x, b.x, c.x))>
+	{
+		return (Vec4<decltype(function(a.x, b.x, c.x))>(function(a.x, b.x, c.x), function(a.y, b.y, c.y),
+														function(a.z, b.z, c.z), function(a.w, b.w, c.w)));
+	}
+
+	/**
+	 * @brief Internal function for component-wise. Values of a float vector
+	 * array, for the batch kernels.
+	 */
+	template <typename V>
+	const float	*__floats(const V *array)
+	{
+		return (reinterpret_cast<const float *>(array));
+	}
+
+	template <typename V>
+	float	*__floats(V *array)
+	{
+		return (reinterpret_cast<float *>(array));
+	}
+
+	//**** FUNCTIONS ***********************************************************
+	//---- Comparisons ---------------------------------------------------------
+
+	/**
+	 * @brief Component-wise a < b.
+	 *
+	 * @param a First vector.
+	 * @param b Second vector.
+	 *
+	 * @return Mask with true where a is less than b.
+	 */
+	template <template <typename> class V, typename T>
+	__EnableVec<V<T>, V<bool> >	lessThan(const V<T> &a, const V<T> &b)
+	{
+		return (__map(a, b, [](const T &x, const T &y) { return (x < y); }));
+	}
+
+	/**
+	 * @brief Component-wise a <= b.
+	 *
+	 * @param a First vector.
+	 * @param b Second vector.
+	 *
+	 * @return Mask with true where a is less than or equal to b.
+	 */
+	template <template <typename> class V, typename T>
+	__EnableVec<V<T>, V<bool> >	lessEqual(const V<T> &a, const V<T> &b)
+	{
+		return (__map(a, b, [](const T &x, const T &y) { return (x <= y); }));
+	}
+
+	/**
+	 * @brief Component-wise a > b.
+	 *
+	 * @param a First vector.
+	 * @param b Second vector.
+	 *
+	 * @return Mask with true where a is greater than b.
+	 */
+	template <template <typename> class V, typename T>
+	__EnableVec<V<T>, V<bool> >	greaterThan(const V<T> &a, const V<T> &b)
+	{
+		return (__map(a, b, [](const T &x, const T &y) { return (x > y); }));
+	}
+
+	/**
+	 * @brief Component-wise a >= b.
+	 *
+	 * @param a First vector.
+	 * @param b Second vector.
+	 *
+	 * @return Mask with true where a is greater than or equal to b.
+	 */
+	template <template <typename> class V, typename T>
+	__EnableVec<V<T>, V<bool> >	greaterEqual(const V<T> &a, const V<T> &b)
+	{
+		return (__map(a, b, [](const T &x, const T &y) { return (x >= y); }));
+	}
+
+	/**
+	 * @brief Component-wise a == b.
+	 *
+	 * @param a First vector.
+	 * @param b Second vector.
+	 *
+	 * @return Mask with true where a is equal to b.
+	 */
+	template <template <typename> class V, typename T>
+	__EnableVec<V<T>, V<bool> >	equal(const V<T> &a, const V<T> &b)
+	{
+		return (__map(a, b, [](const T &x, const T &y) { return (x == y); }));
+	}
+
+	/**
+	 * @brief Component-wise a != b.
+	 *
+	 * @param a First vector.
+	 * @param b Second vector.
+	 *
+	 * @return Mask with true where a is not equal to b.
+	 */
+	template <template <typename> class V, typename T>
+	__EnableVec<V<T>, V<bool> >	notEqual(const V<T> &a, const V<T> &b)
+	{
+		return (__map(a, b, [](const T &x, const T &y) { return (x != y); }));
+	}
+
+	//---- Masks ---------------------------------------------------------------
+
+	/**
+	 * @brief Check if a component of a mask is true.
+	 *
+	 * @param mask The mask.
+	 *
+	 * @return true if at least one component is true.
+	 */
+	inline bool	any(const Vec2<bool> &mask)
+	{
+		return (mask.x | mask.y);
+	}
+
+	inline bool	any(const Vec3<bool> &mask)
+	{
+		return (mask.x | mask.y | mask.z);
+	}
+
+	inline bool	any(const Vec4<bool> &mask)
+	{
+		return (mask.x | mask.y | mask.z | mask.w);
+	}
+
+	/**
+	 * @brief Check if every component of a mask is true.
+	 *
+	 * @param mask The mask.
+	 *
+	 * @return true if all components are true.
+	 */
+	inline bool	all(const Vec2<bool> &mask)
+	{
+		return (mask.x & mask.y);
+	}
+
+	inline bool	all(const Vec3<bool> &mask)
+	{
+		return (mask.x & mask.y & mask.z);
+	}
+
+	inline bool	all(const Vec4<bool> &mask)
+	{
+		return (mask.x & mask.y & mask.z & mask.w);
+	}
+
+	/**
+	 * @brief Component-wise choice between two vectors.
+	 *
+	 * @param mask The mask.
+	 * @param a Components used where mask is true.
+	 * @param b Components used where mask is false.
+	 *
+	 * @return Vector with components of a or b.
+	 */
+	template <template <typename> class V, typename T>
+	__EnableVec<V<T> >	select(const V<bool> &mask, const V<T> &a, const V<T> &b)
+	{
+		return (__map(mask, a, b, [](bool m, const T &x, const T &y) { return (select(m, x, y)); }));
+	}
+
+	//---- Functions -----------------------------------------------------------
+
+	/**
+	 * @brief Component-wise minimum.
+	 *
+	 * @param a First vector.
+	 * @param b Second vector.
+	 *
+	 * @return Vector of the minimum of each component.
+	 */
+	template <template <typename> class V, typename T>
+	__EnableVec<V<T> >	min(const V<T> &a, const V<T> &b)
+	{
+		return (__map(a, b, [](const T &x, const T &y) { return (min(x, y)); }));
+	}
+
+	/**
+	 * @brief Component-wise maximum.
+	 *
+	 * @param a First vector.
+	 * @param b Second vector.
+	 *
+	 * @return Vector of the maximum of each component.
+	 */
+	template <template <typename> class V, typename T>
+	__EnableVec<V<T> >	max(const V<T> &a, const V<T> &b)
+	{
+		return (__map(a, b, [](const T &x, const T &y) { return (max(x, y)); }));
+	}
+
+	/**
+	 * @brief Component-wise clamp.
+	 *
+	 * @param vec The vector to clamp.
+	 * @param low Lower bounds.
+	 * @param high Upper bounds, not below low.
+	 *
+	 * @return Vector with each component between its bounds.
+	 */
+	template <template <typename> class V, typename T>
+	__EnableVec<V<T> >	clamp(const V<T> &vec, const V<T> &low, const V<T> &high)
+	{
+		return (min(max(vec, low), high));
+	}
+
+	/**
+	 * @brief Clamp each component between the same bounds.
+	 *
+	 * @param vec The vector to clamp.
+	 * @param low Lower bound.
+	 * @param high Upper bound, not below low.
+	 *
+	 * @return Vector with each component between low and high.
+	 */
+	template <template <typename> class V, typename T>
+	__EnableVec<V<T> >	clamp(const V<T> &vec, T low, T high)
+	{
+		return (clamp(vec, V<T>(low), V<T>(high)));
+	}
+
+	/**
+	 * @brief Component-wise absolute value.
+	 *
+	 * @param vec The vector.
+	 *
+	 * @return Vector of absolute values.
+	 */
+	template <template <typename> class V, typename T>
+	__EnableVec<V<T> >	abs(const V<T> &vec)
+	{
+		return (__map(vec, [](const T &x) { return (abs(x)); }));
+	}
+
+	/**
+	 * @brief Component-wise sign.
+	 *
+	 * @param vec The vector.
+	 *
+	 * @return Vector of -1, 0 or 1.
+	 */
+	template <template <typename> class V, typename T>
+	__EnableVec<V<T> >	sign(const V<T> &vec)
+	{
+		return (__map(vec, [](const T &x) { return (sign(x)); }));
+	}
+
+	/**
+	 * @brief Component-wise floor.
+	 *
+	 * @param vec The vector.
+	 *
+	 * @return Vector of the largest integers not above each component.
+	 */
+	template <template <typename> class V, typename T>
+	__EnableVec<V<T> >	floor(const V<T> &vec)
+	{
+		return (__map(vec, [](const T &x) { return (static_cast<T>(std::floor(x))); }));
+	}
+
+	/**
+	 * @brief Component-wise ceil.
+	 *
+	 * @param vec The vector.
+	 *
+	 * @return Vector of the smallest integers not below each component.
+	 */
+	template <template <typename> class V, typename T>
+	__EnableVec<V<T> >	ceil(const V<T> &vec)
+	{
+		return (__map(vec, [](const T &x) { return (static_cast<T>(std::ceil(x))); }));
+	}
+
+	/**
+	 * @brief Component-wise round, halfway cases away from zero.
+	 *
+	 * @param vec The vector.
+	 *
+	 * @return Vector of the nearest integers of each component.
+	 */
+	template <template <typename> class V, typename T>
+	__EnableVec<V<T> >	round(const V<T> &vec)
+	{
+		return (__map(vec, [](const T &x) { return (static_cast<T>(std::round(x))); }));
+	}
+
+	/**
+	 * @brief Component-wise fractional part.
+	 *
+	 * @param vec The vector.
+	 *
+	 * @return Vector of vec - floor(vec), in [0, 1).
+	 */
+	template <template <typename> class V, typename T>
+	__EnableVec<V<T> >	fract(const V<T> &vec)
+	{
+		return (__map(vec, [](const T &x) { return (fract(x)); }));
+	}
+
+	/**
+	 * @brief Component-wise step.
+	 *
+	 * @param edge Values where the steps are.
+	 * @param vec The vector.
+	 *
+	 * @return Vector of 0 where vec is below edge, 1 elsewhere.
+	 */
+	template <template <typename> class V, typename T>
+	__EnableVec<V<T> >	step(const V<T> &edge, const V<T> &vec)
+	{
+		return (__map(edge, vec, [](const T &e, const T &x) { return (step(e, x)); }));
+	}
+
+	/**
+	 * @brief Component-wise Hermite interpolation between 0 and 1.
+	 *
+	 * @param edge0 Values where the results start to grow from 0.
+	 * @param edge1 Values where the results reach 1.
+	 * @param vec The vector.
+	 *
+	 * @return Vector of smoothstep of each component.
+	 */
+	template <template <typename> class V, typename T>
+	__EnableVec<V<T> >	smoothstep(const V<T> &edge0, const V<T> &edge1, const V<T> &vec)
+	{
+		return (__map(edge0, edge1, vec, [](const T &e0, const T &e1, const T &x) { return (smoothstep(e0, e1, x)); }));
+	}
+
+	//---- Arrays --------------------------------------------------------------
+	// res can be one of the inputs. Float vectors run the batch kernels on
+	// their values, other types loop on the functions above.
+
+	/**
+	 * @brief Component-wise minimum of two vector arrays.
+	 *
+	 * @param a First array.
+	 * @param b Second array.
+	 * @param res Result array, can be a or b.
+	 * @param count Number of vectors.
+	 */
+	template <template <typename> class V, typename T>
+	__EnableVec<V<T>, void>	min(const V<T> *a, const V<T> *b, V<T> *res, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; i++)
+			res[i] = min(a[i], b[i]);
+	}
+
+	template <template <typename> class V>
+	__EnableVec<V<float>, void>	min(const V<float> *a, const V<float> *b, V<float> *res, std::size_t count)
+	{
+		kernels().min(__floats(a), __floats(b), __floats(res), count * __VecComponents<V<float> >::value);
+	}
+
+	/**
+	 * @brief Component-wise maximum of two vector arrays.
+	 *
+	 * @param a First array.
+	 * @param b Second array.
+	 * @param res Result array, can be a or b.
+	 * @param count Number of vectors.
+	 */
+	template <template <typename> class V, typename T>
+	__EnableVec<V<T>, void>	max(const V<T> *a, const V<T> *b, V<T> *res, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; i++)
+			res[i] = max(a[i], b[i]);
+	}
+
+	template <template <typename> class V>
+	__EnableVec<V<float>, void>	max(const V<float> *a, const V<float> *b, V<float> *res, std::size_t count)
+	{
+		kernels().max(__floats(a), __floats(b), __floats(res), count * __VecComponents<V<float> >::value);
+	}
+
+	/**
+	 * @brief Clamp every component of a vector array between the same bounds.
+	 *
+	 * @param src The vectors to clamp.
+	 * @param low Lower bound.
+	 * @param high Upper bound, not below low.
+	 * @param res Result array, can be src.
+	 * @param count Number of vectors.
+	 */
+	template <template <typename> class V, typename T>
+	__EnableVec<V<T>, void>	clamp(const V<T> *src, T low, T high, V<T> *res, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; i++)
+			res[i] = clamp(src[i], low, high);
+	}
+
+	template <template <typename> class V>
+	__EnableVec<V<float>, void>	clamp(const V<float> *src, float low, float high, V<float> *res, std::size_t count)
+	{
+		kernels().clamp(__floats(src), low, high, __floats(res), count * __VecComponents<V<float> >::value);
+	}
+
+	/**
+	 * @brief Component-wise absolute value of a vector array.
+	 *
+	 * @param src The vectors.
+	 * @param res Result array, can be src.
+	 * @param count Number of vectors.
+	 */
+	template <template <typename> class V, typename T>
+	__EnableVec<V<T>, void>	abs(const V<T> *src, V<T> *res, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; i++)
+			res[i] = abs(src[i]);
+	}
+
+	template <template <typename> class V>
+	__EnableVec<V<float>, void>	abs(const V<float> *src, V<float> *res, std::size_t count)
+	{
+		kernels().abs(__floats(src), __floats(res), count * __VecComponents<V<float> >::value);
+	}
+
+	/**
+	 * @brief Component-wise sign of a vector array.
+	 *
+	 * @param src The vectors.
+	 * @param res Result array, can be src.
+	 * @param count Number of vectors.
+	 */
+	template <template <typename> class V, typename T>
+	__EnableVec<V<T>, void>	sign(const V<T> *src, V<T> *res, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; i++)
+			res[i] = sign(src[i]);
+	}
+
+	template <template <typename> class V>
+	__EnableVec<V<float>, void>	sign(const V<float> *src, V<float> *res, std::size_t count)
+	{
+		kernels().sign(__floats(src), __floats(res), count * __VecComponents<V<float> >::value);
+	}
+
+	/**
+	 * @brief Component-wise floor of a vector array.
+	 *
+	 * @param src The vectors.
+	 * @param res Result array, can be src.
+	 * @param count Number of vectors.
+	 */
+	template <template <typename> class V, typename T>
+	__EnableVec<V<T>, void>	floor(const V<T> *src, V<T> *res, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; i++)
+			res[i] = floor(src[i]);
+	}
+
+	template <template <typename> class V>
+	__EnableVec<V<float>, void>	floor(const V<float> *src, V<float> *res, std::size_t count)
+	{
+		kernels().floor(__floats(src), __floats(res), count * __VecComponents<V<float> >::value);
+	}
+
+	/**
+	 * @brief Component-wise ceil of a vector array.
+	 *
+	 * @param src The vectors.
+	 * @param res Result array, can be src.
+	 * @param count Number of vectors.
+	 */
+	template <template <typename> class V, typename T>
+	__EnableVec<V<T>, void>	ceil(const V<T> *src, V<T> *res, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; i++)
+			res[i] = ceil(src[i]);
+	}
+
+	template <template <typename> class V>
+	__EnableVec<V<float>, void>	ceil(const V<float> *src, V<float> *res, std::size_t count)
+	{
+		kernels().ceil(__floats(src), __floats(res), count * __VecComponents<V<float> >::value);
+	}
+
+	/**
+	 * @brief Component-wise round of a vector array, halfway cases away from
+	 * zero.
+	 *
+	 * @param src The vectors.
+	 * @param res Result array, can be src.
+	 * @param count Number of vectors.
+	 */
+	template <template <typename> class V, typename T>
+	__EnableVec<V<T>, void>	round(const V<T> *src, V<T> *res, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; i++)
+			res[i] = round(src[i]);
+	}
+
+	template <template <typename> class V>
+	__EnableVec<V<float>, void>	round(const V<float> *src, V<float> *res, std::size_t count)
+	{
+		kernels().round(__floats(src), __floats(res), count * __VecComponents<V<float> >::value);
+	}
+
+	/**
+	 * @brief Component-wise fractional part of a vector array.
+	 *
+	 * @param src The vectors.
+	 * @param res Result array, can be src.
+	 * @param count Number of vectors.
+	 */
+	template <template <typename> class V, typename T>
+	__EnableVec<V<T>, void>	fract(const V<T> *src, V<T> *res, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; i++)
+			res[i] = fract(src[i]);
+	}
+
+	template <template <typename> class V>
+	__EnableVec<V<float>, void>	fract(const V<float> *src, V<float> *res, std::size_t count)
+	{
+		kernels().fract(__floats(src), __floats(res), count * __VecComponents<V<float> >::value);
+	}
+
+	/**
+	 * @brief Step of every component of a vector array at the same edge.
+	 *
+	 * @param edge Value where the step is.
+	 * @param src The vectors.
+	 * @param res Result array, can be src.
+	 * @param count Number of vectors.
+	 */
+	template <template <typename> class V, typename T>
+	__EnableVec<V<T>, void>	step(T edge, const V<T> *src, V<T> *res, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; i++)
+			res[i] = step(V<T>(edge), src[i]);
+	}
+
+	template <template <typename> class V>
+	__EnableVec<V<float>, void>	step(float edge, const V<float> *src, V<float> *res, std::size_t count)
+	{
+		kernels().step(edge, __floats(src), __floats(res), count * __VecComponents<V<float> >::value);
+	}
+
+	/**
+	 * @brief Smoothstep of every component of a vector array between the
+	 * same edges.
+	 *
+	 * @param edge0 Value where the results start to grow from 0.
+	 * @param edge1 Value where the results reach 1.
+	 * @param src The vectors.
+	 * @param res Result array, can be src.
+	 * @param count Number of vectors.
+	 */
+	template <template <typename> class V, typename T>
+	__EnableVec<V<T>, void>	smoothstep(T edge0, T edge1, const V<T> *src, V<T> *res, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; i++)
+			res[i] = smoothstep(V<T>(edge0), V<T>(edge1), src[i]);
+	}
+
+	template <template <typename> class V>
+	__EnableVec<V<float>, void>	smoothstep(float edge0, float edge1, const V<float> *src, V<float> *res, std::size_t count)
+	{
+		kernels().smoothstep(edge0, edge1, __floats(src), __floats(res), count * __VecComponents<V<float> >::value);
+	}
+
+	/**
+	 * @brief Component-wise choice between two vector arrays.
+	 *
+	 * @param mask The masks.
+	 * @param a Components used where mask is true.
+	 * @param b Components used where mask is false.
+	 * @param res Result array, can be a or b.
+	 * @param count Number of vectors.
+	 */
+	template <template <typename> class V, typename T>
+	__EnableVec<V<T>, void>	select(const V<bool> *mask, const V<T> *a, const V<T> *b, V<T> *res, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; i++)
+			res[i] = select(mask[i], a[i], b[i]);
+	}
+
+	//**** SIMD SPECIALIZATION ************************************************
+# ifdef GM_SSE2
+
+	/**
+	 * @brief Internal function for component-wise. Register mask of a Vec4b.
+	 *
+	 * @param mask The mask.
+	 *
+	 * @return Register with all bits set in the true lanes.
+	 */
+	inline __m128	__simd(const Vec4<bool> &mask)
+	{
+		return (_mm_castsi128_ps(_mm_sub_epi32(_mm_setzero_si128(),
+						_mm_set_epi32(mask.w, mask.z, mask.y, mask.x))));
+	}
+
+	/**
+	 * @brief Internal function for component-wise. Vec4b of a register mask.
+	 *
+	 * @param simd Register mask, from a comparison.
+	 *
+	 * @return The mask.
+	 */
+	inline Vec4<bool>	__vec4b(__m128 simd)
+	{
+		const int	bits = _mm_movemask_ps(simd);
+
+		return (Vec4<bool>((bits & 1) != 0, (bits & 2) != 0, (bits & 4) != 0, (bits & 8) != 0));
+	}
+
+	inline Vec4<bool>	lessThan(const Vec4<float> &a, const Vec4<float> &b)
+	{
+		return (__vec4b(_mm_cmplt_ps(a.simd(), b.simd())));
+	}
+
+	inline Vec4<bool>	lessEqual(const Vec4<float> &a, const Vec4<float> &b)
+	{
+		return (__vec4b(_mm_cmple_ps(a.simd(), b.simd())));
+	}
+
+	inline Vec4<bool>	greaterThan(const Vec4<float> &a, const Vec4<float> &b)
+	{
+		return (__vec4b(_mm_cmpgt_ps(a.simd(), b.simd())));
+	}
+
+	inline Vec4<bool>	greaterEqual(const Vec4<float> &a, const Vec4<float> &b)
+	{
+		return (__vec4b(_mm_cmpge_ps(a.simd(), b.simd())));
+	}
+
+	inline Vec4<bool>	equal(const Vec4<float> &a, const Vec4<float> &b)
+	{
+		return (__vec4b(_mm_cmpeq_ps(a.simd(), b.simd())));
+	}
+
+	inline Vec4<bool>	notEqual(const Vec4<float> &a, const Vec4<float> &b)
+	{
+		return (__vec4b(_mm_cmpneq_ps(a.simd(), b.simd())));
+	}
+
+	inline Vec4<float>	select(const Vec4<bool> &mask, const Vec4<float> &a, const Vec4<float> &b)
+	{
+		const __m128	simdMask = __simd(mask);
+
+		return (Vec4<float>(_mm_or_ps(_mm_and_ps(simdMask, a.simd()), _mm_andnot_ps(simdMask, b.simd()))));
+	}
+
+	inline Vec4<float>	min(const Vec4<float> &a, const Vec4<float> &b)
+	{
+		return (Vec4<float>(_mm_min_ps(a.simd(), b.simd())));
+	}
+
+	inline Vec4<float>	max(const Vec4<float> &a, const Vec4<float> &b)
+	{
+		return (Vec4<float>(_mm_max_ps(a.simd(), b.simd())));
+	}
+
+	inline Vec4<float>	clamp(const Vec4<float> &vec, const Vec4<float> &low, const Vec4<float> &high)
+	{
+		return (Vec4<float>(_mm_min_ps(_mm_max_ps(vec.simd(), low.simd()), high.simd())));
+	}
+
+	inline Vec4<float>	clamp(const Vec4<float> &vec, float low, float high)
+	{
+		return (Vec4<float>(_mm_min_ps(_mm_max_ps(vec.simd(), _mm_set1_ps(low)), _mm_set1_ps(high))));
+	}
+
+	inline Vec4<float>	abs(const Vec4<float> &vec)
+	{
+		return (Vec4<float>(_mm_andnot_ps(_mm_set1_ps(-0.0f), vec.simd())));
+	}
+
+	inline Vec4<float>	sign(const Vec4<float> &vec)
+	{
+		const __m128	one = _mm_set1_ps(1.0f);
+		const __m128	zero = _mm_setzero_ps();
+
+		return (Vec4<float>(_mm_sub_ps(_mm_and_ps(_mm_cmpgt_ps(vec.simd(), zero), one),
+										_mm_and_ps(_mm_cmplt_ps(vec.simd(), zero), one))));
+	}
+
+	inline Vec4<float>	step(const Vec4<float> &edge, const Vec4<float> &vec)
+	{
+		return (Vec4<float>(_mm_andnot_ps(_mm_cmplt_ps(vec.simd(), edge.simd()), _mm_set1_ps(1.0f))));
+	}
+
+	inline Vec4<float>	smoothstep(const Vec4<float> &edge0, const Vec4<float> &edge1, const Vec4<float> &vec)
+	{
+		const __m128	t = _mm_min_ps(_mm_max_ps(_mm_div_ps(_mm_sub_ps(vec.simd(), edge0.simd()),
+															_mm_sub_ps(edge1.simd(), edge0.simd())),
+											_mm_setzero_ps()), _mm_set1_ps(1.0f));
+
+		return (Vec4<float>(_mm_mul_ps(_mm_mul_ps(t, t), _mm_sub_ps(_mm_set1_ps(3.0f), _mm_add_ps(t, t)))));
+	}
+
+#  ifdef GM_SSE41
+	inline Vec4<float>	floor(const Vec4<float> &vec)
+	{
+		return (Vec4<float>(_mm_floor_ps(vec.simd())));
+	}
+
+	inline Vec4<float>	ceil(const Vec4<float> &vec)
+	{
+		return (Vec4<float>(_mm_ceil_ps(vec.simd())));
+	}
+
+	inline Vec4<float>	round(const Vec4<float> &vec)
+	{
+		// Largest float below 0.5, so 0.49999997 is not rounded to 1
+		const __m128	half = _mm_or_ps(_mm_and_ps(vec.simd(), _mm_set1_ps(-0.0f)), _mm_set1_ps(0.49999997f));
+
+		return (Vec4<float>(_mm_round_ps(_mm_add_ps(vec.simd(), half), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC)));
+	}
+
+	inline Vec4<float>	fract(const Vec4<float> &vec)
+	{
+		return (Vec4<float>(_mm_sub_ps(vec.simd(), _mm_floor_ps(vec.simd()))));
+	}
+#  endif
+
+# endif
+
+	//**** USINGS **************************************************************
+
+	/**
+	 * @brief Mask of 2 bool, result of the Vec2 comparisons.
+	 */
+	using Vec2b = Vec2<bool>;
+
+	/**
+	 * @brief Mask of 3 bool, result of the Vec3 comparisons.
+	 */
+	using Vec3b = Vec3<bool>;
+
+	/**
+	 * @brief Mask of 4 bool, result of the Vec4 comparisons.
+	 */
+	using Vec4b = Vec4<bool>;
+
+	//**** CHECKS **************************************************************
+
+	static_assert(std::is_trivially_copyable<Vec4b>::value && std::is_trivially_destructible<Vec4b>::value,
+					"Vec4b must be trivially copyable and destructible");
+	static_assert(sizeof(Vec2<float>) == 2 * sizeof(float) && sizeof(Vec3<float>) == 3 * sizeof(float)
+					&& sizeof(Vec4<float>) == 4 * sizeof(float),
+					"Float vectors must be packed for the batch kernels");
+}
+
+#endif
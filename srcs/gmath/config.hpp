@@ -0,0 +1,83 @@
+#ifndef GM_CONFIG_HPP
+# define GM_CONFIG_HPP
+
+//**** SIMD ********************************************************************
+// Instruction sets the headers are allowed to use, detected from the compiler
+// flags. Define GM_NO_SIMD before including gmath to force the scalar code.
+
+# ifndef GM_NO_SIMD
+#  if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define GM_SSE2
+#  endif
+#  if defined(GM_SSE2) && defined(__SSE4_1__)
+#   define GM_SSE41
+#  endif
+#  if defined(GM_SSE41) && defined(__AVX2__)
+#   define GM_AVX2
+#  endif
+#  if defined(GM_SSE2) && defined(__FMA__)
+#   define GM_FMA
+#  endif
+#  if defined(GM_SSE2) && defined(__F16C__)
+#   define GM_F16C
+#  endif
+# endif
+
+//**** FMA *********************************************************************
+// gm::fma is always fused. Define GM_USE_FMA (meson -Dfma=true) to also fuse
+// the multiply-add of lerp, dot and the Mat * Mat and Mat * Vec products: one
+// rounding instead of two. Only fast on cpus with fma, so build with -mfma or
+// -march=haswell, results change in the last bits.
+
+
+//**** ERRORS ******************************************************************
+// Errors are reported with exceptions. When exceptions are disabled
+// (-fno-exceptions), the message is printed on stderr and the program aborts.
+
+# include <cstdio>
+# include <cstdlib>
+
+# if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+#  define GM_EXCEPTIONS
+# endif
+
+namespace gm {
+	/**
+	 * @brief Print an error message on stderr and abort.
+	 *
+	 * @param message The error message.
+	 */
+	[[noreturn]] inline void	__fatalError(const char *message) noexcept
+	{
+		std::fprintf(stderr, "gmath: %s\n", message);
+		std::abort();
+	}
+}
+
+# ifdef GM_EXCEPTIONS
+#  define GM_THROW(exception) throw exception
+# else
+#  define GM_THROW(exception) gm::__fatalError((exception).what())
+# endif
+
+//**** BOUNDS CHECK ************************************************************
+// operator[], get and set of vectors and matrices never throw. Their index is
+// checked when GM_BOUNDS_CHECK is 1 (abort on a bad index), and not checked
+// at all when it's 0. Default to 1 in debug builds and 0 with NDEBUG.
+
+# ifndef GM_BOUNDS_CHECK
+#  ifdef NDEBUG
+#   define GM_BOUNDS_CHECK 0
+#  else
+#   define GM_BOUNDS_CHECK 1
+#  endif
+# endif
+
+# if GM_BOUNDS_CHECK
+#  define GM_ASSERT_BOUNDS(condition, message) \
+	((condition) ? static_cast<void>(0) : gm::__fatalError(message))
+# else
+#  define GM_ASSERT_BOUNDS(condition, message) static_cast<void>(0)
+# endif
+
+#endif
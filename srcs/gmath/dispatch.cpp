@@ -0,0 +1,197 @@
+#include <gmath/dispatch.hpp>
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+# include <cpuid.h>
+# define GM_CPUID
+#endif
+
+//**** KERNELS DEFINE **********************************************************
+// Defined in kernels.cpp, compiled once per level (see meson.build)
+
+namespace gm {
+	namespace scalar { const KernelTable	&kernelTable(void); }
+#ifdef GM_HAS_KERNELS_SSE41
+	namespace sse41 { const KernelTable	&kernelTable(void); }
+#endif
+#ifdef GM_HAS_KERNELS_AVX2
+	namespace avx2 { const KernelTable	&kernelTable(void); }
+#endif
+#ifdef GM_HAS_KERNELS_AVX512
+	namespace avx512 { const KernelTable	&kernelTable(void); }
+#endif
+}
+
+//**** STATIC VARIABLES ********************************************************
+
+static std::atomic<const gm::KernelTable *>	currentTable(nullptr);
+
+static const char	*LEVEL_NAMES[] = {"scalar", "sse4.1", "avx2", "avx512"};
+
+//**** STATIC FUNCTIONS ********************************************************
+
+#ifdef GM_CPUID
+static unsigned long long	xgetbv(unsigned int id)
+{
+	unsigned int	low;
+	unsigned int	high;
+
+	__asm__ volatile ("xgetbv" : "=a"(low), "=d"(high) : "c"(id));
+
+	return ((static_cast<unsigned long long>(high) << 32) | low);
+}
+#endif
+
+static gm::SimdLevel	cpuSimdLevel(void)
+{
+#ifdef GM_CPUID
+	unsigned int	eax;
+	unsigned int	ebx;
+	unsigned int	ecx;
+	unsigned int	edx;
+
+	if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) || !(ecx & bit_SSE4_1))
+		return (gm::SimdLevel::Scalar);
+
+	const unsigned int	avxBits = bit_OSXSAVE | bit_AVX | bit_FMA | bit_F16C;
+	// OS must save xmm and ymm registers
+	if ((ecx & avxBits) != avxBits || (xgetbv(0) & 0x6) != 0x6)
+		return (gm::SimdLevel::SSE41);
+
+	if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) || !(ebx & bit_AVX2))
+		return (gm::SimdLevel::SSE41);
+
+	const unsigned int	avx512Bits = bit_AVX512F | bit_AVX512DQ | bit_AVX512BW | bit_AVX512VL;
+	// OS must also save opmask and zmm registers
+	if ((ebx & avx512Bits) != avx512Bits || (xgetbv(0) & 0xE6) != 0xE6)
+		return (gm::SimdLevel::AVX2);
+
+	return (gm::SimdLevel::AVX512);
+#else
+	return (gm::SimdLevel::Scalar);
+#endif
+}
+
+static const gm::KernelTable	&levelTable(gm::SimdLevel level)
+{
+	switch (level)
+	{
+#ifdef GM_HAS_KERNELS_AVX512
+	case gm::SimdLevel::AVX512:
+		return (gm::avx512::kernelTable());
+#endif
+#ifdef GM_HAS_KERNELS_AVX2
+	case gm::SimdLevel::AVX2:
+		return (gm::avx2::kernelTable());
+#endif
+#ifdef GM_HAS_KERNELS_SSE41
+	case gm::SimdLevel::SSE41:
+		return (gm::sse41::kernelTable());
+#endif
+	default:
+		return (gm::scalar::kernelTable());
+	}
+}
+
+static const gm::KernelTable	*initTable(void)
+{
+	gm::SimdLevel	level = gm::detectSimdLevel();
+	const char		*env = std::getenv("GM_SIMD_LEVEL");
+
+	if (env != nullptr)
+	{
+		int	i = 0;
+
+		while (i < 4 && std::strcmp(env, LEVEL_NAMES[i]) != 0)
+			i++;
+		if (i < 4)
+			level = static_cast<gm::SimdLevel>(i);
+		else
+			std::fprintf(stderr, "gmath: unknown GM_SIMD_LEVEL \"%s\", using %s\n", env,
+							LEVEL_NAMES[static_cast<int>(level)]);
+	}
+
+	gm::setSimdLevel(level);
+
+	return (currentTable.load());
+}
+
+/**
+ * @brief Bind the kernels when the library is loaded, so the first batch call
+ * doesn't run the cpu detection. A batch call from the static initializer of
+ * another file can come first, kernels() binds them then.
+ */
+struct	StartupBinding
+{
+	StartupBinding(void)
+	{
+		if (currentTable.load() == nullptr)
+			initTable();
+	}
+};
+
+static const StartupBinding	startupBinding;
+
+//**** FUNCTIONS ***************************************************************
+
+namespace gm {
+	SimdLevel	detectSimdLevel(void)
+	{
+		SimdLevel	level = cpuSimdLevel();
+
+#ifndef GM_HAS_KERNELS_AVX512
+		if (level > SimdLevel::AVX2)
+			level = SimdLevel::AVX2;
+#endif
+#ifndef GM_HAS_KERNELS_AVX2
+		if (level > SimdLevel::SSE41)
+			level = SimdLevel::SSE41;
+#endif
+#ifndef GM_HAS_KERNELS_SSE41
+		if (level > SimdLevel::Scalar)
+			level = SimdLevel::Scalar;
+#endif
+
+		return (level);
+	}
+
+
+	SimdLevel	getSimdLevel(void)
+	{
+		return (kernels().level);
+	}
+
+
+	SimdLevel	setSimdLevel(SimdLevel level)
+	{
+		const SimdLevel	detected = detectSimdLevel();
+
+		if (level > detected)
+			level = detected;
+
+		currentTable.store(&levelTable(level));
+
+		return (level);
+	}
+
+
+	const char	*simdLevelName(SimdLevel level)
+	{
+		return (LEVEL_NAMES[static_cast<int>(level)]);
+	}
+
+
+	const KernelTable	&kernels(void)
+	{
+		const KernelTable	*table = currentTable.load(std::memory_order_acquire);
+
+		if (table == nullptr)
+			table = initTable();
+
+		return (*table);
+	}
+}
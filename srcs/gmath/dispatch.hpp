@@ -0,0 +1,174 @@
+#ifndef GM_DISPATCH_HPP
+# define GM_DISPATCH_HPP
+
+# include <cstddef>
+# include <cstdint>
+
+namespace gm {
+	//**** TYPES ***************************************************************
+
+	/**
+	 * @brief Instruction set levels of the batch kernels.
+	 *
+	 * Each level include the previous ones.
+	 * AVX2 level also require FMA and F16C, AVX512 level require the
+	 * F, DQ, BW and VL extensions.
+	 */
+	enum class SimdLevel
+	{
+		Scalar = 0,
+		SSE41 = 1,
+		AVX2 = 2,
+		AVX512 = 3,
+	};
+
+	/**
+	 * @brief Table of the batch kernels of one simd level.
+	 *
+	 * Every kernel work on raw float arrays of count values. Output array can
+	 * be one of the input arrays, but arrays must not partially overlap.
+	 */
+	struct KernelTable
+	{
+		SimdLevel	level;
+
+		// res = a + b
+		void	(*add)(const float *a, const float *b, float *res, std::size_t count);
+		// res = a - b
+		void	(*sub)(const float *a, const float *b, float *res, std::size_t count);
+		// res = a * b
+		void	(*mul)(const float *a, const float *b, float *res, std::size_t count);
+		// res = a * value
+		void	(*scale)(const float *a, float value, float *res, std::size_t count);
+		// res = a * value + b
+		void	(*madd)(const float *a, float value, const float *b, float *res, std::size_t count);
+
+		// Vectors of dim (2 to 4) components stored as one array per component
+		// res = dot(a, b)
+		void	(*dot)(const float *const a[], const float *const b[], unsigned int dim, float *res, std::size_t count);
+		// res = norm(a)
+		void	(*norm)(const float *const a[], unsigned int dim, float *res, std::size_t count);
+		// res = normalize(a), null vectors are kept
+		void	(*normalize)(const float *const a[], unsigned int dim, float *const res[], std::size_t count);
+		// res = cross(a, b), 3 components only
+		void	(*cross)(const float *const a[], const float *const b[], float *const res[], std::size_t count);
+
+		// Row major 4x4 matrix mat applied to packed vectors
+		// dst = mat * (src, 1), src and dst are x y z arrays
+		void	(*transformPoints)(const float *mat, const float *src, float *dst, std::size_t count);
+		// dst = mat * (src, 0), src and dst are x y z arrays
+		void	(*transformVectors)(const float *mat, const float *src, float *dst, std::size_t count);
+		// dst = mat * src, src and dst are x y z w arrays
+		void	(*transformHomogeneous)(const float *mat, const float *src, float *dst, std::size_t count);
+
+		// Component-wise, same results as utils.hpp
+		// res = min(a, b)
+		void	(*min)(const float *a, const float *b, float *res, std::size_t count);
+		// res = max(a, b)
+		void	(*max)(const float *a, const float *b, float *res, std::size_t count);
+		// res = min(max(a, low), high)
+		void	(*clamp)(const float *a, float low, float high, float *res, std::size_t count);
+		// res = f(a)
+		void	(*abs)(const float *a, float *res, std::size_t count);
+		void	(*sign)(const float *a, float *res, std::size_t count);
+		void	(*floor)(const float *a, float *res, std::size_t count);
+		void	(*ceil)(const float *a, float *res, std::size_t count);
+		void	(*round)(const float *a, float *res, std::size_t count);
+		void	(*fract)(const float *a, float *res, std::size_t count);
+		// res = a < edge ? 0 : 1
+		void	(*step)(float edge, const float *a, float *res, std::size_t count);
+		// res = smoothstep(edge0, edge1, a)
+		void	(*smoothstep)(float edge0, float edge1, const float *a, float *res, std::size_t count);
+
+		// IEEE binary16 bits, round to nearest even
+		void	(*toHalf)(const float *src, std::uint16_t *dst, std::size_t count);
+		void	(*toFloat)(const std::uint16_t *src, float *dst, std::size_t count);
+
+		// Packed unit Vec3 (x y z arrays) to 32 bits, see normals.hpp
+		void	(*encodeOctahedral)(const float *src, std::uint32_t *dst, std::size_t count);
+		void	(*decodeOctahedral)(const std::uint32_t *src, float *dst, std::size_t count);
+		void	(*encode1010102)(const float *src, std::uint32_t *dst, std::size_t count);
+		void	(*decode1010102)(const std::uint32_t *src, float *dst, std::size_t count);
+		void	(*encodeSnorm16x2)(const float *src, std::uint32_t *dst, std::size_t count);
+		void	(*decodeSnorm16x2)(const std::uint32_t *src, float *dst, std::size_t count);
+
+		// Packed Vec2, Vec3 or Vec4 arrays, dim values per vector
+		// dst = src * rsqrt(dot(src, src)), estimate and one Newton step,
+		// src vectors must not be null
+		void	(*normalizeFast)(const float *src, unsigned int dim, float *dst, std::size_t count);
+		// dst = src / norm(src), or null when norm(src) <= epsilon
+		void	(*normalizeSafe)(const float *src, unsigned int dim, float epsilon, float *dst, std::size_t count);
+
+		// Approximations of gm::fast, res = f(a)
+		void	(*fastSin)(const float *a, float *res, std::size_t count);
+		void	(*fastCos)(const float *a, float *res, std::size_t count);
+		void	(*fastTan)(const float *a, float *res, std::size_t count);
+		void	(*fastAcos)(const float *a, float *res, std::size_t count);
+		void	(*fastExp)(const float *a, float *res, std::size_t count);
+		void	(*fastLog)(const float *a, float *res, std::size_t count);
+		// s = sin(a), c = cos(a)
+		void	(*fastSinCos)(const float *a, float *s, float *c, std::size_t count);
+		// res = atan2(y, x)
+		void	(*fastAtan2)(const float *y, const float *x, float *res, std::size_t count);
+
+		// Frustum culling, planes are 6 x y z w (see Frustum.hpp), objects are
+		// one array per component. Bit i % 32 of mask[i / 32] is set when
+		// object i is visible, (count + 31) / 32 words are written.
+		// Spheres of center (x y z arrays) and radius
+		void	(*cullSpheres)(const float *planes, const float *const center[], const float *radius,
+							std::uint32_t *mask, std::size_t count);
+		// Axis aligned boxes of corners min and max (x y z arrays)
+		void	(*cullAABBs)(const float *planes, const float *const min[], const float *const max[],
+							std::uint32_t *mask, std::size_t count);
+	};
+
+	//**** FUNCTIONS ***********************************************************
+
+	/**
+	 * @brief Detect the best simd level usable on this cpu with cpuid.
+	 *
+	 * Only the levels compiled in the library are returned.
+	 *
+	 * @return The widest simd level available.
+	 */
+	SimdLevel	detectSimdLevel(void);
+
+	/**
+	 * @brief Get the simd level used by the batch kernels.
+	 *
+	 * At first use, the level is the detected one, or the one in the
+	 * GM_SIMD_LEVEL environment variable (scalar, sse4.1, avx2 or avx512).
+	 * An unknown value is reported on stderr and the detected level is used.
+	 *
+	 * @return The simd level used.
+	 */
+	SimdLevel	getSimdLevel(void);
+
+	/**
+	 * @brief Force the simd level used by the batch kernels.
+	 *
+	 * @param level The wanted level, lowered to the detected level if the cpu
+	 * can't run it.
+	 *
+	 * @return The simd level really used.
+	 */
+	SimdLevel	setSimdLevel(SimdLevel level);
+
+	/**
+	 * @brief Get the name of a simd level.
+	 *
+	 * @param level The simd level.
+	 *
+	 * @return Name of the level, as used by GM_SIMD_LEVEL.
+	 */
+	const char	*simdLevelName(SimdLevel level);
+
+	/**
+	 * @brief Get the batch kernels of the current simd level.
+	 *
+	 * @return The kernel table.
+	 */
+	const KernelTable	&kernels(void);
+}
+
+#endif
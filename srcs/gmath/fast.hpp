@@ -0,0 +1,597 @@
+#ifndef GM_FAST_HPP
+# define GM_FAST_HPP
+
+# include <gmath/config.hpp>
+# include <gmath/dispatch.hpp>
+# include <gmath/fastPoly.hpp>
+
+# include <cmath>
+# include <cstddef>
+# include <cstdint>
+# include <cstring>
+
+//**** FAST MATH ***************************************************************
+// Polynomial approximations of the libm functions, without errno, without
+// double round-trip for float, and branch free for the simd batches.
+// Error bounds are the max measured against the long double libm on 16M
+// random inputs of the given domain, rounded up. The tests check them.
+// Inputs outside the domain give wrong values, not NaN or exceptions.
+
+namespace gm {
+	//**** STATIC FUNCTIONS DEFINE *********************************************
+
+	/**
+	 * @brief Internal pack for fast. One float, as the simd packs of the batch
+	 * kernels (see fastPoly.hpp).
+	 */
+	struct	__FastScalar
+	{
+		typedef float	type;
+		typedef bool	mask;
+
+		static float	set(float value) { return (value); }
+		static float	madd(float a, float b, float c) { return (a * b + c); }
+		static float	sqrt(float a) { return (std::sqrt(a)); }
+		static bool		greater(float a, float b) { return (a > b); }
+		static float	select(bool m, float a, float b) { return (m ? a : b); }
+
+		// Without SSE4.1, std::floor is a library call
+		static float	floor(float a)
+		{
+			const float	truncated = static_cast<float>(static_cast<std::int32_t>(a));
+
+			return (truncated > a ? truncated - 1.0f : truncated);
+		}
+
+		static float	exp2i(float n)
+		{
+			const std::uint32_t	bits = static_cast<std::uint32_t>(static_cast<std::int32_t>(n) + 127) << 23;
+			float				res;
+
+			std::memcpy(&res, &bits, sizeof(res));
+			return (res);
+		}
+
+		static float	frexp(float a, float &e)
+		{
+			std::uint32_t	bits;
+			float			res;
+
+			std::memcpy(&bits, &a, sizeof(bits));
+			e = static_cast<float>(static_cast<std::int32_t>((bits >> 23) & 0xFF) - 126);
+			bits = (bits & 0x807FFFFFu) | 0x3F000000u;
+			std::memcpy(&res, &bits, sizeof(res));
+			return (res);
+		}
+	};
+
+	/**
+	 * @brief Internal function for fast. Floor of a double.
+	 *
+	 * @param value Value, |value| < 2^62.
+	 *
+	 * @return Floor of value.
+	 */
+	inline double	__fastFloor(double value)
+	{
+		const double	truncated = static_cast<double>(static_cast<std::int64_t>(value));
+
+		return (truncated > value ? truncated - 1.0 : truncated);
+	}
+
+	/**
+	 * @brief Internal function for fast. Arc tangent of a double.
+	 *
+	 * @param value Value, not NaN.
+	 *
+	 * @return Arc tangent of value.
+	 */
+	inline double	__fastAtan(double value)
+	{
+		const double	absValue = value < 0.0 ? -value : value;
+		double			base = 0.0;
+		double			x = absValue;
+		double			moreBits = 0.0;
+
+		// Reduce to |x| <= 0.66, with atan(x) = pi/2 - atan(1/x) and
+		// atan(x) = pi/4 + atan((x - 1) / (x + 1))
+		if (absValue > 2.41421356237309504880)
+		{
+			base = 1.57079632679489661923;
+			x = -1.0 / absValue;
+			moreBits = 6.123233995736765886130e-17;
+		}
+		else if (absValue > 0.66)
+		{
+			base = 0.78539816339744830962;
+			x = (absValue - 1.0) / (absValue + 1.0);
+			moreBits = 0.5 * 6.123233995736765886130e-17;
+		}
+
+		const double	z = x * x;
+		const double	p = (((-8.750608600031904122785e-1 * z - 1.615753718733365076637e1) * z
+								- 7.500855792314704667340e1) * z - 1.228866684490136173410e2) * z
+								- 6.485021904942025371773e1;
+		const double	q = ((((z + 2.485846490142306297962e1) * z + 1.650270098316988542046e2) * z
+								+ 4.328810604912902668951e2) * z + 4.853903996359136964868e2) * z
+								+ 1.945506571482613964425e2;
+		const double	res = base + ((x * z * p / q + x) + moreBits);
+
+		return (value < 0.0 ? -res : res);
+	}
+
+	namespace fast {
+		//**** FUNCTIONS *******************************************************
+		//---- Float -----------------------------------------------------------
+
+		/**
+		 * @brief Sinus and cosinus of the same angle, cheaper than both.
+		 *
+		 * Max absolute error 1e-7 for |x| < 8192, 2 ulp relative for
+		 * |x| < pi.
+		 *
+		 * @param x Angle in radians.
+		 * @param s Receive the sinus.
+		 * @param c Receive the cosinus.
+		 */
+		inline void	sincos(float x, float &s, float &c)
+		{
+			__fastSinCos<__FastScalar>(x, s, c);
+		}
+
+		/**
+		 * @brief Fast sinus. Max absolute error 1e-7 for |x| < 8192.
+		 *
+		 * @param x Angle in radians.
+		 *
+		 * @return Sinus of x.
+		 */
+		inline float	sin(float x)
+		{
+			float	s;
+			float	c;
+
+			__fastSinCos<__FastScalar>(x, s, c);
+			return (s);
+		}
+
+		/**
+		 * @brief Fast cosinus. Max absolute error 1e-7 for |x| < 8192.
+		 *
+		 * @param x Angle in radians.
+		 *
+		 * @return Cosinus of x.
+		 */
+		inline float	cos(float x)
+		{
+			float	s;
+			float	c;
+
+			__fastSinCos<__FastScalar>(x, s, c);
+			return (c);
+		}
+
+		/**
+		 * @brief Fast tangent, sin / cos. Max relative error 4 ulp for
+		 * |x| < 1.5. Beyond, the absolute error of sin and cos divided by
+		 * cos(x): large near the poles and the zeros of other periods.
+		 *
+		 * @param x Angle in radians.
+		 *
+		 * @return Tangent of x.
+		 */
+		inline float	tan(float x)
+		{
+			float	s;
+			float	c;
+
+			__fastSinCos<__FastScalar>(x, s, c);
+			return (s / c);
+		}
+
+		/**
+		 * @brief Fast arc tangent of y / x. Max relative error 3.5 ulp.
+		 *
+		 * @param y Ordinate.
+		 * @param x Abscissa.
+		 *
+		 * @return Angle in [-pi, pi], 0 when x and y are 0.
+		 */
+		inline float	atan2(float y, float x)
+		{
+			return (__fastAtan2<__FastScalar>(y, x));
+		}
+
+		/**
+		 * @brief Fast arc cosinus. Max relative error 4 ulp.
+		 *
+		 * @param x Value in [-1, 1].
+		 *
+		 * @return Angle in [0, pi].
+		 */
+		inline float	acos(float x)
+		{
+			return (__fastAcos<__FastScalar>(x));
+		}
+
+		/**
+		 * @brief Fast exponential. Max relative error 1.1 ulp, x is clamped
+		 * to [-87, 88].
+		 *
+		 * @param x The exponent.
+		 *
+		 * @return e^x.
+		 */
+		inline float	exp(float x)
+		{
+			return (__fastExp<__FastScalar>(x));
+		}
+
+		/**
+		 * @brief Fast natural logarithm. Max relative error 1 ulp.
+		 *
+		 * @param x Positive normal value.
+		 *
+		 * @return ln(x).
+		 */
+		inline float	log(float x)
+		{
+			return (__fastLog<__FastScalar>(x));
+		}
+
+		//---- Double ----------------------------------------------------------
+
+		/**
+		 * @brief Sinus and cosinus of the same angle, cheaper than both.
+		 *
+		 * Max absolute error 2.2e-16 (1 ulp of 1) for |x| < 1e6, 2 ulp
+		 * relative for |x| < pi.
+		 *
+		 * @param x Angle in radians.
+		 * @param s Receive the sinus.
+		 * @param c Receive the cosinus.
+		 */
+		inline void	sincos(double x, double &s, double &c)
+		{
+			// Nearest quadrant q, and x - q * pi / 2 with pi/2 split in 3
+			const double	q = __fastFloor(x * 0.63661977236758134308 + 0.5);
+			const double	r = ((x - q * 1.57079632673412561417e+00) - q * 6.07710050630396597660e-11)
+								- q * 2.02226624879595063154e-21;
+			const double	z = r * r;
+			const double	sinR = r + r * z * (((((1.58962301576546568060e-10 * z - 2.50507477628578072866e-8) * z
+									+ 2.75573136213857245213e-6) * z - 1.98412698295895385996e-4) * z
+									+ 8.33333333332211858878e-3) * z - 1.66666666666666307295e-1);
+			const double	cosR = (1.0 - 0.5 * z) + z * z * (((((-1.13585365213876817300e-11 * z + 2.08757008419747316778e-9) * z
+									- 2.75573141792967388112e-7) * z + 2.48015872888517045348e-5) * z
+									- 1.38888888888730564116e-3) * z + 4.16666666666665929218e-2);
+
+			switch (static_cast<std::int64_t>(q) & 3)
+			{
+			case 0:
+				s = sinR;
+				c = cosR;
+				break;
+			case 1:
+				s = cosR;
+				c = -sinR;
+				break;
+			case 2:
+				s = -sinR;
+				c = -cosR;
+				break;
+			default:
+				s = -cosR;
+				c = sinR;
+				break;
+			}
+		}
+
+		/**
+		 * @brief Fast sinus. Max absolute error 2.2e-16 for |x| < 1e6.
+		 *
+		 * @param x Angle in radians.
+		 *
+		 * @return Sinus of x.
+		 */
+		inline double	sin(double x)
+		{
+			double	s;
+			double	c;
+
+			sincos(x, s, c);
+			return (s);
+		}
+
+		/**
+		 * @brief Fast cosinus. Max absolute error 2.2e-16 for |x| < 1e6.
+		 *
+		 * @param x Angle in radians.
+		 *
+		 * @return Cosinus of x.
+		 */
+		inline double	cos(double x)
+		{
+			double	s;
+			double	c;
+
+			sincos(x, s, c);
+			return (c);
+		}
+
+		/**
+		 * @brief Fast tangent, sin / cos. Max relative error 3.5 ulp for
+		 * |x| < 1.5, 5 ulp for |x| < 1e6 where |cos(x)| > 0.1.
+		 *
+		 * @param x Angle in radians.
+		 *
+		 * @return Tangent of x.
+		 */
+		inline double	tan(double x)
+		{
+			double	s;
+			double	c;
+
+			sincos(x, s, c);
+			return (s / c);
+		}
+
+		/**
+		 * @brief Fast arc tangent of y / x. Max relative error 2 ulp.
+		 *
+		 * @param y Ordinate.
+		 * @param x Abscissa.
+		 *
+		 * @return Angle in [-pi, pi], 0 when x and y are 0.
+		 */
+		inline double	atan2(double y, double x)
+		{
+			const double	absX = x < 0.0 ? -x : x;
+			const double	absY = y < 0.0 ? -y : y;
+			double			res;
+
+			if (absX == 0.0 && absY == 0.0)
+				return (0.0);
+			if (absY > absX)
+				res = 1.57079632679489661923 - __fastAtan(absX / absY);
+			else
+				res = __fastAtan(absY / absX);
+			if (x < 0.0)
+				res = 3.14159265358979323846 - res;
+			return (y < 0.0 ? -res : res);
+		}
+
+		/**
+		 * @brief Fast arc cosinus. Max relative error 2.5 ulp.
+		 *
+		 * @param x Value in [-1, 1].
+		 *
+		 * @return Angle in [0, pi].
+		 */
+		inline double	acos(double x)
+		{
+			// acos(x) = atan2(sqrt(1 - x^2), x), (1 - x)(1 + x) keep precision near 1
+			return (atan2(std::sqrt((1.0 - x) * (1.0 + x)), x));
+		}
+
+		/**
+		 * @brief Fast exponential. Max relative error 2 ulp, x is clamped to
+		 * [-708, 709].
+		 *
+		 * @param x The exponent.
+		 *
+		 * @return e^x.
+		 */
+		inline double	exp(double x)
+		{
+			const double	clamped = x > 709.0 ? 709.0 : (x < -708.0 ? -708.0 : x);
+			// x = n * ln(2) + r, with ln(2) split in 2 doubles
+			const double	n = __fastFloor(clamped * 1.4426950408889634074 + 0.5);
+			const double	r = (clamped - n * 6.93145751953125e-1) - n * 1.42860682030941723212e-6;
+			const double	z = r * r;
+			const double	p = r * ((1.26177193074810590878e-4 * z + 3.02994407707441961300e-2) * z
+									+ 9.99999999999999999910e-1);
+			const double	q = ((3.00198505138664455042e-6 * z + 2.52448340349684104192e-3) * z
+									+ 2.27265548208155028766e-1) * z + 2.00000000000000000009e0;
+			const std::uint64_t	bits = static_cast<std::uint64_t>(static_cast<std::int64_t>(n) + 1023) << 52;
+			double				scale;
+
+			std::memcpy(&scale, &bits, sizeof(scale));
+			return ((1.0 + 2.0 * (p / (q - p))) * scale);
+		}
+
+		/**
+		 * @brief Fast natural logarithm. Max relative error 1 ulp.
+		 *
+		 * @param x Positive normal value.
+		 *
+		 * @return ln(x).
+		 */
+		inline double	log(double x)
+		{
+			std::uint64_t	bits;
+			double			m;
+
+			std::memcpy(&bits, &x, sizeof(bits));
+			double	e = static_cast<double>(static_cast<std::int64_t>((bits >> 52) & 0x7FF) - 1022);
+			bits = (bits & 0x800FFFFFFFFFFFFFull) | 0x3FE0000000000000ull;
+			std::memcpy(&m, &bits, sizeof(m));
+			// Mantissa in [sqrt(0.5), sqrt(2)), then m - 1
+			if (m < 0.70710678118654752440)
+			{
+				e -= 1.0;
+				m = m + m - 1.0;
+			}
+			else
+				m = m - 1.0;
+
+			const double	z = m * m;
+			const double	p = ((((1.01875663804580931796e-4 * m + 4.97494994976747001425e-1) * m
+									+ 4.70579119878881725854e0) * m + 1.44989225341610930846e1) * m
+									+ 1.79368678507819816313e1) * m + 7.70838733755885391666e0;
+			const double	q = ((((m + 1.12873587189167450590e1) * m + 4.52279145837532221105e1) * m
+									+ 8.29875266912776603211e1) * m + 7.11544750618563894466e1) * m
+									+ 2.31251620126765340583e1;
+			// ln(x) = m - z / 2 + m z p / q + e ln(2), with ln(2) split in 2 doubles
+			const double	y = m * (z * p / q) - e * 2.121944400546905827679e-4 - 0.5 * z;
+
+			return ((m + y) + e * 0.693359375);
+		}
+
+		//---- Batch -----------------------------------------------------------
+		// Float batches run the simd kernels, the bounds of the scalar
+		// versions hold for every level, with or without fma. dst can be src.
+
+		/**
+		 * @brief Fast sinus of a float array, with the best simd level of the cpu.
+		 *
+		 * @param src The angles in radians.
+		 * @param dst Array of count values for the results.
+		 * @param count Number of values.
+		 */
+		inline void	sin(const float *src, float *dst, std::size_t count)
+		{
+			kernels().fastSin(src, dst, count);
+		}
+
+		/**
+		 * @brief Fast cosinus of a float array, with the best simd level of the cpu.
+		 *
+		 * @param src The angles in radians.
+		 * @param dst Array of count values for the results.
+		 * @param count Number of values.
+		 */
+		inline void	cos(const float *src, float *dst, std::size_t count)
+		{
+			kernels().fastCos(src, dst, count);
+		}
+
+		/**
+		 * @brief Fast sinus and cosinus of a float array, with the best simd
+		 * level of the cpu.
+		 *
+		 * @param src The angles in radians.
+		 * @param s Array of count values for the sinus.
+		 * @param c Array of count values for the cosinus.
+		 * @param count Number of values.
+		 */
+		inline void	sincos(const float *src, float *s, float *c, std::size_t count)
+		{
+			kernels().fastSinCos(src, s, c, count);
+		}
+
+		/**
+		 * @brief Fast tangent of a float array, with the best simd level of the cpu.
+		 *
+		 * @param src The angles in radians.
+		 * @param dst Array of count values for the results.
+		 * @param count Number of values.
+		 */
+		inline void	tan(const float *src, float *dst, std::size_t count)
+		{
+			kernels().fastTan(src, dst, count);
+		}
+
+		/**
+		 * @brief Fast arc tangent of y / x of float arrays, with the best simd
+		 * level of the cpu.
+		 *
+		 * @param y The ordinates.
+		 * @param x The abscissas.
+		 * @param dst Array of count values for the results.
+		 * @param count Number of values.
+		 */
+		inline void	atan2(const float *y, const float *x, float *dst, std::size_t count)
+		{
+			kernels().fastAtan2(y, x, dst, count);
+		}
+
+		/**
+		 * @brief Fast arc cosinus of a float array, with the best simd level of the cpu.
+		 *
+		 * @param src The values in [-1, 1].
+		 * @param dst Array of count values for the results.
+		 * @param count Number of values.
+		 */
+		inline void	acos(const float *src, float *dst, std::size_t count)
+		{
+			kernels().fastAcos(src, dst, count);
+		}
+
+		/**
+		 * @brief Fast exponential of a float array, with the best simd level of the cpu.
+		 *
+		 * @param src The exponents.
+		 * @param dst Array of count values for the results.
+		 * @param count Number of values.
+		 */
+		inline void	exp(const float *src, float *dst, std::size_t count)
+		{
+			kernels().fastExp(src, dst, count);
+		}
+
+		/**
+		 * @brief Fast natural logarithm of a float array, with the best simd
+		 * level of the cpu.
+		 *
+		 * @param src The positive normal values.
+		 * @param dst Array of count values for the results.
+		 * @param count Number of values.
+		 */
+		inline void	log(const float *src, float *dst, std::size_t count)
+		{
+			kernels().fastLog(src, dst, count);
+		}
+
+		// Double batches are scalar loops, the compiler can still unroll them.
+
+		inline void	sin(const double *src, double *dst, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i++)
+				dst[i] = sin(src[i]);
+		}
+
+		inline void	cos(const double *src, double *dst, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i++)
+				dst[i] = cos(src[i]);
+		}
+
+		inline void	sincos(const double *src, double *s, double *c, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i++)
+				sincos(src[i], s[i], c[i]);
+		}
+
+		inline void	tan(const double *src, double *dst, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i++)
+				dst[i] = tan(src[i]);
+		}
+
+		inline void	atan2(const double *y, const double *x, double *dst, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i++)
+				dst[i] = atan2(y[i], x[i]);
+		}
+
+		inline void	acos(const double *src, double *dst, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i++)
+				dst[i] = acos(src[i]);
+		}
+
+		inline void	exp(const double *src, double *dst, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i++)
+				dst[i] = exp(src[i]);
+		}
+
+		inline void	log(const double *src, double *dst, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i++)
+				dst[i] = log(src[i]);
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,192 @@
+#ifndef GM_FASTPOLY_HPP
+# define GM_FASTPOLY_HPP
+
+// Float cores of gm::fast, written once for every pack type: the scalar pack
+// of fast.hpp and the simd packs of kernels.cpp.
+// Only templates here: kernels.cpp instantiate them with its own packs, so
+// each simd level keeps its own symbols.
+//
+// A pack P provides:
+//   type, mask               the values and the result of a comparison
+//   set(v)                   every value at v
+//   madd(a, b, c)            a * b + c
+//   floor(a), sqrt(a)
+//   greater(a, b)            a > b
+//   select(m, a, b)          m ? a : b
+//   exp2i(n)                 2^n, n an integer in [-126, 127]
+//   frexp(a, e)              mantissa in [0.5, 1), e receive the exponent
+// and the + - * / operators on type.
+// Polynomials are the minimax ones of the Cephes library.
+
+namespace gm {
+	//**** FUNCTIONS ***********************************************************
+
+	/**
+	 * @brief Internal function for fast. Sinus and cosinus of float values.
+	 *
+	 * x is reduced to [-pi/4, pi/4] with pi/2 split in 3 floats, exact
+	 * while |x| < 8192.
+	 *
+	 * @param x Angles in radians.
+	 * @param s Receive the sinus.
+	 * @param c Receive the cosinus.
+	 */
+	template <class P>
+	void	__fastSinCos(typename P::type x, typename P::type &s, typename P::type &c)
+	{
+		typedef typename P::type	type;
+
+		const type	zero = P::set(0.0f);
+		// Nearest quadrant q, and x - q * pi / 2
+		const type	q = P::floor(P::madd(x, P::set(0.636619772367581f), P::set(0.5f)));
+		const type	r = ((x - q * P::set(1.5703125f)) - q * P::set(4.837512969970703125e-4f))
+						- q * P::set(7.54978995489188216e-8f);
+		const type	z = r * r;
+		const type	sinR = P::madd(z * r, P::madd(P::madd(P::set(-1.9515295891e-4f), z, P::set(8.3321608736e-3f)),
+											z, P::set(-1.6666654611e-1f)), r);
+		const type	cosR = P::madd(z * z, P::madd(P::madd(P::set(2.443315711809948e-5f), z, P::set(-1.388731625493765e-3f)),
+											z, P::set(4.166664568298827e-2f)), P::set(1.0f) - P::set(0.5f) * z);
+		// q modulo 2 and 4, as fractions
+		const type	half = q * P::set(0.5f);
+		const type	quarterSin = q * P::set(0.25f);
+		const type	quarterCos = quarterSin + P::set(0.25f);
+		// Odd quadrants swap sinus and cosinus
+		const typename P::mask	odd = P::greater(half - P::floor(half), P::set(0.25f));
+		const type	sinV = P::select(odd, cosR, sinR);
+		const type	cosV = P::select(odd, sinR, cosR);
+
+		// sin is negative in quadrants 2 and 3, cos in quadrants 1 and 2
+		s = P::select(P::greater(quarterSin - P::floor(quarterSin), P::set(0.375f)), zero - sinV, sinV);
+		c = P::select(P::greater(quarterCos - P::floor(quarterCos), P::set(0.375f)), zero - cosV, cosV);
+	}
+
+	/**
+	 * @brief Internal function for fast. Arc tangent of float values in [0, 1].
+	 *
+	 * @param t Values in [0, 1].
+	 *
+	 * @return Arc tangent of t, in [0, pi/4].
+	 */
+	template <class P>
+	typename P::type	__fastAtan01(typename P::type t)
+	{
+		typedef typename P::type	type;
+
+		const type	one = P::set(1.0f);
+		// Above tan(pi/8), use atan(t) = pi/4 + atan((t - 1) / (t + 1))
+		const typename P::mask	high = P::greater(t, P::set(0.414213562373095f));
+		const type	u = P::select(high, (t - one) / (t + one), t);
+		const type	z = u * u;
+		const type	poly = P::madd(P::madd(P::madd(P::set(8.05374449538e-2f), z, P::set(-1.38776856032e-1f)),
+											z, P::set(1.99777106478e-1f)), z, P::set(-3.33329491539e-1f));
+
+		return (P::madd(poly * z, u, u) + P::select(high, P::set(0.785398163397448f), P::set(0.0f)));
+	}
+
+	/**
+	 * @brief Internal function for fast. Arc tangent of y / x of float values,
+	 * in the right quadrant.
+	 *
+	 * @param y Ordinates.
+	 * @param x Abscissas.
+	 *
+	 * @return Angles in [-pi, pi], 0 when x and y are 0.
+	 */
+	template <class P>
+	typename P::type	__fastAtan2(typename P::type y, typename P::type x)
+	{
+		typedef typename P::type	type;
+
+		const type	zero = P::set(0.0f);
+		const type	absX = P::select(P::greater(zero, x), zero - x, x);
+		const type	absY = P::select(P::greater(zero, y), zero - y, y);
+		// Use the ratio in [0, 1], and atan(t) = pi/2 - atan(1/t) above 1
+		const typename P::mask	swap = P::greater(absY, absX);
+		const type	num = P::select(swap, absX, absY);
+		const type	den = P::select(swap, absY, absX);
+		const type	t = P::select(P::greater(den, zero), num / den, zero);
+		type		res = __fastAtan01<P>(t);
+
+		res = P::select(swap, P::set(1.57079632679490f) - res, res);
+		res = P::select(P::greater(zero, x), P::set(3.14159265358979f) - res, res);
+		return (P::select(P::greater(zero, y), zero - res, res));
+	}
+
+	/**
+	 * @brief Internal function for fast. Arc cosinus of float values.
+	 *
+	 * @param x Values in [-1, 1].
+	 *
+	 * @return Arc cosinus of x, in [0, pi].
+	 */
+	template <class P>
+	typename P::type	__fastAcos(typename P::type x)
+	{
+		const typename P::type	one = P::set(1.0f);
+
+		// acos(x) = atan2(sqrt(1 - x^2), x), (1 - x)(1 + x) keep precision near 1
+		return (__fastAtan2<P>(P::sqrt((one - x) * (one + x)), x));
+	}
+
+	/**
+	 * @brief Internal function for fast. Exponential of float values.
+	 *
+	 * @param x Values, clamped to [-87, 88].
+	 *
+	 * @return e^x.
+	 */
+	template <class P>
+	typename P::type	__fastExp(typename P::type x)
+	{
+		typedef typename P::type	type;
+
+		const type	low = P::set(-87.0f);
+		const type	high = P::set(88.0f);
+		const type	clamped = P::select(P::greater(x, high), high, P::select(P::greater(low, x), low, x));
+		// x = n * ln(2) + r, with ln(2) split in 2 floats
+		const type	n = P::floor(P::madd(clamped, P::set(1.44269504088896341f), P::set(0.5f)));
+		const type	r = (clamped - n * P::set(0.693359375f)) + n * P::set(2.12194440e-4f);
+		const type	poly = P::madd(P::madd(P::madd(P::madd(P::madd(P::set(1.9875691500e-4f), r, P::set(1.3981999507e-3f)),
+									r, P::set(8.3334519073e-3f)), r, P::set(4.1665795894e-2f)),
+									r, P::set(1.6666665459e-1f)), r, P::set(5.0000001201e-1f));
+
+		return ((P::madd(poly, r * r, r) + P::set(1.0f)) * P::exp2i(n));
+	}
+
+	/**
+	 * @brief Internal function for fast. Natural logarithm of float values.
+	 *
+	 * @param x Positive normal values.
+	 *
+	 * @return ln(x).
+	 */
+	template <class P>
+	typename P::type	__fastLog(typename P::type x)
+	{
+		typedef typename P::type	type;
+
+		const type	one = P::set(1.0f);
+		type		e;
+		type		m = P::frexp(x, e);
+		// Mantissa in [sqrt(0.5), sqrt(2)), then m - 1
+		const typename P::mask	low = P::greater(P::set(0.707106781186547524f), m);
+
+		e = P::select(low, e - one, e);
+		m = P::select(low, m + m - one, m - one);
+
+		const type	z = m * m;
+		type		poly = P::madd(P::madd(P::madd(P::set(7.0376836292e-2f), m, P::set(-1.1514610310e-1f)),
+									m, P::set(1.1676998740e-1f)), m, P::set(-1.2420140846e-1f));
+
+		poly = P::madd(P::madd(P::madd(poly, m, P::set(1.4249322787e-1f)), m, P::set(-1.6668057665e-1f)),
+						m, P::set(2.0000714765e-1f));
+		poly = P::madd(P::madd(poly, m, P::set(-2.4999993993e-1f)), m, P::set(3.3333331174e-1f));
+
+		// ln(x) = m - z / 2 + m z poly + e ln(2), with ln(2) split in 2 floats
+		const type	y = P::madd(e, P::set(-2.12194440e-4f), poly * m * z) - P::set(0.5f) * z;
+
+		return (P::madd(e, P::set(0.693359375f), m + y));
+	}
+}
+
+#endif
@@ -0,0 +1,89 @@
+#ifndef GM_FMA_HPP
+# define GM_FMA_HPP
+
+# include <gmath/config.hpp>
+
+# include <cmath>
+# include <type_traits>
+
+//**** FUNCTIONS ***************************************************************
+
+namespace gm {
+	/**
+	 * @brief Fused multiply-add, a * b + c with a single rounding.
+	 *
+	 * One instruction when the cpu has fma (-mfma, -march=haswell), a slow
+	 * library call otherwise. Integers use a * b + c, which is exact.
+	 *
+	 * @param a First factor.
+	 * @param b Second factor.
+	 * @param c Value to add.
+	 *
+	 * @return Result of a * b + c.
+	 */
+	template <typename T>
+	constexpr T	fma(const T &a, const T &b, const T &c)
+	{
+		return (std::is_floating_point<T>::value ? static_cast<T>(std::fma(a, b, c)) : a * b + c);
+	}
+
+	/**
+	 * @brief Internal function for fma. Multiply-add used by lerp, dot and
+	 * matrix products, fused only when GM_USE_FMA is defined.
+	 *
+	 * The types can differ, small integers and half are promoted by a * b
+	 * like in a * b + c. The fused version computes floating points in their
+	 * common type, so lerp(double, double, float) is fused too.
+	 *
+	 * @param a First factor.
+	 * @param b Second factor.
+	 * @param c Value to add.
+	 *
+	 * @return Result of a * b + c.
+	 */
+	template <typename T, typename U, typename V>
+	constexpr auto	__madd(const T &a, const U &b, const V &c) -> decltype(a * b + c)
+	{
+		return (a * b + c);
+	}
+
+# ifdef GM_USE_FMA
+	template <typename T, typename U>
+	constexpr typename std::enable_if<std::is_floating_point<T>::value && std::is_floating_point<U>::value,
+										typename std::common_type<T, U>::type>::type
+		__madd(const T &a, const U &b, const T &c)
+	{
+		typedef typename std::common_type<T, U>::type	R;
+
+		return (fma(static_cast<R>(a), static_cast<R>(b), static_cast<R>(c)));
+	}
+# endif
+
+	/**
+	 * @brief Internal function for fma. Sum of products a0 * b0 + a1 * b1 + ...
+	 * in the same order as written, each add fused when GM_USE_FMA is defined.
+	 *
+	 * @return Sum of the products of each pair.
+	 */
+	template <typename T>
+	constexpr T	__dot(const T &a0, const T &b0, const T &a1, const T &b1)
+	{
+		return (__madd(a1, b1, a0 * b0));
+	}
+
+	template <typename T>
+	constexpr T	__dot(const T &a0, const T &b0, const T &a1, const T &b1,
+						const T &a2, const T &b2)
+	{
+		return (__madd(a2, b2, __madd(a1, b1, a0 * b0)));
+	}
+
+	template <typename T>
+	constexpr T	__dot(const T &a0, const T &b0, const T &a1, const T &b1,
+						const T &a2, const T &b2, const T &a3, const T &b3)
+	{
+		return (__madd(a3, b3, __madd(a2, b2, __madd(a1, b1, a0 * b0))));
+	}
+}
+
+#endif
@@ -0,0 +1,419 @@
+#ifndef GM_HALF_HPP
+# define GM_HALF_HPP
+
+# include <gmath/config.hpp>
+# include <gmath/simd.hpp>
+# include <gmath/dispatch.hpp>
+# include <gmath/Vec2.hpp>
+# include <gmath/Vec3.hpp>
+# include <gmath/Vec4.hpp>
+# include <gmath/componentwise.hpp>
+
+# include <cstddef>
+# include <cstdint>
+# include <cstring>
+# include <functional>
+# include <type_traits>
+
+//**** HALF ********************************************************************
+// IEEE 754 binary16: 1 sign bit, 5 exponent bits, 10 mantissa bits, about 3
+// decimal digits up to 65504. Made to store vertices and snapshots in half the
+// memory, not to compute: every operation converts to float.
+
+namespace gm {
+	//**** STATIC FUNCTIONS DEFINE *********************************************
+
+	/**
+	 * @brief Internal function for half. Convert a float to binary16 bits,
+	 * rounded to nearest even. Overflows give infinity.
+	 *
+	 * @param value The float.
+	 *
+	 * @return The binary16 bits.
+	 */
+	inline std::uint16_t	__floatToHalf(float value)
+	{
+# ifdef GM_F16C
+		return (static_cast<std::uint16_t>(_cvtss_sh(value, _MM_FROUND_TO_NEAREST_INT)));
+# else
+		std::uint32_t	bits;
+		std::uint32_t	res;
+
+		std::memcpy(&bits, &value, sizeof(bits));
+
+		const std::uint32_t	sign = bits & 0x80000000u;
+
+		bits ^= sign;
+		// Overflow, infinity and NaN
+		if (bits >= 0x47800000u)
+			res = bits > 0x7F800000u ? 0x7E00u : 0x7C00u;
+		// Subnormal: adding 0.5 rounds to a multiple of 2^-24, the last bits
+		// are the result
+		else if (bits < 0x38800000u)
+		{
+			float	f;
+
+			std::memcpy(&f, &bits, sizeof(f));
+			f += 0.5f;
+			std::memcpy(&res, &f, sizeof(res));
+			res -= 0x3F000000u;
+		}
+		// Normal: exponent bias from 127 to 15, rounded on the 13 dropped bits
+		else
+			res = (bits + 0xC8000FFFu + ((bits >> 13) & 1u)) >> 13;
+		return (static_cast<std::uint16_t>(res | (sign >> 16)));
+# endif
+	}
+
+	/**
+	 * @brief Internal function for half. Convert binary16 bits to a float,
+	 * exactly.
+	 *
+	 * @param bits The binary16 bits.
+	 *
+	 * @return The float.
+	 */
+	inline float	__halfToFloat(std::uint16_t bits)
+	{
+# ifdef GM_F16C
+		return (_cvtsh_ss(bits));
+# else
+		std::uint32_t		res = static_cast<std::uint32_t>(bits & 0x7FFFu) << 13;
+		const std::uint32_t	exponent = res & 0x0F800000u;
+		float				f;
+
+		res += 0x38000000u;
+		// Infinity and NaN
+		if (exponent == 0x0F800000u)
+			res += 0x38000000u;
+		// Subnormal: 2^-14 * (1 + m) - 2^-14, normalized by the fpu
+		else if (exponent == 0)
+		{
+			res += 0x00800000u;
+			std::memcpy(&f, &res, sizeof(f));
+			f -= 6.103515625e-5f;
+			std::memcpy(&res, &f, sizeof(res));
+		}
+		res |= static_cast<std::uint32_t>(bits & 0x8000u) << 16;
+		std::memcpy(&f, &res, sizeof(f));
+		return (f);
+# endif
+	}
+
+	//**** CLASS DEFINE ********************************************************
+
+	/**
+	 * @brief Class for IEEE 754 half precision float.
+	 *
+	 * Converted from and to float implicitly, so arithmetic and comparisons
+	 * are done in float, and half are only rounded when stored.
+	 */
+	class half
+	{
+	public:
+		//**** INITIALISION ****************************************************
+		//---- Constructors ----------------------------------------------------
+
+		/**
+		 * @brief Default constructor of half class.
+		 *
+		 * @return The half at 0.
+		 */
+		constexpr half(void) : bits(0) {}
+
+		/**
+		 * @brief Copy constructor of half class.
+		 *
+		 * @param value The half to copy.
+		 *
+		 * @return The half copied from parameter.
+		 */
+		constexpr half(const half &value) = default;
+
+		/**
+		 * @brief Constructor of half class from float.
+		 *
+		 * @param value The float, rounded to nearest even.
+		 *
+		 * @return The nearest half, infinity above 65504.
+		 */
+		half(float value) : bits(__floatToHalf(value)) {}
+
+		//---- Destructor ------------------------------------------------------
+
+		~half() = default;
+
+		//**** ACCESSORS *******************************************************
+		//---- Getters ---------------------------------------------------------
+
+		/**
+		 * @brief Get the binary16 bits of the half.
+		 *
+		 * @return The bits.
+		 */
+		constexpr std::uint16_t	getBits(void) const
+		{
+			return (this->bits);
+		}
+
+		//---- Setters ---------------------------------------------------------
+
+		/**
+		 * @brief Set the binary16 bits of the half.
+		 *
+		 * @param bits The bits.
+		 */
+		void	setBits(std::uint16_t bits)
+		{
+			this->bits = bits;
+		}
+
+		//**** OPERATORS *******************************************************
+		//---- Copy operator ---------------------------------------------------
+
+		/**
+		 * @brief Copy operator of half class.
+		 *
+		 * @param value The half to copy.
+		 *
+		 * @return Reference on the half copied.
+		 */
+		half	&operator=(const half &value) = default;
+
+		//---- Conversion operator ---------------------------------------------
+
+		/**
+		 * @brief Convert the half to float, exactly.
+		 *
+		 * @return The float.
+		 */
+		operator float(void) const
+		{
+			return (__halfToFloat(this->bits));
+		}
+
+		//---- Assignement operators -------------------------------------------
+
+		/**
+		 * @brief Add a value, computed in float.
+		 *
+		 * @param value The value to add.
+		 *
+		 * @return Reference on the half.
+		 */
+		half	&operator+=(float value)
+		{
+			*this = half(static_cast<float>(*this) + value);
+
+			return (*this);
+		}
+
+		/**
+		 * @brief Subtract a value, computed in float.
+		 *
+		 * @param value The value to subtract.
+		 *
+		 * @return Reference on the half.
+		 */
+		half	&operator-=(float value)
+		{
+			*this = half(static_cast<float>(*this) - value);
+
+			return (*this);
+		}
+
+		/**
+		 * @brief Multiply by a value, computed in float.
+		 *
+		 * @param value The value to multiply by.
+		 *
+		 * @return Reference on the half.
+		 */
+		half	&operator*=(float value)
+		{
+			*this = half(static_cast<float>(*this) * value);
+
+			return (*this);
+		}
+
+		/**
+		 * @brief Divide by a value, computed in float.
+		 *
+		 * @param value The value to divide by.
+		 *
+		 * @return Reference on the half.
+		 */
+		half	&operator/=(float value)
+		{
+			*this = half(static_cast<float>(*this) / value);
+
+			return (*this);
+		}
+
+		//---- Arithmetic operators --------------------------------------------
+
+		/**
+		 * @brief Opposite of the half, exact.
+		 *
+		 * @return The half with the sign flipped.
+		 */
+		constexpr half	operator-(void) const
+		{
+			return (half(static_cast<std::uint16_t>(this->bits ^ 0x8000u), 0));
+		}
+
+	private:
+		std::uint16_t	bits;
+
+		/**
+		 * @brief Constructor of half class from bits, for constexpr.
+		 */
+		constexpr half(std::uint16_t bits, int) : bits(bits) {}
+	};
+
+	//**** EXTERNS OPERATORS ***************************************************
+	//---- Vector value operator -----------------------------------------------
+	// The operators of the vectors take a value of their own type, a half
+	// vector times a float (lerp, scaling) is computed here in float
+
+	template <template <typename> class V>
+	__EnableVec<V<half>, V<half> >	operator*(const V<half> &vec, float value)
+	{
+		return (__map(vec, [value](half x) { return (half(static_cast<float>(x) * value)); }));
+	}
+
+	template <template <typename> class V>
+	__EnableVec<V<half>, V<half> >	operator*(float value, const V<half> &vec)
+	{
+		return (vec * value);
+	}
+
+	template <template <typename> class V>
+	__EnableVec<V<half>, V<half> >	operator/(const V<half> &vec, float value)
+	{
+		return (__map(vec, [value](half x) { return (half(static_cast<float>(x) / value)); }));
+	}
+
+	//**** FUNCTIONS ***********************************************************
+	//---- Single conversions --------------------------------------------------
+
+	/**
+	 * @brief Round each component of a float vector to half.
+	 *
+	 * @param vec The float vector.
+	 *
+	 * @return The half vector.
+	 */
+	template <template <typename> class V>
+	__EnableVec<V<float>, V<half> >	toHalf(const V<float> &vec)
+	{
+		return (__map(vec, [](float x) { return (half(x)); }));
+	}
+
+	/**
+	 * @brief Convert each component of a half vector to float, exactly.
+	 *
+	 * @param vec The half vector.
+	 *
+	 * @return The float vector.
+	 */
+	template <template <typename> class V>
+	__EnableVec<V<half>, V<float> >	toFloat(const V<half> &vec)
+	{
+		return (__map(vec, [](half x) { return (static_cast<float>(x)); }));
+	}
+
+	//---- Batch conversions ---------------------------------------------------
+
+	/**
+	 * @brief Round a float array to half, with F16C when the cpu has it.
+	 *
+	 * @param src The floats.
+	 * @param dst The halfs.
+	 * @param count Number of values.
+	 */
+	inline void	toHalf(const float *src, half *dst, std::size_t count)
+	{
+		kernels().toHalf(src, reinterpret_cast<std::uint16_t *>(dst), count);
+	}
+
+	/**
+	 * @brief Convert a half array to float, with F16C when the cpu has it.
+	 *
+	 * @param src The halfs.
+	 * @param dst The floats.
+	 * @param count Number of values.
+	 */
+	inline void	toFloat(const half *src, float *dst, std::size_t count)
+	{
+		kernels().toFloat(reinterpret_cast<const std::uint16_t *>(src), dst, count);
+	}
+
+	/**
+	 * @brief Round a float vector array to half.
+	 *
+	 * @param src The float vectors.
+	 * @param dst The half vectors.
+	 * @param count Number of vectors.
+	 */
+	template <template <typename> class V>
+	__EnableVec<V<float>, void>	toHalf(const V<float> *src, V<half> *dst, std::size_t count)
+	{
+		toHalf(__floats(src), reinterpret_cast<half *>(dst), count * __VecComponents<V<float> >::value);
+	}
+
+	/**
+	 * @brief Convert a half vector array to float.
+	 *
+	 * @param src The half vectors.
+	 * @param dst The float vectors.
+	 * @param count Number of vectors.
+	 */
+	template <template <typename> class V>
+	__EnableVec<V<half>, void>	toFloat(const V<half> *src, V<float> *dst, std::size_t count)
+	{
+		toFloat(reinterpret_cast<const half *>(src), __floats(dst), count * __VecComponents<V<half> >::value);
+	}
+
+	//**** USINGS **************************************************************
+
+	/**
+	 * @brief Vector of 2 half, for storage and upload.
+	 */
+	using Vec2h = Vec2<half>;
+
+	/**
+	 * @brief Vector of 3 half, for storage and upload.
+	 */
+	using Vec3h = Vec3<half>;
+
+	/**
+	 * @brief Vector of 4 half, for storage and upload.
+	 */
+	using Vec4h = Vec4<half>;
+
+	//**** CHECKS **************************************************************
+
+	static_assert(sizeof(half) == 2 && std::is_trivially_copyable<half>::value,
+					"half must be 2 bytes and trivially copyable");
+	static_assert(sizeof(Vec2h) == 4 && sizeof(Vec3h) == 6 && sizeof(Vec4h) == 8,
+					"half vectors must be packed");
+}
+
+//**** HASH ********************************************************************
+
+namespace std {
+	/**
+	 * @brief Hash of a half, the one of its float so -0 and 0 are equal.
+	 */
+	template <>
+	struct hash<gm::half>
+	{
+		std::size_t	operator()(const gm::half &value) const
+		{
+			return (std::hash<float>{}(static_cast<float>(value)));
+		}
+	};
+}
+
+#endif
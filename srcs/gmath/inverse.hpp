@@ -4,181 +4,78 @@
 # include <gmath/Mat2.hpp>
 # include <gmath/Mat3.hpp>
 # include <gmath/Mat4.hpp>
+# include <gmath/simd.hpp>
 
 # include <cmath>
+# include <limits>
+# include <stdexcept>
 
 //**** VARIABLES ***************************************************************
 
 //**** FUNCTIONS ***************************************************************
 
 namespace gm {
-//**** MATX ********************************************************************
-//---- Utils -------------------------------------------------------------------
+//**** Utils *******************************************************************
 	/**
-	 * @brief Internal function for inverse. Multiply matrix line by a value.
+	 * @brief Internal function for inverse. Default singularity epsilon.
 	 *
-	 * @tparam MAT The matrix class.
 	 * @tparam T The value into matrix class.
-	 * @param size Size of matrix.
-	 * @param mat1 The matrix to change.
-	 * @param mat2 The second matrix to change.
-	 * @param y The line y coordonates.
-	 * @param mult The value to multiply.
+	 *
+	 * @return Smallest normal value for floating types (1 / det can't
+	 * overflow above it), 0 for integer types.
 	 */
-	template <template<class> class MAT, typename T>
-	void	__mutiply_line(
-				int size, MAT<T> &mat1, MAT<T> &mat2,
-				int y, const T &mult)
+	template <typename T>
+	constexpr T	__inverseEpsilon(void)
 	{
-		const int	ly = y * size;
-		for (int i = 0; i < size; i++)
-		{
-			mat1.values[ly + i] *= mult;
-			mat2.values[ly + i] *= mult;
-		}
+		return (std::numeric_limits<T>::is_integer ? T() : std::numeric_limits<T>::min());
 	}
+
 	/**
-	 * @brief Internal function for inverse. Add matrix line with an other.
+	 * @brief Internal function for inverse. Check if a determinant is usable.
 	 *
-	 * @tparam MAT The matrix class.
-	 * @tparam T The value into matrix class.
-	 * @param size Size of matrix.
-	 * @param mat1 The matrix to change.
-	 * @param mat2 The second matrix to change.
-	 * @param l1 The line id to modify.
-	 * @param l2 The line id to add.
-	 * @param l2Mult The value to multiply l2 before add it to l1.
-	 */
-	template <template<class> class MAT, typename T>
-	void	__add_line(
-				int size, MAT<T> &mat1, MAT<T> &mat2,
-				int l1, int l2, const T &l2Mult)
-	{
-		const int	l1y = l1 * size;
-		const int	l2y = l2 * size;
-		for (int i = 0 * size; i < size; i++)
-		{
-			mat1.values[l1y + i] += mat1.values[l2y + i] * l2Mult;
-			mat2.values[l1y + i] += mat2.values[l2y + i] * l2Mult;
-		}
-	}
-	/**
-	 * @brief Internal function for inverse. Swap 2 matrix line.
-	 *
-	 * @tparam MAT The matrix class.
-	 * @tparam T The value into matrix class.
-	 * @param size Size of matrix.
-	 * @param mat1 The matrix to change.
-	 * @param mat2 The second matrix to change.
-	 * @param l1 The line id to swap.
-	 * @param l2 The line id to swap with.
+	 * @return True if det is outside [-epsilon, epsilon].
 	 */
-	template <template<class> class MAT, typename T>
-	void	__swap_line(
-				int size, MAT<T> &mat1, MAT<T> &mat2,
-				int l1, int l2)
+	template <typename T>
+	bool	__isInversible(T det, T epsilon) noexcept
 	{
-		const int	l1y = l1 * size;
-		const int	l2y = l2 * size;
-		int	tmp;
-		for (int i = 0 * size; i < size; i++)
-		{
-			tmp = mat1.values[l1y + i];
-			mat1.values[l1y + i] = mat1.values[l2y + i];
-			mat1.values[l2y + i] = tmp;
-
-			tmp = mat2.values[l1y + i];
-			mat2.values[l1y + i] = mat2.values[l2y + i];
-			mat2.values[l2y + i] = tmp;
-		}
+		return (det > epsilon || det < -epsilon);
 	}
 
-//---- Function ----------------------------------------------------------------
+//**** Typed function **********************************************************
+// The inverse of the transpose is the transpose of the inverse: values are
+// read and written in storage order, the same code inverses both layouts.
+//---- Mat2 --------------------------------------------------------------------
 	/**
-	 * @brief Internal function for inverse. Inverse the matrix.
+	 * @brief Inverse the 2x2 matrix, with its adjugate. Never throw.
 	 *
-	 * @tparam MAT The matrix class.
 	 * @tparam T The value into matrix class.
-	 * @param size Size of matrix.
 	 * @param mat The matrix to inverse.
+	 * @param out The inverse matrix, untouched if mat is singular. Can be mat.
+	 * @param det If not nullptr, receive the determinant of mat.
+	 * @param epsilon Matrix is singular when |determinant| <= epsilon.
 	 *
-	 * @exception Throw an runtime_error if the matrix isn't inversable.
-	 * @return The inverse matrix.
+	 * @return True if the matrix was inversed, false if it's singular.
 	 */
-	template <template<class> class MAT, typename T>
-	MAT<T>	__inverse(int size, const MAT<T> &mat)
-	{
-		if (mat.determinant() == static_cast<T>(0))
-			throw std::runtime_error("Matrix cannot be inverse");
-
-		MAT<T>	copy = mat;
-		MAT<T>	res = MAT<T>::identity();
-		const	T	zero = static_cast<T>(0);
-		const	T	one = static_cast<T>(1);
-
-		int		diag = 0;
-		T		diagVal;
-		int		y;
-		T		tmp;
-
-		while (diag < size)
-		{
-			// Check which line take
-			diagVal = copy.values[diag * size + diag];
-			if (diagVal == zero)
-			{
-				y = diag + 1;
-
-				while (y < size)
-				{
-					diagVal = copy.values[y * size + diag];
-					if (diagVal != zero)
-						break;
-					y++;
-				}
-
-				if (y == size)
-					throw std::runtime_error("Matrix inverse error");
-
-				__swap_line(size, copy, res, diag, y);
-			}
-
-			// Put diagonal number to 1
-			if (diagVal != one)
-			{
-				T	inv = one / diagVal;
-				__mutiply_line(size, copy, res, diag, inv);
-			}
-
-			// Put 0 above diagonal number
-			y = diag - 1;
-			while (y >= 0)
-			{
-				tmp = copy.values[y * size + diag];
-				if (tmp != zero)
-					__add_line(size, copy, res, y, diag, -tmp);
-				y--;
-			}
-
-			// Put 0 bellow diagonal number
-			y = diag + 1;
-			while (y < size)
-			{
-				tmp = copy.values[y * size + diag];
-				if (tmp != zero)
-					__add_line(size, copy, res, y, diag, -tmp);
-				y++;
-			}
-
-			diag++;
-		}
+	template <typename T, class L>
+	bool	tryInverse(const Mat2<T, L> &mat, Mat2<T, L> &out, T *det = nullptr,
+				T epsilon = __inverseEpsilon<T>()) noexcept
+	{
+		const T	*m = mat.values;
+		const T	tmpDet = m[0] * m[3] - m[1] * m[2];
 
-		return (res);
-	}
+		if (det != nullptr)
+			*det = tmpDet;
+		if (!__isInversible(tmpDet, epsilon))
+			return (false);
 
+		const T	invDet = static_cast<T>(1) / tmpDet;
+		const T	res[GM_MAT2_SIZE] = { m[3] * invDet, -m[1] * invDet,
+									 -m[2] * invDet,  m[0] * invDet};
+
+		out = Mat2<T, L>(res);
+		return (true);
+	}
 
-//**** Typed function **********************************************************
-//---- Mat2 --------------------------------------------------------------------
 	/**
 	 * @brief Inverse the 2x2 matrix.
 	 *
@@ -188,13 +85,59 @@ namespace gm {
 	 * @exception Throw an runtime_error if the matrix cannot be inverse.
 	 * @return The inverse matrix.
 	 */
-	template <typename T>
-	Mat2<T>	inverse(const Mat2<T> &mat)
+	template <typename T, class L>
+	Mat2<T, L>	inverse(const Mat2<T, L> &mat)
 	{
-		return	(__inverse(2, mat));
+		Mat2<T, L>	res;
+
+		if (!tryInverse(mat, res))
+			GM_THROW(std::runtime_error("Matrix cannot be inverse"));
+		return (res);
 	}
 
 //---- Mat3 --------------------------------------------------------------------
+	/**
+	 * @brief Inverse the 3x3 matrix, with its adjugate. Never throw.
+	 *
+	 * @tparam T The value into matrix class.
+	 * @param mat The matrix to inverse.
+	 * @param out The inverse matrix, untouched if mat is singular. Can be mat.
+	 * @param det If not nullptr, receive the determinant of mat.
+	 * @param epsilon Matrix is singular when |determinant| <= epsilon.
+	 *
+	 * @return True if the matrix was inversed, false if it's singular.
+	 */
+	template <typename T, class L>
+	bool	tryInverse(const Mat3<T, L> &mat, Mat3<T, L> &out, T *det = nullptr,
+				T epsilon = __inverseEpsilon<T>()) noexcept
+	{
+		const T	*m = mat.values;
+		// Cofactors of first column, reused for determinant
+		const T	c0 = m[4] * m[8] - m[5] * m[7];
+		const T	c3 = m[5] * m[6] - m[3] * m[8];
+		const T	c6 = m[3] * m[7] - m[4] * m[6];
+		const T	tmpDet = m[0] * c0 + m[1] * c3 + m[2] * c6;
+
+		if (det != nullptr)
+			*det = tmpDet;
+		if (!__isInversible(tmpDet, epsilon))
+			return (false);
+
+		const T	invDet = static_cast<T>(1) / tmpDet;
+		const T	res[GM_MAT3_SIZE] = {c0 * invDet,
+									(m[2] * m[7] - m[1] * m[8]) * invDet,
+									(m[1] * m[5] - m[2] * m[4]) * invDet,
+									c3 * invDet,
+									(m[0] * m[8] - m[2] * m[6]) * invDet,
+									(m[2] * m[3] - m[0] * m[5]) * invDet,
+									c6 * invDet,
+									(m[1] * m[6] - m[0] * m[7]) * invDet,
+									(m[0] * m[4] - m[1] * m[3]) * invDet};
+
+		out = Mat3<T, L>(res);
+		return (true);
+	}
+
 	/**
 	 * @brief Inverse the 3x3 matrix.
 	 *
@@ -204,13 +147,201 @@ namespace gm {
 	 * @exception Throw an runtime_error if the matrix cannot be inverse.
 	 * @return The inverse matrix.
 	 */
-	template <typename T>
-	Mat3<T>	inverse(const Mat3<T> &mat)
+	template <typename T, class L>
+	Mat3<T, L>	inverse(const Mat3<T, L> &mat)
 	{
-		return	(__inverse(3, mat));
+		Mat3<T, L>	res;
+
+		if (!tryInverse(mat, res))
+			GM_THROW(std::runtime_error("Matrix cannot be inverse"));
+		return (res);
 	}
 
 //---- Mat4 --------------------------------------------------------------------
+	/**
+	 * @brief Inverse the 4x4 matrix, with its cofactors. Never throw.
+	 *
+	 * 2x2 sub determinants of the two first and two last lines are shared by
+	 * the determinant and every cofactor.
+	 *
+	 * @tparam T The value into matrix class.
+	 * @param mat The matrix to inverse.
+	 * @param out The inverse matrix, untouched if mat is singular. Can be mat.
+	 * @param det If not nullptr, receive the determinant of mat.
+	 * @param epsilon Matrix is singular when |determinant| <= epsilon.
+	 *
+	 * @return True if the matrix was inversed, false if it's singular.
+	 */
+	template <typename T, class L>
+	bool	tryInverse(const Mat4<T, L> &mat, Mat4<T, L> &out, T *det = nullptr,
+				T epsilon = __inverseEpsilon<T>()) noexcept
+	{
+		const T	*m = mat.values;
+		// Sub determinants of lines 0 and 1
+		const T	s0 = m[0] * m[5] - m[4] * m[1];
+		const T	s1 = m[0] * m[6] - m[4] * m[2];
+		const T	s2 = m[0] * m[7] - m[4] * m[3];
+		const T	s3 = m[1] * m[6] - m[5] * m[2];
+		const T	s4 = m[1] * m[7] - m[5] * m[3];
+		const T	s5 = m[2] * m[7] - m[6] * m[3];
+		// Sub determinants of lines 2 and 3
+		const T	c0 = m[8] * m[13] - m[12] * m[9];
+		const T	c1 = m[8] * m[14] - m[12] * m[10];
+		const T	c2 = m[8] * m[15] - m[12] * m[11];
+		const T	c3 = m[9] * m[14] - m[13] * m[10];
+		const T	c4 = m[9] * m[15] - m[13] * m[11];
+		const T	c5 = m[10] * m[15] - m[14] * m[11];
+		const T	tmpDet = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+
+		if (det != nullptr)
+			*det = tmpDet;
+		if (!__isInversible(tmpDet, epsilon))
+			return (false);
+
+		const T		invDet = static_cast<T>(1) / tmpDet;
+		Mat4<T, L>	res;
+
+		res.values[ 0] = ( m[ 5] * c5 - m[ 6] * c4 + m[ 7] * c3) * invDet;
+		res.values[ 1] = (-m[ 1] * c5 + m[ 2] * c4 - m[ 3] * c3) * invDet;
+		res.values[ 2] = ( m[13] * s5 - m[14] * s4 + m[15] * s3) * invDet;
+		res.values[ 3] = (-m[ 9] * s5 + m[10] * s4 - m[11] * s3) * invDet;
+		res.values[ 4] = (-m[ 4] * c5 + m[ 6] * c2 - m[ 7] * c1) * invDet;
+		res.values[ 5] = ( m[ 0] * c5 - m[ 2] * c2 + m[ 3] * c1) * invDet;
+		res.values[ 6] = (-m[12] * s5 + m[14] * s2 - m[15] * s1) * invDet;
+		res.values[ 7] = ( m[ 8] * s5 - m[10] * s2 + m[11] * s1) * invDet;
+		res.values[ 8] = ( m[ 4] * c4 - m[ 5] * c2 + m[ 7] * c0) * invDet;
+		res.values[ 9] = (-m[ 0] * c4 + m[ 1] * c2 - m[ 3] * c0) * invDet;
+		res.values[10] = ( m[12] * s4 - m[13] * s2 + m[15] * s0) * invDet;
+		res.values[11] = (-m[ 8] * s4 + m[ 9] * s2 - m[11] * s0) * invDet;
+		res.values[12] = (-m[ 4] * c3 + m[ 5] * c1 - m[ 6] * c0) * invDet;
+		res.values[13] = ( m[ 0] * c3 - m[ 1] * c1 + m[ 2] * c0) * invDet;
+		res.values[14] = (-m[12] * s3 + m[13] * s1 - m[14] * s0) * invDet;
+		res.values[15] = ( m[ 8] * s3 - m[ 9] * s1 + m[10] * s0) * invDet;
+
+		out = res;
+		return (true);
+	}
+
+# ifdef GM_SSE2
+//---- Mat4 simd ---------------------------------------------------------------
+	// Shuffle with lanes in reading order (x, y, z, w)
+#  define GM_SHUFFLE(a, b, x, y, z, w) _mm_shuffle_ps(a, b, _MM_SHUFFLE(w, z, y, x))
+#  define GM_SWIZZLE(a, x, y, z, w) GM_SHUFFLE(a, a, x, y, z, w)
+
+	/**
+	 * @brief Internal function for inverse. Product of 2x2 matrices stored
+	 * in registers.
+	 *
+	 * @return a * b.
+	 */
+	inline __m128	__mat2Mul(__m128 a, __m128 b)
+	{
+		return (_mm_add_ps(_mm_mul_ps(a, GM_SWIZZLE(b, 0, 3, 0, 3)),
+						_mm_mul_ps(GM_SWIZZLE(a, 1, 0, 3, 2), GM_SWIZZLE(b, 2, 1, 2, 1))));
+	}
+
+	/**
+	 * @brief Internal function for inverse. Product of the adjugate of a 2x2
+	 * matrix by a 2x2 matrix.
+	 *
+	 * @return adjugate(a) * b.
+	 */
+	inline __m128	__mat2AdjMul(__m128 a, __m128 b)
+	{
+		return (_mm_sub_ps(_mm_mul_ps(GM_SWIZZLE(a, 3, 3, 0, 0), b),
+						_mm_mul_ps(GM_SWIZZLE(a, 1, 1, 2, 2), GM_SWIZZLE(b, 2, 3, 0, 1))));
+	}
+
+	/**
+	 * @brief Internal function for inverse. Product of a 2x2 matrix by the
+	 * adjugate of a 2x2 matrix.
+	 *
+	 * @return a * adjugate(b).
+	 */
+	inline __m128	__mat2MulAdj(__m128 a, __m128 b)
+	{
+		return (_mm_sub_ps(_mm_mul_ps(a, GM_SWIZZLE(b, 3, 0, 3, 0)),
+						_mm_mul_ps(GM_SWIZZLE(a, 1, 0, 3, 2), GM_SWIZZLE(b, 2, 1, 2, 1))));
+	}
+
+	/**
+	 * @brief Inverse the 4x4 float matrix with SSE. Never throw.
+	 *
+	 * The matrix is split in 4 blocks of 2x2 matrices:
+	 * | A B |
+	 * | C D |
+	 * inverse is computed from the blocks adjugates and determinants, see
+	 * "Fast 4x4 Matrix Inverse with SSE SIMD, Explained" (Eric Zhang).
+	 *
+	 * @param mat The matrix to inverse.
+	 * @param out The inverse matrix, untouched if mat is singular. Can be mat.
+	 * @param det If not nullptr, receive the determinant of mat.
+	 * @param epsilon Matrix is singular when |determinant| <= epsilon.
+	 *
+	 * @return True if the matrix was inversed, false if it's singular.
+	 */
+	template <class L>
+	bool	tryInverse(const Mat4<float, L> &mat, Mat4<float, L> &out, float *det = nullptr,
+				float epsilon = __inverseEpsilon<float>()) noexcept
+	{
+		const __m128	r0 = _mm_loadu_ps(mat.values);
+		const __m128	r1 = _mm_loadu_ps(mat.values + 4);
+		const __m128	r2 = _mm_loadu_ps(mat.values + 8);
+		const __m128	r3 = _mm_loadu_ps(mat.values + 12);
+
+		// Blocks, as 2x2 matrices in one register
+		const __m128	a = _mm_movelh_ps(r0, r1);
+		const __m128	b = _mm_movehl_ps(r1, r0);
+		const __m128	c = _mm_movelh_ps(r2, r3);
+		const __m128	d = _mm_movehl_ps(r3, r2);
+
+		// Blocks determinants (|A|, |B|, |C|, |D|)
+		const __m128	detSub = _mm_sub_ps(
+				_mm_mul_ps(GM_SHUFFLE(r0, r2, 0, 2, 0, 2), GM_SHUFFLE(r1, r3, 1, 3, 1, 3)),
+				_mm_mul_ps(GM_SHUFFLE(r0, r2, 1, 3, 1, 3), GM_SHUFFLE(r1, r3, 0, 2, 0, 2)));
+		const __m128	detA = GM_SWIZZLE(detSub, 0, 0, 0, 0);
+		const __m128	detB = GM_SWIZZLE(detSub, 1, 1, 1, 1);
+		const __m128	detC = GM_SWIZZLE(detSub, 2, 2, 2, 2);
+		const __m128	detD = GM_SWIZZLE(detSub, 3, 3, 3, 3);
+
+		const __m128	dc = __mat2AdjMul(d, c);
+		const __m128	ab = __mat2AdjMul(a, b);
+		// Adjugates of the inverse blocks X Y Z W
+		__m128	x = _mm_sub_ps(_mm_mul_ps(detD, a), __mat2Mul(b, dc));
+		__m128	w = _mm_sub_ps(_mm_mul_ps(detA, d), __mat2Mul(c, ab));
+		__m128	y = _mm_sub_ps(_mm_mul_ps(detB, c), __mat2MulAdj(d, ab));
+		__m128	z = _mm_sub_ps(_mm_mul_ps(detC, b), __mat2MulAdj(a, dc));
+
+		// |M| = |A| |D| + |B| |C| - trace(ab * dc)
+		const __m128	trace = __hsum(_mm_mul_ps(ab, GM_SWIZZLE(dc, 0, 2, 1, 3)));
+		const __m128	detM = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD),
+												_mm_mul_ps(detB, detC)), trace);
+
+		if (det != nullptr)
+			*det = _mm_cvtss_f32(detM);
+		if (!__isInversible(_mm_cvtss_f32(detM), epsilon))
+			return (false);
+
+		const __m128	invDet = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), detM);
+
+		x = _mm_mul_ps(x, invDet);
+		y = _mm_mul_ps(y, invDet);
+		z = _mm_mul_ps(z, invDet);
+		w = _mm_mul_ps(w, invDet);
+
+		// Adjugate of blocks and store in lines
+		_mm_storeu_ps(out.values, GM_SHUFFLE(x, y, 3, 1, 3, 1));
+		_mm_storeu_ps(out.values + 4, GM_SHUFFLE(x, y, 2, 0, 2, 0));
+		_mm_storeu_ps(out.values + 8, GM_SHUFFLE(z, w, 3, 1, 3, 1));
+		_mm_storeu_ps(out.values + 12, GM_SHUFFLE(z, w, 2, 0, 2, 0));
+		return (true);
+	}
+
+#  undef GM_SWIZZLE
+#  undef GM_SHUFFLE
+# endif
+
+//---- Mat4 wrapper ------------------------------------------------------------
 	/**
 	 * @brief Inverse the 4x4 matrix.
 	 *
@@ -220,10 +351,190 @@ namespace gm {
 	 * @exception Throw an runtime_error if the matrix cannot be inverse.
 	 * @return The inverse matrix.
 	 */
-	template <typename T>
-	Mat4<T>	inverse(const Mat4<T> &mat)
+	template <typename T, class L>
+	Mat4<T, L>	inverse(const Mat4<T, L> &mat)
+	{
+		Mat4<T, L>	res;
+
+		if (!tryInverse(mat, res))
+			GM_THROW(std::runtime_error("Matrix cannot be inverse"));
+		return (res);
+	}
+
+//**** Transforms **************************************************************
+//---- Generic -----------------------------------------------------------------
+	/**
+	 * @brief Inverse a rigid 4x4 transform (rotation and translation only).
+	 *
+	 * The rotation is transposed and the translation rotated back, the
+	 * result is wrong if mat has a scale, a shear or a projection.
+	 *
+	 * @tparam T The value into matrix class.
+	 * @param mat The rigid transform to inverse.
+	 *
+	 * @return The inverse transform.
+	 */
+	template <typename T, class L>
+	Mat4<T, L>	inverseRigid(const Mat4<T, L> &mat) noexcept
 	{
-		return	(__inverse(4, mat));
+		const Mat4<T>	rows(mat);
+		const T			*m = rows.values;
+
+		return (Mat4<T, L>(m[0], m[4], m[ 8], -(m[0] * m[3] + m[4] * m[7] + m[ 8] * m[11]),
+						m[1], m[5], m[ 9], -(m[1] * m[3] + m[5] * m[7] + m[ 9] * m[11]),
+						m[2], m[6], m[10], -(m[2] * m[3] + m[6] * m[7] + m[10] * m[11]),
+						T(), T(), T(), static_cast<T>(1)));
+	}
+
+	/**
+	 * @brief Inverse an affine 4x4 transform (last line is 0 0 0 1). Never
+	 * throw.
+	 *
+	 * Only the 3x3 block is inversed, the translation is rotated back with
+	 * it. The result is wrong if mat has a projection.
+	 *
+	 * @tparam T The value into matrix class.
+	 * @param mat The affine transform to inverse.
+	 * @param out The inverse transform, untouched if mat is singular. Can be mat.
+	 * @param det If not nullptr, receive the determinant of mat.
+	 * @param epsilon Matrix is singular when |determinant| <= epsilon.
+	 *
+	 * @return True if the matrix was inversed, false if it's singular.
+	 */
+	template <typename T, class L>
+	bool	tryInverseAffine(const Mat4<T, L> &mat, Mat4<T, L> &out, T *det = nullptr,
+				T epsilon = __inverseEpsilon<T>()) noexcept
+	{
+		const Mat4<T>	rows(mat);
+		const T			*m = rows.values;
+		Mat3<T>			inv;
+
+		if (!tryInverse(Mat3<T>(m[0], m[1], m[ 2],
+								m[4], m[5], m[ 6],
+								m[8], m[9], m[10]), inv, det, epsilon))
+			return (false);
+
+		const T	*i = inv.values;
+
+		out = Mat4<T, L>(i[0], i[1], i[2], -(i[0] * m[3] + i[1] * m[7] + i[2] * m[11]),
+					  i[3], i[4], i[5], -(i[3] * m[3] + i[4] * m[7] + i[5] * m[11]),
+					  i[6], i[7], i[8], -(i[6] * m[3] + i[7] * m[7] + i[8] * m[11]),
+					  T(), T(), T(), static_cast<T>(1));
+		return (true);
+	}
+
+# ifdef GM_SSE2
+//---- Simd --------------------------------------------------------------------
+	// Lines are loaded from values: RowMajor only, ColumnMajor uses the generic
+	// functions.
+
+	/**
+	 * @brief Internal function for inverse. Build and store an affine inverse.
+	 *
+	 * @param x0 First column of the inverse 3x3 block, last lane at 0.
+	 * @param x1 Second column of the inverse 3x3 block, last lane at 0.
+	 * @param x2 Third column of the inverse 3x3 block, last lane at 0.
+	 * @param r0 First line of the transform, translation x in last lane.
+	 * @param r1 Second line of the transform, translation y in last lane.
+	 * @param r2 Third line of the transform, translation z in last lane.
+	 * @param out The matrix to store the inverse.
+	 */
+	inline void	__storeAffineInverse(__m128 x0, __m128 x1, __m128 x2,
+					__m128 r0, __m128 r1, __m128 r2, Mat4<float> &out)
+	{
+		// (-inverse * translation, 1)
+		__m128	t = _mm_add_ps(_mm_add_ps(
+						_mm_mul_ps(x0, _mm_shuffle_ps(r0, r0, _MM_SHUFFLE(3, 3, 3, 3))),
+						_mm_mul_ps(x1, _mm_shuffle_ps(r1, r1, _MM_SHUFFLE(3, 3, 3, 3)))),
+						_mm_mul_ps(x2, _mm_shuffle_ps(r2, r2, _MM_SHUFFLE(3, 3, 3, 3))));
+
+		t = _mm_sub_ps(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f), t);
+		_MM_TRANSPOSE4_PS(x0, x1, x2, t);
+		_mm_storeu_ps(out.values, x0);
+		_mm_storeu_ps(out.values + 4, x1);
+		_mm_storeu_ps(out.values + 8, x2);
+		_mm_storeu_ps(out.values + 12, t);
+	}
+
+	/**
+	 * @brief Inverse a rigid 4x4 float transform with SSE.
+	 *
+	 * @param mat The rigid transform to inverse.
+	 *
+	 * @return The inverse transform.
+	 */
+	inline Mat4<float>	inverseRigid(const Mat4<float> &mat) noexcept
+	{
+		const __m128	mask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128	r0 = _mm_loadu_ps(mat.values);
+		const __m128	r1 = _mm_loadu_ps(mat.values + 4);
+		const __m128	r2 = _mm_loadu_ps(mat.values + 8);
+		Mat4<float>		res;
+
+		// Columns of the transposed rotation are its lines
+		__storeAffineInverse(_mm_and_ps(r0, mask), _mm_and_ps(r1, mask), _mm_and_ps(r2, mask),
+							r0, r1, r2, res);
+		return (res);
+	}
+
+	/**
+	 * @brief Inverse an affine 4x4 float transform with SSE. Never throw.
+	 *
+	 * Columns of the 3x3 inverse are cross products of its lines.
+	 *
+	 * @param mat The affine transform to inverse.
+	 * @param out The inverse transform, untouched if mat is singular. Can be mat.
+	 * @param det If not nullptr, receive the determinant of mat.
+	 * @param epsilon Matrix is singular when |determinant| <= epsilon.
+	 *
+	 * @return True if the matrix was inversed, false if it's singular.
+	 */
+	inline bool	tryInverseAffine(const Mat4<float> &mat, Mat4<float> &out, float *det = nullptr,
+					float epsilon = __inverseEpsilon<float>()) noexcept
+	{
+		const __m128	mask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128	r0 = _mm_loadu_ps(mat.values);
+		const __m128	r1 = _mm_loadu_ps(mat.values + 4);
+		const __m128	r2 = _mm_loadu_ps(mat.values + 8);
+		const __m128	l0 = _mm_and_ps(r0, mask);
+		const __m128	l1 = _mm_and_ps(r1, mask);
+		const __m128	l2 = _mm_and_ps(r2, mask);
+		const __m128	x0 = __cross3(l1, l2);
+		const __m128	tmpDet = __dot4(l0, x0);
+
+		if (det != nullptr)
+			*det = _mm_cvtss_f32(tmpDet);
+		if (!__isInversible(_mm_cvtss_f32(tmpDet), epsilon))
+			return (false);
+
+		const __m128	invDet = _mm_div_ps(_mm_set1_ps(1.0f), tmpDet);
+
+		__storeAffineInverse(_mm_mul_ps(x0, invDet),
+							_mm_mul_ps(__cross3(l2, l0), invDet),
+							_mm_mul_ps(__cross3(l0, l1), invDet),
+							r0, r1, r2, out);
+		return (true);
+	}
+# endif
+
+//---- Wrapper -----------------------------------------------------------------
+	/**
+	 * @brief Inverse an affine 4x4 transform (last line is 0 0 0 1).
+	 *
+	 * @tparam T The value into matrix class.
+	 * @param mat The affine transform to inverse.
+	 *
+	 * @exception Throw an runtime_error if the matrix cannot be inverse.
+	 * @return The inverse transform.
+	 */
+	template <typename T, class L>
+	Mat4<T, L>	inverseAffine(const Mat4<T, L> &mat)
+	{
+		Mat4<T, L>	res;
+
+		if (!tryInverseAffine(mat, res))
+			GM_THROW(std::runtime_error("Matrix cannot be inverse"));
+		return (res);
 	}
 }
 
@@ -0,0 +1,1509 @@
+// Batch kernels, compiled once per simd level (see meson.build).
+// GM_KERNEL_LEVEL selects the pack type and GM_KERNEL_NAMESPACE the namespace
+// of the level, so every level has its own symbols.
+// Only include headers without inline functions here: an inline function
+// compiled with avx2 could be picked by the linker for the whole library.
+
+#include <gmath/dispatch.hpp>
+// Templates only, instantiated below with the packs of this level
+#include <gmath/fastPoly.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+#ifndef GM_KERNEL_LEVEL
+# define GM_KERNEL_LEVEL 0
+# define GM_KERNEL_NAMESPACE scalar
+#endif
+
+#if GM_KERNEL_LEVEL > 0
+# include <immintrin.h>
+#else
+# define _MM_SHUFFLE(z, y, x, w) (((z) << 6) | ((y) << 4) | ((x) << 2) | (w))
+#endif
+
+namespace gm {
+namespace GM_KERNEL_NAMESPACE {
+namespace {
+	//**** PACKS ***************************************************************
+	// Packs share the same interface, kernels run the widest pack then the
+	// scalar one for the remaining values.
+	// Simd types support + - * / with gcc and clang vector extensions.
+
+	struct	Scalar
+	{
+		typedef float			type;
+		typedef bool			mask;
+		typedef std::uint32_t	itype;
+		static const std::size_t	size = 1;
+
+		static type	load(const float *ptr) { return (*ptr); }
+		static void	store(float *ptr, type value) { *ptr = value; }
+		static type	set(float value) { return (value); }
+		static type	madd(type a, type b, type c) { return (a * b + c); }
+		static type	sqrt(type a) { return (__builtin_sqrtf(a)); }
+		static type	rsqrt(type a) { return (1.0f / __builtin_sqrtf(a)); }
+		static mask	greater(type a, type b) { return (a > b); }
+		// One bit per value, first value in bit 0
+		static unsigned int	bits(mask m) { return (m ? 1u : 0u); }
+		static type	select(mask m, type a, type b) { return (m ? a : b); }
+		static type	min(type a, type b) { return (a < b ? a : b); }
+		static type	max(type a, type b) { return (a > b ? a : b); }
+		static type	abs(type a) { return (__builtin_fabsf(a)); }
+		static type	floor(type a) { return (__builtin_floorf(a)); }
+		static type	ceil(type a) { return (__builtin_ceilf(a)); }
+		static type	trunc(type a) { return (__builtin_truncf(a)); }
+		static type	exp2i(type n)
+		{
+			const unsigned int	bits = static_cast<unsigned int>(static_cast<int>(n) + 127) << 23;
+			float				res;
+
+			__builtin_memcpy(&res, &bits, sizeof(res));
+			return (res);
+		}
+		static type	frexp(type a, type &e)
+		{
+			unsigned int	bits;
+			float			res;
+
+			__builtin_memcpy(&bits, &a, sizeof(bits));
+			e = static_cast<float>(static_cast<int>((bits >> 23) & 0xFF) - 126);
+			bits = (bits & 0x807FFFFFu) | 0x3F000000u;
+			__builtin_memcpy(&res, &bits, sizeof(res));
+			return (res);
+		}
+
+		// binary16 values, same results as F16C (round to nearest even) but
+		// NaN become the default quiet NaN
+		static type	loadHalf(const std::uint16_t *ptr)
+		{
+			const unsigned int	h = *ptr;
+			unsigned int		bits = (h & 0x7FFFu) << 13;
+			const unsigned int	exponent = bits & 0x0F800000u;
+			float				res;
+
+			// Exponent bias from 15 to 127
+			bits += 0x38000000u;
+			if (exponent == 0x0F800000u)
+				bits += 0x38000000u;
+			else if (exponent == 0)
+			{
+				// Subnormal: 2^-14 * (1 + m) - 2^-14, normalized by the fpu
+				bits += 0x00800000u;
+				__builtin_memcpy(&res, &bits, sizeof(res));
+				res -= 6.103515625e-5f;
+				__builtin_memcpy(&bits, &res, sizeof(bits));
+			}
+			bits |= (h & 0x8000u) << 16;
+			__builtin_memcpy(&res, &bits, sizeof(res));
+			return (res);
+		}
+		static void	storeHalf(std::uint16_t *ptr, type value)
+		{
+			unsigned int		bits;
+			unsigned int		res;
+
+			__builtin_memcpy(&bits, &value, sizeof(bits));
+
+			const unsigned int	sign = bits & 0x80000000u;
+
+			bits ^= sign;
+			if (bits >= 0x47800000u)
+				res = bits > 0x7F800000u ? 0x7E00u : 0x7C00u;
+			else if (bits < 0x38800000u)
+			{
+				// Subnormal: adding 0.5 rounds to a multiple of 2^-24
+				float	f;
+
+				__builtin_memcpy(&f, &bits, sizeof(f));
+				f += 0.5f;
+				__builtin_memcpy(&res, &f, sizeof(res));
+				res -= 0x3F000000u;
+			}
+			else
+				res = (bits + 0xC8000FFFu + ((bits >> 13) & 1u)) >> 13;
+			*ptr = static_cast<std::uint16_t>(res | (sign >> 16));
+		}
+
+		// 32 bits integers, toInt round to nearest even
+		static itype	loadInt(const std::uint32_t *ptr) { return (*ptr); }
+		static void		storeInt(std::uint32_t *ptr, itype value) { *ptr = value; }
+		static itype	toInt(type a) { return (static_cast<itype>(static_cast<std::int32_t>(__builtin_rintf(a)))); }
+		static type		toFloat(itype a) { return (static_cast<float>(static_cast<std::int32_t>(a))); }
+		static itype	andBits(itype a, std::uint32_t bits) { return (a & bits); }
+		static itype	orBits(itype a, itype b) { return (a | b); }
+		template <int N>
+		static itype	shiftLeft(itype a) { return (a << N); }
+		// Arithmetic shift, the sign is extended
+		template <int N>
+		static itype	shiftRight(itype a) { return (static_cast<itype>(static_cast<std::int32_t>(a) >> N)); }
+	};
+
+#if GM_KERNEL_LEVEL >= 3
+	struct	Wide
+	{
+		typedef __m512		type;
+		typedef __mmask16	mask;
+		typedef __m512i		itype;
+		static const std::size_t	size = 16;
+
+		static type	load(const float *ptr) { return (_mm512_loadu_ps(ptr)); }
+		static void	store(float *ptr, type value) { _mm512_storeu_ps(ptr, value); }
+		static type	set(float value) { return (_mm512_set1_ps(value)); }
+		static type	madd(type a, type b, type c) { return (_mm512_fmadd_ps(a, b, c)); }
+		static type	sqrt(type a) { return (_mm512_sqrt_ps(a)); }
+		// Hardware estimate and one Newton-Raphson step
+		static type	rsqrt(type a)
+		{
+			const type	res = _mm512_rsqrt14_ps(a);
+
+			return (res * (set(1.5f) - set(0.5f) * a * res * res));
+		}
+		static mask	greater(type a, type b) { return (_mm512_cmp_ps_mask(a, b, _CMP_GT_OQ)); }
+		static unsigned int	bits(mask m) { return (m); }
+		static type	select(mask m, type a, type b) { return (_mm512_mask_blend_ps(m, b, a)); }
+		static type	min(type a, type b) { return (_mm512_min_ps(a, b)); }
+		static type	max(type a, type b) { return (_mm512_max_ps(a, b)); }
+		static type	abs(type a) { return (_mm512_abs_ps(a)); }
+		static type	floor(type a) { return (_mm512_roundscale_ps(a, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC)); }
+		static type	ceil(type a) { return (_mm512_roundscale_ps(a, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC)); }
+		static type	trunc(type a) { return (_mm512_roundscale_ps(a, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC)); }
+		static type	exp2i(type n)
+		{
+			return (_mm512_castsi512_ps(_mm512_slli_epi32(_mm512_add_epi32(_mm512_cvtps_epi32(n),
+																			_mm512_set1_epi32(127)), 23)));
+		}
+		static type	frexp(type a, type &e)
+		{
+			const __m512i	bits = _mm512_castps_si512(a);
+
+			e = _mm512_cvtepi32_ps(_mm512_sub_epi32(_mm512_srli_epi32(bits, 23), _mm512_set1_epi32(126)));
+			return (_mm512_castsi512_ps(_mm512_or_si512(_mm512_and_si512(bits, _mm512_set1_epi32(0x807FFFFF)),
+														_mm512_set1_epi32(0x3F000000))));
+		}
+
+		// 128 bits lanes, read at ptr + lane * stride
+		static type	loadLanes(const float *ptr, std::size_t stride)
+		{
+			const __m256	low = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(ptr)),
+													_mm_loadu_ps(ptr + stride), 1);
+			const __m256	high = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(ptr + 2 * stride)),
+													_mm_loadu_ps(ptr + 3 * stride), 1);
+
+			return (_mm512_insertf32x8(_mm512_castps256_ps512(low), high, 1));
+		}
+		static void	storeLanes(float *ptr, std::size_t stride, type value)
+		{
+			_mm_storeu_ps(ptr, _mm512_extractf32x4_ps(value, 0));
+			_mm_storeu_ps(ptr + stride, _mm512_extractf32x4_ps(value, 1));
+			_mm_storeu_ps(ptr + 2 * stride, _mm512_extractf32x4_ps(value, 2));
+			_mm_storeu_ps(ptr + 3 * stride, _mm512_extractf32x4_ps(value, 3));
+		}
+		template <int IMM>
+		static type	shuffle(type a, type b) { return (_mm512_shuffle_ps(a, b, IMM)); }
+		static type	unpacklo(type a, type b) { return (_mm512_unpacklo_ps(a, b)); }
+		static type	unpackhi(type a, type b) { return (_mm512_unpackhi_ps(a, b)); }
+
+		static type	loadHalf(const std::uint16_t *ptr)
+		{
+			return (_mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr))));
+		}
+		static void	storeHalf(std::uint16_t *ptr, type value)
+		{
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(ptr), _mm512_cvtps_ph(value, _MM_FROUND_TO_NEAREST_INT));
+		}
+
+		static itype	loadInt(const std::uint32_t *ptr) { return (_mm512_loadu_si512(ptr)); }
+		static void		storeInt(std::uint32_t *ptr, itype value) { _mm512_storeu_si512(ptr, value); }
+		static itype	toInt(type a) { return (_mm512_cvtps_epi32(a)); }
+		static type		toFloat(itype a) { return (_mm512_cvtepi32_ps(a)); }
+		static itype	andBits(itype a, std::uint32_t bits)
+		{
+			return (_mm512_and_si512(a, _mm512_set1_epi32(static_cast<int>(bits))));
+		}
+		static itype	orBits(itype a, itype b) { return (_mm512_or_si512(a, b)); }
+		template <int N>
+		static itype	shiftLeft(itype a) { return (_mm512_slli_epi32(a, N)); }
+		template <int N>
+		static itype	shiftRight(itype a) { return (_mm512_srai_epi32(a, N)); }
+	};
+#elif GM_KERNEL_LEVEL >= 2
+	struct	Wide
+	{
+		typedef __m256	type;
+		typedef __m256	mask;
+		typedef __m256i	itype;
+		static const std::size_t	size = 8;
+
+		static type	load(const float *ptr) { return (_mm256_loadu_ps(ptr)); }
+		static void	store(float *ptr, type value) { _mm256_storeu_ps(ptr, value); }
+		static type	set(float value) { return (_mm256_set1_ps(value)); }
+		static type	madd(type a, type b, type c) { return (_mm256_fmadd_ps(a, b, c)); }
+		static type	sqrt(type a) { return (_mm256_sqrt_ps(a)); }
+		// Hardware estimate and one Newton-Raphson step
+		static type	rsqrt(type a)
+		{
+			const type	res = _mm256_rsqrt_ps(a);
+
+			return (res * (set(1.5f) - set(0.5f) * a * res * res));
+		}
+		static mask	greater(type a, type b) { return (_mm256_cmp_ps(a, b, _CMP_GT_OQ)); }
+		static unsigned int	bits(mask m) { return (static_cast<unsigned int>(_mm256_movemask_ps(m))); }
+		static type	select(mask m, type a, type b) { return (_mm256_blendv_ps(b, a, m)); }
+		static type	min(type a, type b) { return (_mm256_min_ps(a, b)); }
+		static type	max(type a, type b) { return (_mm256_max_ps(a, b)); }
+		static type	abs(type a) { return (_mm256_andnot_ps(_mm256_set1_ps(-0.0f), a)); }
+		static type	floor(type a) { return (_mm256_floor_ps(a)); }
+		static type	ceil(type a) { return (_mm256_ceil_ps(a)); }
+		static type	trunc(type a) { return (_mm256_round_ps(a, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC)); }
+		static type	exp2i(type n)
+		{
+			return (_mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(_mm256_cvtps_epi32(n),
+																			_mm256_set1_epi32(127)), 23)));
+		}
+		static type	frexp(type a, type &e)
+		{
+			const __m256i	bits = _mm256_castps_si256(a);
+
+			e = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(126)));
+			return (_mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0x807FFFFF)),
+														_mm256_set1_epi32(0x3F000000))));
+		}
+
+		// 128 bits lanes, read at ptr + lane * stride
+		static type	loadLanes(const float *ptr, std::size_t stride)
+		{
+			return (_mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(ptr)),
+										_mm_loadu_ps(ptr + stride), 1));
+		}
+		static void	storeLanes(float *ptr, std::size_t stride, type value)
+		{
+			_mm_storeu_ps(ptr, _mm256_castps256_ps128(value));
+			_mm_storeu_ps(ptr + stride, _mm256_extractf128_ps(value, 1));
+		}
+		template <int IMM>
+		static type	shuffle(type a, type b) { return (_mm256_shuffle_ps(a, b, IMM)); }
+		static type	unpacklo(type a, type b) { return (_mm256_unpacklo_ps(a, b)); }
+		static type	unpackhi(type a, type b) { return (_mm256_unpackhi_ps(a, b)); }
+
+		static type	loadHalf(const std::uint16_t *ptr)
+		{
+			return (_mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr))));
+		}
+		static void	storeHalf(std::uint16_t *ptr, type value)
+		{
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(ptr), _mm256_cvtps_ph(value, _MM_FROUND_TO_NEAREST_INT));
+		}
+
+		static itype	loadInt(const std::uint32_t *ptr) { return (_mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr))); }
+		static void		storeInt(std::uint32_t *ptr, itype value) { _mm256_storeu_si256(reinterpret_cast<__m256i *>(ptr), value); }
+		static itype	toInt(type a) { return (_mm256_cvtps_epi32(a)); }
+		static type		toFloat(itype a) { return (_mm256_cvtepi32_ps(a)); }
+		static itype	andBits(itype a, std::uint32_t bits)
+		{
+			return (_mm256_and_si256(a, _mm256_set1_epi32(static_cast<int>(bits))));
+		}
+		static itype	orBits(itype a, itype b) { return (_mm256_or_si256(a, b)); }
+		template <int N>
+		static itype	shiftLeft(itype a) { return (_mm256_slli_epi32(a, N)); }
+		template <int N>
+		static itype	shiftRight(itype a) { return (_mm256_srai_epi32(a, N)); }
+	};
+#elif GM_KERNEL_LEVEL >= 1
+	struct	Wide
+	{
+		typedef __m128	type;
+		typedef __m128	mask;
+		typedef __m128i	itype;
+		static const std::size_t	size = 4;
+
+		static type	load(const float *ptr) { return (_mm_loadu_ps(ptr)); }
+		static void	store(float *ptr, type value) { _mm_storeu_ps(ptr, value); }
+		static type	set(float value) { return (_mm_set1_ps(value)); }
+		static type	madd(type a, type b, type c) { return (_mm_add_ps(_mm_mul_ps(a, b), c)); }
+		static type	sqrt(type a) { return (_mm_sqrt_ps(a)); }
+		// Hardware estimate and one Newton-Raphson step
+		static type	rsqrt(type a)
+		{
+			const type	res = _mm_rsqrt_ps(a);
+
+			return (res * (set(1.5f) - set(0.5f) * a * res * res));
+		}
+		static mask	greater(type a, type b) { return (_mm_cmpgt_ps(a, b)); }
+		static unsigned int	bits(mask m) { return (static_cast<unsigned int>(_mm_movemask_ps(m))); }
+		static type	select(mask m, type a, type b) { return (_mm_blendv_ps(b, a, m)); }
+		static type	min(type a, type b) { return (_mm_min_ps(a, b)); }
+		static type	max(type a, type b) { return (_mm_max_ps(a, b)); }
+		static type	abs(type a) { return (_mm_andnot_ps(_mm_set1_ps(-0.0f), a)); }
+		static type	floor(type a) { return (_mm_floor_ps(a)); }
+		static type	ceil(type a) { return (_mm_ceil_ps(a)); }
+		static type	trunc(type a) { return (_mm_round_ps(a, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC)); }
+		static type	exp2i(type n)
+		{
+			return (_mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_cvtps_epi32(n), _mm_set1_epi32(127)), 23)));
+		}
+		static type	frexp(type a, type &e)
+		{
+			const __m128i	bits = _mm_castps_si128(a);
+
+			e = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(126)));
+			return (_mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x807FFFFF)),
+													_mm_set1_epi32(0x3F000000))));
+		}
+
+		// 128 bits lanes, read at ptr + lane * stride
+		static type	loadLanes(const float *ptr, std::size_t) { return (_mm_loadu_ps(ptr)); }
+		static void	storeLanes(float *ptr, std::size_t, type value) { _mm_storeu_ps(ptr, value); }
+		template <int IMM>
+		static type	shuffle(type a, type b) { return (_mm_shuffle_ps(a, b, IMM)); }
+		static type	unpacklo(type a, type b) { return (_mm_unpacklo_ps(a, b)); }
+		static type	unpackhi(type a, type b) { return (_mm_unpackhi_ps(a, b)); }
+
+		// No F16C at this level, the conversions of Scalar with selects
+		static type	loadHalf(const std::uint16_t *ptr)
+		{
+			const __m128i	h = _mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(ptr)));
+			const __m128i	bias = _mm_set1_epi32(0x38000000);
+			__m128i			bits = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x7FFF)), 13);
+			const __m128i	exponent = _mm_and_si128(bits, _mm_set1_epi32(0x0F800000));
+
+			bits = _mm_add_epi32(bits, bias);
+			bits = _mm_add_epi32(bits, _mm_and_si128(_mm_cmpeq_epi32(exponent, _mm_set1_epi32(0x0F800000)), bias));
+
+			const type	subnormal = _mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(bits, _mm_set1_epi32(0x00800000))),
+												_mm_set1_ps(6.103515625e-5f));
+			const type	res = _mm_blendv_ps(_mm_castsi128_ps(bits), subnormal,
+											_mm_castsi128_ps(_mm_cmpeq_epi32(exponent, _mm_setzero_si128())));
+
+			return (_mm_or_ps(res, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x8000)), 16))));
+		}
+		static void	storeHalf(std::uint16_t *ptr, type value)
+		{
+			const __m128i	sign = _mm_and_si128(_mm_castps_si128(value), _mm_set1_epi32(static_cast<int>(0x80000000u)));
+			const __m128i	bits = _mm_xor_si128(_mm_castps_si128(value), sign);
+			const __m128i	special = _mm_blendv_epi8(_mm_set1_epi32(0x7C00), _mm_set1_epi32(0x7E00),
+												_mm_cmpgt_epi32(bits, _mm_set1_epi32(0x7F800000)));
+			const __m128i	subnormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(bits), _mm_set1_ps(0.5f))),
+												_mm_set1_epi32(0x3F000000));
+			const __m128i	normal = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(bits,
+												_mm_set1_epi32(static_cast<int>(0xC8000FFFu))),
+												_mm_and_si128(_mm_srli_epi32(bits, 13), _mm_set1_epi32(1))), 13);
+			__m128i			res = _mm_blendv_epi8(normal, subnormal, _mm_cmplt_epi32(bits, _mm_set1_epi32(0x38800000)));
+
+			res = _mm_blendv_epi8(res, special, _mm_cmpgt_epi32(bits, _mm_set1_epi32(0x477FFFFF)));
+			res = _mm_or_si128(res, _mm_srli_epi32(sign, 16));
+			_mm_storel_epi64(reinterpret_cast<__m128i *>(ptr), _mm_packus_epi32(res, res));
+		}
+
+		static itype	loadInt(const std::uint32_t *ptr) { return (_mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr))); }
+		static void		storeInt(std::uint32_t *ptr, itype value) { _mm_storeu_si128(reinterpret_cast<__m128i *>(ptr), value); }
+		static itype	toInt(type a) { return (_mm_cvtps_epi32(a)); }
+		static type		toFloat(itype a) { return (_mm_cvtepi32_ps(a)); }
+		static itype	andBits(itype a, std::uint32_t bits) { return (_mm_and_si128(a, _mm_set1_epi32(static_cast<int>(bits)))); }
+		static itype	orBits(itype a, itype b) { return (_mm_or_si128(a, b)); }
+		template <int N>
+		static itype	shiftLeft(itype a) { return (_mm_slli_epi32(a, N)); }
+		template <int N>
+		static itype	shiftRight(itype a) { return (_mm_srai_epi32(a, N)); }
+	};
+#else
+	typedef Scalar	Wide;
+#endif
+
+	//**** INTERLEAVED VECTORS *************************************************
+	// Convert between packed Vec3/Vec4 arrays and one pack per component.
+	// Simd packs work on 128 bits lanes: each lane hold 4 vectors, so the
+	// same in lane shuffles work for every width.
+
+	template <class P>
+	void	loadXY(const float *ptr, typename P::type &x, typename P::type &y)
+	{
+		// Lanes: x0 y0 x1 y1 | x2 y2 x3 y3
+		const typename P::type	m01 = P::loadLanes(ptr, 8);
+		const typename P::type	m23 = P::loadLanes(ptr + 4, 8);
+
+		x = P::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(m01, m23);
+		y = P::template shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(m01, m23);
+	}
+
+	template <class P>
+	void	storeXY(float *ptr, typename P::type x, typename P::type y)
+	{
+		P::storeLanes(ptr, 8, P::unpacklo(x, y));
+		P::storeLanes(ptr + 4, 8, P::unpackhi(x, y));
+	}
+
+	template <class P>
+	void	loadXYZ(const float *ptr, typename P::type &x, typename P::type &y, typename P::type &z)
+	{
+		// Lanes: x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3
+		const typename P::type	m03 = P::loadLanes(ptr, 12);
+		const typename P::type	m14 = P::loadLanes(ptr + 4, 12);
+		const typename P::type	m25 = P::loadLanes(ptr + 8, 12);
+		const typename P::type	xy = P::template shuffle<_MM_SHUFFLE(2, 1, 3, 2)>(m14, m25);
+		const typename P::type	yz = P::template shuffle<_MM_SHUFFLE(1, 0, 2, 1)>(m03, m14);
+
+		x = P::template shuffle<_MM_SHUFFLE(2, 0, 3, 0)>(m03, xy);
+		y = P::template shuffle<_MM_SHUFFLE(3, 1, 2, 0)>(yz, xy);
+		z = P::template shuffle<_MM_SHUFFLE(3, 0, 3, 1)>(yz, m25);
+	}
+
+	template <class P>
+	void	storeXYZ(float *ptr, typename P::type x, typename P::type y, typename P::type z)
+	{
+		const typename P::type	xy = P::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(x, y);
+		const typename P::type	yz = P::template shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(y, z);
+		const typename P::type	zx = P::template shuffle<_MM_SHUFFLE(3, 1, 2, 0)>(z, x);
+
+		P::storeLanes(ptr, 12, P::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(xy, zx));
+		P::storeLanes(ptr + 4, 12, P::template shuffle<_MM_SHUFFLE(3, 1, 2, 0)>(yz, xy));
+		P::storeLanes(ptr + 8, 12, P::template shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(zx, yz));
+	}
+
+	template <class P>
+	void	transpose(typename P::type &r0, typename P::type &r1, typename P::type &r2, typename P::type &r3)
+	{
+		const typename P::type	t0 = P::unpacklo(r0, r1);
+		const typename P::type	t1 = P::unpackhi(r0, r1);
+		const typename P::type	t2 = P::unpacklo(r2, r3);
+		const typename P::type	t3 = P::unpackhi(r2, r3);
+
+		r0 = P::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(t0, t2);
+		r1 = P::template shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(t0, t2);
+		r2 = P::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(t1, t3);
+		r3 = P::template shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(t1, t3);
+	}
+
+	template <class P>
+	void	loadXYZW(const float *ptr, typename P::type &x, typename P::type &y, typename P::type &z, typename P::type &w)
+	{
+		x = P::loadLanes(ptr, 16);
+		y = P::loadLanes(ptr + 4, 16);
+		z = P::loadLanes(ptr + 8, 16);
+		w = P::loadLanes(ptr + 12, 16);
+		transpose<P>(x, y, z, w);
+	}
+
+	template <class P>
+	void	storeXYZW(float *ptr, typename P::type x, typename P::type y, typename P::type z, typename P::type w)
+	{
+		transpose<P>(x, y, z, w);
+		P::storeLanes(ptr, 16, x);
+		P::storeLanes(ptr + 4, 16, y);
+		P::storeLanes(ptr + 8, 16, z);
+		P::storeLanes(ptr + 12, 16, w);
+	}
+
+	template <>
+	void	loadXY<Scalar>(const float *ptr, float &x, float &y)
+	{
+		x = ptr[0];
+		y = ptr[1];
+	}
+
+	template <>
+	void	storeXY<Scalar>(float *ptr, float x, float y)
+	{
+		ptr[0] = x;
+		ptr[1] = y;
+	}
+
+	template <>
+	void	loadXYZ<Scalar>(const float *ptr, float &x, float &y, float &z)
+	{
+		x = ptr[0];
+		y = ptr[1];
+		z = ptr[2];
+	}
+
+	template <>
+	void	storeXYZ<Scalar>(float *ptr, float x, float y, float z)
+	{
+		ptr[0] = x;
+		ptr[1] = y;
+		ptr[2] = z;
+	}
+
+	template <>
+	void	loadXYZW<Scalar>(const float *ptr, float &x, float &y, float &z, float &w)
+	{
+		x = ptr[0];
+		y = ptr[1];
+		z = ptr[2];
+		w = ptr[3];
+	}
+
+	template <>
+	void	storeXYZW<Scalar>(float *ptr, float x, float y, float z, float w)
+	{
+		ptr[0] = x;
+		ptr[1] = y;
+		ptr[2] = z;
+		ptr[3] = w;
+	}
+
+	// Packed vectors of DIM components, in the DIM first values of v
+	template <class P, unsigned int DIM>
+	void	loadPacked(const float *ptr, typename P::type v[4])
+	{
+		if (DIM == 2)
+			loadXY<P>(ptr, v[0], v[1]);
+		else if (DIM == 3)
+			loadXYZ<P>(ptr, v[0], v[1], v[2]);
+		else
+			loadXYZW<P>(ptr, v[0], v[1], v[2], v[3]);
+	}
+
+	template <class P, unsigned int DIM>
+	void	storePacked(float *ptr, const typename P::type v[4])
+	{
+		if (DIM == 2)
+			storeXY<P>(ptr, v[0], v[1]);
+		else if (DIM == 3)
+			storeXYZ<P>(ptr, v[0], v[1], v[2]);
+		else
+			storeXYZW<P>(ptr, v[0], v[1], v[2], v[3]);
+	}
+
+	//**** LOOPS ***************************************************************
+	// Each loop process values from i while a full pack fit, and return the
+	// index of the first value not processed.
+
+	template <class P>
+	std::size_t	addLoop(std::size_t i, const float *a, const float *b, float *res, std::size_t count)
+	{
+		for (; i + P::size <= count; i += P::size)
+			P::store(res + i, P::load(a + i) + P::load(b + i));
+		return (i);
+	}
+
+	template <class P>
+	std::size_t	subLoop(std::size_t i, const float *a, const float *b, float *res, std::size_t count)
+	{
+		for (; i + P::size <= count; i += P::size)
+			P::store(res + i, P::load(a + i) - P::load(b + i));
+		return (i);
+	}
+
+	template <class P>
+	std::size_t	mulLoop(std::size_t i, const float *a, const float *b, float *res, std::size_t count)
+	{
+		for (; i + P::size <= count; i += P::size)
+			P::store(res + i, P::load(a + i) * P::load(b + i));
+		return (i);
+	}
+
+	template <class P>
+	std::size_t	scaleLoop(std::size_t i, const float *a, float value, float *res, std::size_t count)
+	{
+		const typename P::type	packValue = P::set(value);
+
+		for (; i + P::size <= count; i += P::size)
+			P::store(res + i, P::load(a + i) * packValue);
+		return (i);
+	}
+
+	template <class P, typename P::type (*F)(typename P::type)>
+	std::size_t	mapLoop(std::size_t i, const float *a, float *res, std::size_t count)
+	{
+		for (; i + P::size <= count; i += P::size)
+			P::store(res + i, F(P::load(a + i)));
+		return (i);
+	}
+
+	template <class P>
+	std::size_t	maddLoop(std::size_t i, const float *a, float value, const float *b, float *res, std::size_t count)
+	{
+		const typename P::type	packValue = P::set(value);
+
+		for (; i + P::size <= count; i += P::size)
+			P::store(res + i, P::madd(P::load(a + i), packValue, P::load(b + i)));
+		return (i);
+	}
+
+	//---- Vectors in structure of arrays ----------------------------------------
+	// Vectors of DIM components, one array per component.
+
+	template <class P, unsigned int DIM>
+	typename P::type	dotPack(const float *const a[], const float *const b[], std::size_t i)
+	{
+		typename P::type	res = P::load(a[0] + i) * P::load(b[0] + i);
+
+		for (unsigned int c = 1; c < DIM; c++)
+			res = P::madd(P::load(a[c] + i), P::load(b[c] + i), res);
+		return (res);
+	}
+
+	template <class P, unsigned int DIM>
+	std::size_t	dotLoop(std::size_t i, const float *const a[], const float *const b[], float *res, std::size_t count)
+	{
+		for (; i + P::size <= count; i += P::size)
+			P::store(res + i, dotPack<P, DIM>(a, b, i));
+		return (i);
+	}
+
+	template <class P, unsigned int DIM>
+	std::size_t	normLoop(std::size_t i, const float *const a[], float *res, std::size_t count)
+	{
+		for (; i + P::size <= count; i += P::size)
+			P::store(res + i, P::sqrt(dotPack<P, DIM>(a, a, i)));
+		return (i);
+	}
+
+	template <class P, unsigned int DIM>
+	std::size_t	normalizeLoop(std::size_t i, const float *const a[], float *const res[], std::size_t count)
+	{
+		const typename P::type	zero = P::set(0.0f);
+		const typename P::type	one = P::set(1.0f);
+
+		for (; i + P::size <= count; i += P::size)
+		{
+			const typename P::type	dst = dotPack<P, DIM>(a, a, i);
+			// Null vectors are kept as is
+			const typename P::type	toDiv = P::select(P::greater(dst, zero), one / P::sqrt(dst), one);
+
+			for (unsigned int c = 0; c < DIM; c++)
+				P::store(res[c] + i, P::load(a[c] + i) * toDiv);
+		}
+		return (i);
+	}
+
+	template <class P>
+	std::size_t	crossLoop(std::size_t i, const float *const a[], const float *const b[], float *const res[], std::size_t count)
+	{
+		for (; i + P::size <= count; i += P::size)
+		{
+			const typename P::type	ax = P::load(a[0] + i);
+			const typename P::type	ay = P::load(a[1] + i);
+			const typename P::type	az = P::load(a[2] + i);
+			const typename P::type	bx = P::load(b[0] + i);
+			const typename P::type	by = P::load(b[1] + i);
+			const typename P::type	bz = P::load(b[2] + i);
+
+			P::store(res[0] + i, ay * bz - az * by);
+			P::store(res[1] + i, az * bx - ax * bz);
+			P::store(res[2] + i, ax * by - ay * bx);
+		}
+		return (i);
+	}
+
+	//---- Matrix transforms ---------------------------------------------------
+	// mat is a row major 4x4 matrix, its values stay in registers.
+
+	template <class P>
+	std::size_t	transformPointsLoop(std::size_t i, const float *mat, const float *src, float *dst, std::size_t count)
+	{
+		typename P::type	m[12];
+
+		for (int j = 0; j < 12; j++)
+			m[j] = P::set(mat[j]);
+
+		for (; i + P::size <= count; i += P::size)
+		{
+			typename P::type	x, y, z;
+
+			loadXYZ<P>(src + 3 * i, x, y, z);
+			storeXYZ<P>(dst + 3 * i,
+						P::madd(m[0], x, P::madd(m[1], y, P::madd(m[2], z, m[3]))),
+						P::madd(m[4], x, P::madd(m[5], y, P::madd(m[6], z, m[7]))),
+						P::madd(m[8], x, P::madd(m[9], y, P::madd(m[10], z, m[11]))));
+		}
+		return (i);
+	}
+
+	template <class P>
+	std::size_t	transformVectorsLoop(std::size_t i, const float *mat, const float *src, float *dst, std::size_t count)
+	{
+		typename P::type	m[12];
+
+		for (int j = 0; j < 12; j++)
+			m[j] = P::set(mat[j]);
+
+		for (; i + P::size <= count; i += P::size)
+		{
+			typename P::type	x, y, z;
+
+			loadXYZ<P>(src + 3 * i, x, y, z);
+			storeXYZ<P>(dst + 3 * i,
+						P::madd(m[0], x, P::madd(m[1], y, m[2] * z)),
+						P::madd(m[4], x, P::madd(m[5], y, m[6] * z)),
+						P::madd(m[8], x, P::madd(m[9], y, m[10] * z)));
+		}
+		return (i);
+	}
+
+	template <class P>
+	std::size_t	transformHomogeneousLoop(std::size_t i, const float *mat, const float *src, float *dst, std::size_t count)
+	{
+		typename P::type	m[16];
+
+		for (int j = 0; j < 16; j++)
+			m[j] = P::set(mat[j]);
+
+		for (; i + P::size <= count; i += P::size)
+		{
+			typename P::type	x, y, z, w;
+
+			loadXYZW<P>(src + 4 * i, x, y, z, w);
+			storeXYZW<P>(dst + 4 * i,
+						P::madd(m[0], x, P::madd(m[1], y, P::madd(m[2], z, m[3] * w))),
+						P::madd(m[4], x, P::madd(m[5], y, P::madd(m[6], z, m[7] * w))),
+						P::madd(m[8], x, P::madd(m[9], y, P::madd(m[10], z, m[11] * w))),
+						P::madd(m[12], x, P::madd(m[13], y, P::madd(m[14], z, m[15] * w))));
+		}
+		return (i);
+	}
+
+	//---- Component-wise ----------------------------------------------------------
+	// Same results as the functions of utils.hpp, round is half away from 0.
+
+	template <class P>
+	std::size_t	minLoop(std::size_t i, const float *a, const float *b, float *res, std::size_t count)
+	{
+		for (; i + P::size <= count; i += P::size)
+			P::store(res + i, P::min(P::load(a + i), P::load(b + i)));
+		return (i);
+	}
+
+	template <class P>
+	std::size_t	maxLoop(std::size_t i, const float *a, const float *b, float *res, std::size_t count)
+	{
+		for (; i + P::size <= count; i += P::size)
+			P::store(res + i, P::max(P::load(a + i), P::load(b + i)));
+		return (i);
+	}
+
+	template <class P>
+	std::size_t	clampLoop(std::size_t i, const float *a, float low, float high, float *res, std::size_t count)
+	{
+		const typename P::type	packLow = P::set(low);
+		const typename P::type	packHigh = P::set(high);
+
+		for (; i + P::size <= count; i += P::size)
+			P::store(res + i, P::min(P::max(P::load(a + i), packLow), packHigh));
+		return (i);
+	}
+
+	template <class P>
+	std::size_t	stepLoop(std::size_t i, float edge, const float *a, float *res, std::size_t count)
+	{
+		const typename P::type	packEdge = P::set(edge);
+		const typename P::type	zero = P::set(0.0f);
+		const typename P::type	one = P::set(1.0f);
+
+		for (; i + P::size <= count; i += P::size)
+			P::store(res + i, P::select(P::greater(packEdge, P::load(a + i)), zero, one));
+		return (i);
+	}
+
+	template <class P>
+	std::size_t	smoothstepLoop(std::size_t i, float edge0, float edge1, const float *a, float *res, std::size_t count)
+	{
+		const typename P::type	packEdge = P::set(edge0);
+		const typename P::type	invRange = P::set(1.0f / (edge1 - edge0));
+		const typename P::type	zero = P::set(0.0f);
+		const typename P::type	one = P::set(1.0f);
+
+		for (; i + P::size <= count; i += P::size)
+		{
+			const typename P::type	t = P::min(P::max((P::load(a + i) - packEdge) * invRange, zero), one);
+
+			P::store(res + i, t * t * (P::set(3.0f) - P::set(2.0f) * t));
+		}
+		return (i);
+	}
+
+	template <class P>
+	typename P::type	absPack(typename P::type a)
+	{
+		return (P::abs(a));
+	}
+
+	template <class P>
+	typename P::type	signPack(typename P::type a)
+	{
+		const typename P::type	zero = P::set(0.0f);
+
+		return (P::select(P::greater(a, zero), P::set(1.0f), P::select(P::greater(zero, a), P::set(-1.0f), zero)));
+	}
+
+	template <class P>
+	typename P::type	floorPack(typename P::type a)
+	{
+		return (P::floor(a));
+	}
+
+	template <class P>
+	typename P::type	ceilPack(typename P::type a)
+	{
+		return (P::ceil(a));
+	}
+
+	template <class P>
+	typename P::type	roundPack(typename P::type a)
+	{
+		// Largest float below 0.5, so 0.49999997 is not rounded to 1
+		const typename P::type	half = P::set(0.49999997f);
+
+		return (P::trunc(a + P::select(P::greater(P::set(0.0f), a), P::set(0.0f) - half, half)));
+	}
+
+	template <class P>
+	typename P::type	fractPack(typename P::type a)
+	{
+		return (a - P::floor(a));
+	}
+
+	//---- Half floats ------------------------------------------------------------
+
+	template <class P>
+	std::size_t	toHalfLoop(std::size_t i, const float *src, std::uint16_t *dst, std::size_t count)
+	{
+		for (; i + P::size <= count; i += P::size)
+			P::storeHalf(dst + i, P::load(src + i));
+		return (i);
+	}
+
+	template <class P>
+	std::size_t	toFloatLoop(std::size_t i, const std::uint16_t *src, float *dst, std::size_t count)
+	{
+		for (; i + P::size <= count; i += P::size)
+			P::store(dst + i, P::loadHalf(src + i));
+		return (i);
+	}
+
+	//---- Packed vectors ----------------------------------------------------------
+	// Arrays of Vec2, Vec3 or Vec4, DIM values per vector.
+
+	template <class P, unsigned int DIM>
+	std::size_t	normalizeFastLoop(std::size_t i, const float *src, float *dst, std::size_t count)
+	{
+		for (; i + P::size <= count; i += P::size)
+		{
+			typename P::type	v[4];
+
+			loadPacked<P, DIM>(src + DIM * i, v);
+
+			typename P::type	dot = v[0] * v[0];
+
+			for (unsigned int c = 1; c < DIM; c++)
+				dot = P::madd(v[c], v[c], dot);
+
+			const typename P::type	toDiv = P::rsqrt(dot);
+
+			for (unsigned int c = 0; c < DIM; c++)
+				v[c] = v[c] * toDiv;
+			storePacked<P, DIM>(dst + DIM * i, v);
+		}
+		return (i);
+	}
+
+	template <class P, unsigned int DIM>
+	std::size_t	normalizeSafeLoop(std::size_t i, const float *src, float epsilon, float *dst, std::size_t count)
+	{
+		const typename P::type	zero = P::set(0.0f);
+		const typename P::type	one = P::set(1.0f);
+		const typename P::type	minDst = P::set(epsilon * epsilon);
+
+		for (; i + P::size <= count; i += P::size)
+		{
+			typename P::type	v[4];
+
+			loadPacked<P, DIM>(src + DIM * i, v);
+
+			typename P::type	dot = v[0] * v[0];
+
+			for (unsigned int c = 1; c < DIM; c++)
+				dot = P::madd(v[c], v[c], dot);
+
+			// Vectors too small become null
+			const typename P::mask	valid = P::greater(dot, minDst);
+			const typename P::type	toDiv = P::select(valid, one / P::sqrt(P::select(valid, dot, one)), zero);
+
+			for (unsigned int c = 0; c < DIM; c++)
+				v[c] = v[c] * toDiv;
+			storePacked<P, DIM>(dst + DIM * i, v);
+		}
+		return (i);
+	}
+
+	//---- Normal encodings --------------------------------------------------------
+	// Packed Vec3 to 32 bits, same results as normals.hpp.
+
+	// a clamped to [-1, 1] and rounded to an integer in [-scale, scale]
+	template <class P>
+	typename P::itype	snormPack(typename P::type a, float scale)
+	{
+		return (P::toInt(P::min(P::max(a, P::set(-1.0f)), P::set(1.0f)) * P::set(scale)));
+	}
+
+	// Signed integer of BITS bits at bit OFFSET, back to [-1, 1]
+	template <class P, int BITS, int OFFSET>
+	typename P::type	unsnormPack(typename P::itype bits)
+	{
+		const typename P::itype	value = P::template shiftRight<32 - BITS>(P::template shiftLeft<32 - BITS - OFFSET>(bits));
+
+		return (P::max(P::toFloat(value) / P::set(static_cast<float>((1 << (BITS - 1)) - 1)), P::set(-1.0f)));
+	}
+
+	template <class P>
+	typename P::itype	octahedralEncodePack(typename P::type x, typename P::type y, typename P::type z)
+	{
+		const typename P::type	zero = P::set(0.0f);
+		const typename P::type	one = P::set(1.0f);
+		const typename P::type	inv = one / (P::abs(x) + P::abs(y) + P::abs(z));
+		typename P::type		u = x * inv;
+		typename P::type		v = y * inv;
+		// Lower hemisphere folded on the corners of the square
+		const typename P::mask	lower = P::greater(zero, z);
+		const typename P::type	foldU = (one - P::abs(v)) * P::select(P::greater(zero, u), P::set(-1.0f), one);
+		const typename P::type	foldV = (one - P::abs(u)) * P::select(P::greater(zero, v), P::set(-1.0f), one);
+
+		u = P::select(lower, foldU, u);
+		v = P::select(lower, foldV, v);
+		return (P::orBits(P::andBits(snormPack<P>(u, 32767.0f), 0xFFFFu),
+						P::template shiftLeft<16>(snormPack<P>(v, 32767.0f))));
+	}
+
+	template <class P>
+	void	octahedralDecodePack(typename P::itype bits, typename P::type &x, typename P::type &y, typename P::type &z)
+	{
+		const typename P::type	zero = P::set(0.0f);
+		const typename P::type	u = unsnormPack<P, 16, 0>(bits);
+		const typename P::type	v = unsnormPack<P, 16, 16>(bits);
+		const typename P::type	w = P::set(1.0f) - P::abs(u) - P::abs(v);
+		const typename P::type	t = P::max(zero - w, zero);
+		const typename P::type	ox = u + P::select(P::greater(zero, u), t, zero - t);
+		const typename P::type	oy = v + P::select(P::greater(zero, v), t, zero - t);
+		const typename P::type	norm = P::sqrt(ox * ox + oy * oy + w * w);
+
+		x = ox / norm;
+		y = oy / norm;
+		z = w / norm;
+	}
+
+	template <class P>
+	typename P::itype	encode1010102Pack(typename P::type x, typename P::type y, typename P::type z)
+	{
+		return (P::orBits(P::andBits(snormPack<P>(x, 511.0f), 0x3FFu),
+						P::orBits(P::template shiftLeft<10>(P::andBits(snormPack<P>(y, 511.0f), 0x3FFu)),
+								P::template shiftLeft<20>(P::andBits(snormPack<P>(z, 511.0f), 0x3FFu)))));
+	}
+
+	template <class P>
+	void	decode1010102Pack(typename P::itype bits, typename P::type &x, typename P::type &y, typename P::type &z)
+	{
+		x = unsnormPack<P, 10, 0>(bits);
+		y = unsnormPack<P, 10, 10>(bits);
+		z = unsnormPack<P, 10, 20>(bits);
+	}
+
+	template <class P>
+	typename P::itype	encodeSnorm16x2Pack(typename P::type x, typename P::type y, typename P::type)
+	{
+		return (P::orBits(P::andBits(snormPack<P>(x, 32767.0f), 0xFFFFu),
+						P::template shiftLeft<16>(snormPack<P>(y, 32767.0f))));
+	}
+
+	template <class P>
+	void	decodeSnorm16x2Pack(typename P::itype bits, typename P::type &x, typename P::type &y, typename P::type &z)
+	{
+		x = unsnormPack<P, 16, 0>(bits);
+		y = unsnormPack<P, 16, 16>(bits);
+		z = P::sqrt(P::max(P::set(1.0f) - x * x - y * y, P::set(0.0f)));
+	}
+
+	template <class P, typename P::itype (*ENCODE)(typename P::type, typename P::type, typename P::type)>
+	std::size_t	encodeLoop(std::size_t i, const float *src, std::uint32_t *dst, std::size_t count)
+	{
+		for (; i + P::size <= count; i += P::size)
+		{
+			typename P::type	x, y, z;
+
+			loadXYZ<P>(src + 3 * i, x, y, z);
+			P::storeInt(dst + i, ENCODE(x, y, z));
+		}
+		return (i);
+	}
+
+	template <class P, void (*DECODE)(typename P::itype, typename P::type &, typename P::type &, typename P::type &)>
+	std::size_t	decodeLoop(std::size_t i, const std::uint32_t *src, float *dst, std::size_t count)
+	{
+		for (; i + P::size <= count; i += P::size)
+		{
+			typename P::type	x, y, z;
+
+			DECODE(P::loadInt(src + i), x, y, z);
+			storeXYZ<P>(dst + 3 * i, x, y, z);
+		}
+		return (i);
+	}
+
+	//---- Fast math -------------------------------------------------------------
+	// Approximations of fastPoly.hpp, see gm::fast for the error bounds.
+
+	template <class P>
+	typename P::type	sinPack(typename P::type x)
+	{
+		typename P::type	s, c;
+
+		__fastSinCos<P>(x, s, c);
+		return (s);
+	}
+
+	template <class P>
+	typename P::type	cosPack(typename P::type x)
+	{
+		typename P::type	s, c;
+
+		__fastSinCos<P>(x, s, c);
+		return (c);
+	}
+
+	template <class P>
+	typename P::type	tanPack(typename P::type x)
+	{
+		typename P::type	s, c;
+
+		__fastSinCos<P>(x, s, c);
+		return (s / c);
+	}
+
+	template <class P>
+	std::size_t	fastSinCosLoop(std::size_t i, const float *a, float *s, float *c, std::size_t count)
+	{
+		for (; i + P::size <= count; i += P::size)
+		{
+			typename P::type	sinV, cosV;
+
+			__fastSinCos<P>(P::load(a + i), sinV, cosV);
+			P::store(s + i, sinV);
+			P::store(c + i, cosV);
+		}
+		return (i);
+	}
+
+	template <class P>
+	std::size_t	fastAtan2Loop(std::size_t i, const float *y, const float *x, float *res, std::size_t count)
+	{
+		for (; i + P::size <= count; i += P::size)
+			P::store(res + i, __fastAtan2<P>(P::load(y + i), P::load(x + i)));
+		return (i);
+	}
+
+	//---- Frustum culling --------------------------------------------------------
+	// planes holds 6 planes x y z w with normals toward the inside, an object
+	// is culled when it's fully on the negative side of one plane. Results are
+	// bits of 32 bits words, P::size divides 32 so a pack never straddles two
+	// words and the first pack of a word clears it.
+
+	template <class P>
+	void	storeVisible(std::uint32_t *mask, std::size_t i, typename P::type minDistance)
+	{
+		const unsigned int	culled = P::bits(P::greater(P::set(0.0f), minDistance));
+		const std::uint32_t	visible = static_cast<std::uint32_t>(~culled & ((1u << P::size) - 1u)) << (i % 32);
+
+		if (i % 32 == 0)
+			mask[i / 32] = visible;
+		else
+			mask[i / 32] |= visible;
+	}
+
+	template <class P>
+	typename P::type	planeDistance(const float *plane, typename P::type x, typename P::type y, typename P::type z)
+	{
+		return (P::madd(P::set(plane[0]), x, P::madd(P::set(plane[1]), y, P::madd(P::set(plane[2]), z, P::set(plane[3])))));
+	}
+
+	template <class P>
+	std::size_t	cullSpheresLoop(std::size_t i, const float *planes, const float *const center[], const float *radius,
+					std::uint32_t *mask, std::size_t count)
+	{
+		for (; i + P::size <= count; i += P::size)
+		{
+			const typename P::type	x = P::load(center[0] + i);
+			const typename P::type	y = P::load(center[1] + i);
+			const typename P::type	z = P::load(center[2] + i);
+			typename P::type		distance = planeDistance<P>(planes, x, y, z);
+
+			for (unsigned int p = 1; p < 6; p++)
+				distance = P::min(distance, planeDistance<P>(planes + 4 * p, x, y, z));
+			storeVisible<P>(mask, i, distance + P::load(radius + i));
+		}
+		return (i);
+	}
+
+	template <class P>
+	std::size_t	cullAABBsLoop(std::size_t i, const float *planes, const float *const corner[6][3],
+					std::uint32_t *mask, std::size_t count)
+	{
+		for (; i + P::size <= count; i += P::size)
+		{
+			typename P::type	distance = planeDistance<P>(planes, P::load(corner[0][0] + i),
+												P::load(corner[0][1] + i), P::load(corner[0][2] + i));
+
+			for (unsigned int p = 1; p < 6; p++)
+				distance = P::min(distance, planeDistance<P>(planes + 4 * p, P::load(corner[p][0] + i),
+												P::load(corner[p][1] + i), P::load(corner[p][2] + i)));
+			storeVisible<P>(mask, i, distance);
+		}
+		return (i);
+	}
+
+	//**** KERNELS *************************************************************
+
+	void	add(const float *a, const float *b, float *res, std::size_t count)
+	{
+		addLoop<Scalar>(addLoop<Wide>(0, a, b, res, count), a, b, res, count);
+	}
+
+	void	sub(const float *a, const float *b, float *res, std::size_t count)
+	{
+		subLoop<Scalar>(subLoop<Wide>(0, a, b, res, count), a, b, res, count);
+	}
+
+	void	mul(const float *a, const float *b, float *res, std::size_t count)
+	{
+		mulLoop<Scalar>(mulLoop<Wide>(0, a, b, res, count), a, b, res, count);
+	}
+
+	void	scale(const float *a, float value, float *res, std::size_t count)
+	{
+		scaleLoop<Scalar>(scaleLoop<Wide>(0, a, value, res, count), a, value, res, count);
+	}
+
+	void	madd(const float *a, float value, const float *b, float *res, std::size_t count)
+	{
+		maddLoop<Scalar>(maddLoop<Wide>(0, a, value, b, res, count), a, value, b, res, count);
+	}
+
+	template <unsigned int DIM>
+	void	dotDim(const float *const a[], const float *const b[], float *res, std::size_t count)
+	{
+		dotLoop<Scalar, DIM>(dotLoop<Wide, DIM>(0, a, b, res, count), a, b, res, count);
+	}
+
+	void	dot(const float *const a[], const float *const b[], unsigned int dim, float *res, std::size_t count)
+	{
+		if (dim == 2)
+			dotDim<2>(a, b, res, count);
+		else if (dim == 3)
+			dotDim<3>(a, b, res, count);
+		else if (dim == 4)
+			dotDim<4>(a, b, res, count);
+	}
+
+	template <unsigned int DIM>
+	void	normDim(const float *const a[], float *res, std::size_t count)
+	{
+		normLoop<Scalar, DIM>(normLoop<Wide, DIM>(0, a, res, count), a, res, count);
+	}
+
+	void	norm(const float *const a[], unsigned int dim, float *res, std::size_t count)
+	{
+		if (dim == 2)
+			normDim<2>(a, res, count);
+		else if (dim == 3)
+			normDim<3>(a, res, count);
+		else if (dim == 4)
+			normDim<4>(a, res, count);
+	}
+
+	template <unsigned int DIM>
+	void	normalizeDim(const float *const a[], float *const res[], std::size_t count)
+	{
+		normalizeLoop<Scalar, DIM>(normalizeLoop<Wide, DIM>(0, a, res, count), a, res, count);
+	}
+
+	void	normalize(const float *const a[], unsigned int dim, float *const res[], std::size_t count)
+	{
+		if (dim == 2)
+			normalizeDim<2>(a, res, count);
+		else if (dim == 3)
+			normalizeDim<3>(a, res, count);
+		else if (dim == 4)
+			normalizeDim<4>(a, res, count);
+	}
+
+	void	cross(const float *const a[], const float *const b[], float *const res[], std::size_t count)
+	{
+		crossLoop<Scalar>(crossLoop<Wide>(0, a, b, res, count), a, b, res, count);
+	}
+
+	void	transformPoints(const float *mat, const float *src, float *dst, std::size_t count)
+	{
+		transformPointsLoop<Scalar>(transformPointsLoop<Wide>(0, mat, src, dst, count), mat, src, dst, count);
+	}
+
+	void	transformVectors(const float *mat, const float *src, float *dst, std::size_t count)
+	{
+		transformVectorsLoop<Scalar>(transformVectorsLoop<Wide>(0, mat, src, dst, count), mat, src, dst, count);
+	}
+
+	void	transformHomogeneous(const float *mat, const float *src, float *dst, std::size_t count)
+	{
+		transformHomogeneousLoop<Scalar>(transformHomogeneousLoop<Wide>(0, mat, src, dst, count), mat, src, dst, count);
+	}
+
+	void	min(const float *a, const float *b, float *res, std::size_t count)
+	{
+		minLoop<Scalar>(minLoop<Wide>(0, a, b, res, count), a, b, res, count);
+	}
+
+	void	max(const float *a, const float *b, float *res, std::size_t count)
+	{
+		maxLoop<Scalar>(maxLoop<Wide>(0, a, b, res, count), a, b, res, count);
+	}
+
+	void	clamp(const float *a, float low, float high, float *res, std::size_t count)
+	{
+		clampLoop<Scalar>(clampLoop<Wide>(0, a, low, high, res, count), a, low, high, res, count);
+	}
+
+	void	step(float edge, const float *a, float *res, std::size_t count)
+	{
+		stepLoop<Scalar>(stepLoop<Wide>(0, edge, a, res, count), edge, a, res, count);
+	}
+
+	void	smoothstep(float edge0, float edge1, const float *a, float *res, std::size_t count)
+	{
+		smoothstepLoop<Scalar>(smoothstepLoop<Wide>(0, edge0, edge1, a, res, count), edge0, edge1, a, res, count);
+	}
+
+	void	toHalf(const float *src, std::uint16_t *dst, std::size_t count)
+	{
+		toHalfLoop<Scalar>(toHalfLoop<Wide>(0, src, dst, count), src, dst, count);
+	}
+
+	void	toFloat(const std::uint16_t *src, float *dst, std::size_t count)
+	{
+		toFloatLoop<Scalar>(toFloatLoop<Wide>(0, src, dst, count), src, dst, count);
+	}
+
+	template <Scalar::itype (*SCALAR)(Scalar::type, Scalar::type, Scalar::type),
+				Wide::itype (*WIDE)(Wide::type, Wide::type, Wide::type)>
+	void	encodeKernel(const float *src, std::uint32_t *dst, std::size_t count)
+	{
+		encodeLoop<Scalar, SCALAR>(encodeLoop<Wide, WIDE>(0, src, dst, count), src, dst, count);
+	}
+
+	template <void (*SCALAR)(Scalar::itype, Scalar::type &, Scalar::type &, Scalar::type &),
+				void (*WIDE)(Wide::itype, Wide::type &, Wide::type &, Wide::type &)>
+	void	decodeKernel(const std::uint32_t *src, float *dst, std::size_t count)
+	{
+		decodeLoop<Scalar, SCALAR>(decodeLoop<Wide, WIDE>(0, src, dst, count), src, dst, count);
+	}
+
+	void	encodeOctahedral(const float *src, std::uint32_t *dst, std::size_t count)
+	{
+		encodeKernel<octahedralEncodePack<Scalar>, octahedralEncodePack<Wide> >(src, dst, count);
+	}
+
+	void	decodeOctahedral(const std::uint32_t *src, float *dst, std::size_t count)
+	{
+		decodeKernel<octahedralDecodePack<Scalar>, octahedralDecodePack<Wide> >(src, dst, count);
+	}
+
+	void	encode1010102(const float *src, std::uint32_t *dst, std::size_t count)
+	{
+		encodeKernel<encode1010102Pack<Scalar>, encode1010102Pack<Wide> >(src, dst, count);
+	}
+
+	void	decode1010102(const std::uint32_t *src, float *dst, std::size_t count)
+	{
+		decodeKernel<decode1010102Pack<Scalar>, decode1010102Pack<Wide> >(src, dst, count);
+	}
+
+	void	encodeSnorm16x2(const float *src, std::uint32_t *dst, std::size_t count)
+	{
+		encodeKernel<encodeSnorm16x2Pack<Scalar>, encodeSnorm16x2Pack<Wide> >(src, dst, count);
+	}
+
+	void	decodeSnorm16x2(const std::uint32_t *src, float *dst, std::size_t count)
+	{
+		decodeKernel<decodeSnorm16x2Pack<Scalar>, decodeSnorm16x2Pack<Wide> >(src, dst, count);
+	}
+
+	template <unsigned int DIM>
+	void	normalizeFastDim(const float *src, float *dst, std::size_t count)
+	{
+		normalizeFastLoop<Scalar, DIM>(normalizeFastLoop<Wide, DIM>(0, src, dst, count), src, dst, count);
+	}
+
+	void	normalizeFast(const float *src, unsigned int dim, float *dst, std::size_t count)
+	{
+		if (dim == 2)
+			normalizeFastDim<2>(src, dst, count);
+		else if (dim == 3)
+			normalizeFastDim<3>(src, dst, count);
+		else if (dim == 4)
+			normalizeFastDim<4>(src, dst, count);
+	}
+
+	template <unsigned int DIM>
+	void	normalizeSafeDim(const float *src, float epsilon, float *dst, std::size_t count)
+	{
+		normalizeSafeLoop<Scalar, DIM>(normalizeSafeLoop<Wide, DIM>(0, src, epsilon, dst, count), src, epsilon, dst, count);
+	}
+
+	void	normalizeSafe(const float *src, unsigned int dim, float epsilon, float *dst, std::size_t count)
+	{
+		if (dim == 2)
+			normalizeSafeDim<2>(src, epsilon, dst, count);
+		else if (dim == 3)
+			normalizeSafeDim<3>(src, epsilon, dst, count);
+		else if (dim == 4)
+			normalizeSafeDim<4>(src, epsilon, dst, count);
+	}
+
+	template <typename Scalar::type (*SCALAR)(Scalar::type), typename Wide::type (*WIDE)(Wide::type)>
+	void	mapKernel(const float *a, float *res, std::size_t count)
+	{
+		mapLoop<Scalar, SCALAR>(mapLoop<Wide, WIDE>(0, a, res, count), a, res, count);
+	}
+
+	void	abs(const float *a, float *res, std::size_t count)
+	{
+		mapKernel<absPack<Scalar>, absPack<Wide> >(a, res, count);
+	}
+
+	void	sign(const float *a, float *res, std::size_t count)
+	{
+		mapKernel<signPack<Scalar>, signPack<Wide> >(a, res, count);
+	}
+
+	void	floor(const float *a, float *res, std::size_t count)
+	{
+		mapKernel<floorPack<Scalar>, floorPack<Wide> >(a, res, count);
+	}
+
+	void	ceil(const float *a, float *res, std::size_t count)
+	{
+		mapKernel<ceilPack<Scalar>, ceilPack<Wide> >(a, res, count);
+	}
+
+	void	round(const float *a, float *res, std::size_t count)
+	{
+		mapKernel<roundPack<Scalar>, roundPack<Wide> >(a, res, count);
+	}
+
+	void	fract(const float *a, float *res, std::size_t count)
+	{
+		mapKernel<fractPack<Scalar>, fractPack<Wide> >(a, res, count);
+	}
+
+	void	fastSin(const float *a, float *res, std::size_t count)
+	{
+		mapKernel<sinPack<Scalar>, sinPack<Wide> >(a, res, count);
+	}
+
+	void	fastCos(const float *a, float *res, std::size_t count)
+	{
+		mapKernel<cosPack<Scalar>, cosPack<Wide> >(a, res, count);
+	}
+
+	void	fastTan(const float *a, float *res, std::size_t count)
+	{
+		mapKernel<tanPack<Scalar>, tanPack<Wide> >(a, res, count);
+	}
+
+	void	fastAcos(const float *a, float *res, std::size_t count)
+	{
+		mapKernel<__fastAcos<Scalar>, __fastAcos<Wide> >(a, res, count);
+	}
+
+	void	fastExp(const float *a, float *res, std::size_t count)
+	{
+		mapKernel<__fastExp<Scalar>, __fastExp<Wide> >(a, res, count);
+	}
+
+	void	fastLog(const float *a, float *res, std::size_t count)
+	{
+		mapKernel<__fastLog<Scalar>, __fastLog<Wide> >(a, res, count);
+	}
+
+	void	fastSinCos(const float *a, float *s, float *c, std::size_t count)
+	{
+		fastSinCosLoop<Scalar>(fastSinCosLoop<Wide>(0, a, s, c, count), a, s, c, count);
+	}
+
+	void	fastAtan2(const float *y, const float *x, float *res, std::size_t count)
+	{
+		fastAtan2Loop<Scalar>(fastAtan2Loop<Wide>(0, y, x, res, count), y, x, res, count);
+	}
+
+	void	cullSpheres(const float *planes, const float *const center[], const float *radius,
+				std::uint32_t *mask, std::size_t count)
+	{
+		cullSpheresLoop<Scalar>(cullSpheresLoop<Wide>(0, planes, center, radius, mask, count),
+								planes, center, radius, mask, count);
+	}
+
+	void	cullAABBs(const float *planes, const float *const min[], const float *const max[],
+				std::uint32_t *mask, std::size_t count)
+	{
+		// Corner of the box the farthest along each plane normal
+		const float	*corner[6][3];
+
+		for (unsigned int p = 0; p < 6; p++)
+			for (unsigned int c = 0; c < 3; c++)
+				corner[p][c] = planes[4 * p + c] > 0.0f ? max[c] : min[c];
+		cullAABBsLoop<Scalar>(cullAABBsLoop<Wide>(0, planes, corner, mask, count), planes, corner, mask, count);
+	}
+}
+
+	//**** TABLE ***************************************************************
+
+	const KernelTable	&kernelTable(void)
+	{
+		static const KernelTable	table = {
+			static_cast<SimdLevel>(GM_KERNEL_LEVEL),
+			add,
+			sub,
+			mul,
+			scale,
+			madd,
+			dot,
+			norm,
+			normalize,
+			cross,
+			transformPoints,
+			transformVectors,
+			transformHomogeneous,
+			min,
+			max,
+			clamp,
+			abs,
+			sign,
+			floor,
+			ceil,
+			round,
+			fract,
+			step,
+			smoothstep,
+			toHalf,
+			toFloat,
+			encodeOctahedral,
+			decodeOctahedral,
+			encode1010102,
+			decode1010102,
+			encodeSnorm16x2,
+			decodeSnorm16x2,
+			normalizeFast,
+			normalizeSafe,
+			fastSin,
+			fastCos,
+			fastTan,
+			fastAcos,
+			fastExp,
+			fastLog,
+			fastSinCos,
+			fastAtan2,
+			cullSpheres,
+			cullAABBs,
+		};
+
+		return (table);
+	}
+}
+}
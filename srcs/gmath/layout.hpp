@@ -0,0 +1,56 @@
+#ifndef GM_LAYOUT_HPP
+# define GM_LAYOUT_HPP
+
+//**** MATRIX LAYOUT ***********************************************************
+// Storage order of Mat2, Mat3 and Mat4 in values[], chosen at compile time.
+// Elements are always read and written as (x, y), x the column and y the row:
+// only the index in values[] changes. ColumnMajor is the order of GLSL and
+// HLSL column_major. values[] of a Mat4 can be copied to a uniform buffer as
+// is, Mat2 and Mat3 columns are padded by BlockLayout.
+
+namespace gm {
+	//**** TYPES ***************************************************************
+
+	/**
+	 * @brief Row-major storage, rows are contiguous. Default of the matrices.
+	 */
+	struct RowMajor
+	{
+		/**
+		 * @brief Index of an element in values[].
+		 *
+		 * @param x Column of the element.
+		 * @param y Row of the element.
+		 * @param size Number of rows and columns.
+		 *
+		 * @return The index.
+		 */
+		static constexpr unsigned int	index(unsigned int x, unsigned int y, unsigned int size)
+		{
+			return (x + y * size);
+		}
+	};
+
+	/**
+	 * @brief Column-major storage, columns are contiguous. Layout of OpenGL,
+	 * Vulkan and the default of the shading languages.
+	 */
+	struct ColumnMajor
+	{
+		/**
+		 * @brief Index of an element in values[].
+		 *
+		 * @param x Column of the element.
+		 * @param y Row of the element.
+		 * @param size Number of rows and columns.
+		 *
+		 * @return The index.
+		 */
+		static constexpr unsigned int	index(unsigned int x, unsigned int y, unsigned int size)
+		{
+			return (y + x * size);
+		}
+	};
+}
+
+#endif
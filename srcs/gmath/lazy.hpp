@@ -0,0 +1,479 @@
+#ifndef GM_LAZY_HPP
+# define GM_LAZY_HPP
+
+# include <gmath/config.hpp>
+# include <gmath/Vec2.hpp>
+# include <gmath/Vec3.hpp>
+# include <gmath/Vec4.hpp>
+# include <gmath/SoABuffer.hpp>
+# include <gmath/Vec2SoA.hpp>
+# include <gmath/Vec3SoA.hpp>
+# include <gmath/Vec4SoA.hpp>
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+// Expression templates for vector arithmetic. gm::lazy(v) wraps a vector or a
+// SoA container, operators on it build an expression tree instead of
+// temporaries, and gm::eval / gm::assign compute the whole expression in one
+// pass:
+//
+//     gm::assign(pos, gm::lazy(pos) + gm::lazy(vel) * dt + gm::lazy(acc) * (0.5f * dt * dt));
+//
+// Expressions keep references to their operands, evaluate them in the same
+// statement (don't store them with auto).
+
+namespace gm {
+	//**** STATIC FUNCTIONS DEFINE *********************************************
+
+	struct __LazyAdd
+	{
+		template <typename T>
+		static constexpr T	apply(const T &a, const T &b) { return (a + b); }
+	};
+
+	struct __LazySub
+	{
+		template <typename T>
+		static constexpr T	apply(const T &a, const T &b) { return (a - b); }
+	};
+
+	struct __LazyMul
+	{
+		template <typename T>
+		static constexpr T	apply(const T &a, const T &b) { return (a * b); }
+	};
+
+	struct __LazyDiv
+	{
+		template <typename T>
+		static constexpr T	apply(const T &a, const T &b) { return (a / b); }
+	};
+
+	template <typename T, unsigned int N>
+	struct __LazyResult;
+
+	template <typename T>
+	struct __LazyResult<T, 2> { using type = Vec2<T>; };
+
+	template <typename T>
+	struct __LazyResult<T, 3> { using type = Vec3<T>; };
+
+	template <typename T>
+	struct __LazyResult<T, 4> { using type = Vec4<T>; };
+
+	//**** CLASS DEFINE ********************************************************
+
+	/**
+	 * @brief Base class of every expression, E is the expression type.
+	 *
+	 * An expression has a value_type, a dim (number of components), a size
+	 * (number of vectors, 0 for a single vector used for all vectors) and
+	 * get(i, c) which compute the component c of the vector i.
+	 */
+	template <typename E>
+	class LazyExpr
+	{
+	public:
+		/**
+		 * @brief Get the expression.
+		 *
+		 * @return Reference to the real expression type.
+		 */
+		constexpr const E	&self(void) const
+		{
+			return (static_cast<const E &>(*this));
+		}
+	};
+
+	/**
+	 * @brief Expression leaf on one vector, used for every vectors of the
+	 * expression.
+	 *
+	 * @tparam T Type of value in the vector.
+	 * @tparam N Number of components.
+	 */
+	template <typename T, unsigned int N>
+	class LazyVec : public LazyExpr<LazyVec<T, N>>
+	{
+	public:
+		using value_type = T;
+		static const unsigned int	dim = N;
+
+		/**
+		 * @brief Constructor of LazyVec class.
+		 *
+		 * @param vec The vector, must outlive the expression.
+		 *
+		 * @return The LazyVec on vec.
+		 */
+		constexpr LazyVec(const typename __LazyResult<T, N>::type &vec) : vec(vec) {}
+
+		constexpr std::size_t	size(void) const
+		{
+			return (0);
+		}
+
+		constexpr T	get(std::size_t, unsigned int c) const
+		{
+			return (this->vec[c]);
+		}
+
+	private:
+		const typename __LazyResult<T, N>::type	&vec;
+	};
+
+	/**
+	 * @brief Expression leaf on the vectors of a SoA container.
+	 *
+	 * @tparam T Type of value in the vectors.
+	 * @tparam N Number of components.
+	 */
+	template <typename T, unsigned int N>
+	class LazySoA : public LazyExpr<LazySoA<T, N>>
+	{
+	public:
+		using value_type = T;
+		static const unsigned int	dim = N;
+
+		/**
+		 * @brief Constructor of LazySoA class.
+		 *
+		 * @param soa The SoA container, must outlive the expression.
+		 *
+		 * @return The LazySoA on soa vectors.
+		 */
+		LazySoA(const SoABuffer<T, N> &soa) : count(soa.size())
+		{
+			__soaComponents(soa, this->components);
+		}
+
+		std::size_t	size(void) const
+		{
+			return (this->count);
+		}
+
+		T	get(std::size_t i, unsigned int c) const
+		{
+			return (this->components[c][i]);
+		}
+
+	private:
+		const T		*components[N];
+		std::size_t	count;
+	};
+
+	/**
+	 * @brief Expression of a component by component operation between two
+	 * expressions.
+	 *
+	 * @tparam L Left expression.
+	 * @tparam R Right expression.
+	 * @tparam Op Operation, with a static apply(a, b).
+	 */
+	template <typename L, typename R, typename Op>
+	class LazyBinary : public LazyExpr<LazyBinary<L, R, Op>>
+	{
+		static_assert(std::is_same<typename L::value_type, typename R::value_type>::value,
+						"Lazy operands must have the same value type");
+		static_assert(L::dim == R::dim, "Lazy operands must have the same dimension");
+	public:
+		using value_type = typename L::value_type;
+		static const unsigned int	dim = L::dim;
+
+		/**
+		 * @brief Constructor of LazyBinary class.
+		 *
+		 * @param left Left expression.
+		 * @param right Right expression.
+		 *
+		 * @exception Throw an exception if the expressions have different sizes.
+		 * @return The LazyBinary of left op right.
+		 */
+		LazyBinary(const L &left, const R &right) : left(left), right(right)
+		{
+			if (left.size() != 0 && right.size() != 0 && left.size() != right.size())
+				GM_THROW(std::runtime_error("Soa vectors have different sizes"));
+		}
+
+		std::size_t	size(void) const
+		{
+			return (this->left.size() != 0 ? this->left.size() : this->right.size());
+		}
+
+		value_type	get(std::size_t i, unsigned int c) const
+		{
+			return (Op::apply(this->left.get(i, c), this->right.get(i, c)));
+		}
+
+	private:
+		L	left;
+		R	right;
+	};
+
+	/**
+	 * @brief Expression of an operation between an expression and a value.
+	 *
+	 * @tparam E The expression.
+	 * @tparam Op Operation, with a static apply(a, b).
+	 */
+	template <typename E, typename Op>
+	class LazyScalar : public LazyExpr<LazyScalar<E, Op>>
+	{
+	public:
+		using value_type = typename E::value_type;
+		static const unsigned int	dim = E::dim;
+
+		/**
+		 * @brief Constructor of LazyScalar class.
+		 *
+		 * @param expr The expression.
+		 * @param value The value.
+		 *
+		 * @return The LazyScalar of expr op value.
+		 */
+		constexpr LazyScalar(const E &expr, value_type value) : expr(expr), value(value) {}
+
+		std::size_t	size(void) const
+		{
+			return (this->expr.size());
+		}
+
+		value_type	get(std::size_t i, unsigned int c) const
+		{
+			return (Op::apply(this->expr.get(i, c), this->value));
+		}
+
+	private:
+		E			expr;
+		value_type	value;
+	};
+
+	/**
+	 * @brief Expression of the opposite of an expression.
+	 *
+	 * @tparam E The expression.
+	 */
+	template <typename E>
+	class LazyNegate : public LazyExpr<LazyNegate<E>>
+	{
+	public:
+		using value_type = typename E::value_type;
+		static const unsigned int	dim = E::dim;
+
+		constexpr LazyNegate(const E &expr) : expr(expr) {}
+
+		std::size_t	size(void) const
+		{
+			return (this->expr.size());
+		}
+
+		value_type	get(std::size_t i, unsigned int c) const
+		{
+			return (-this->expr.get(i, c));
+		}
+
+	private:
+		E	expr;
+	};
+
+	//---- Operand traits ------------------------------------------------------
+
+	// Tell if X can be an operand of an expression, and the leaf type to use.
+	template <typename X, typename = void>
+	struct __LazyOperand
+	{
+		static const bool	value = false;
+		static const bool	expr = false;
+	};
+
+	template <typename X>
+	struct __LazyOperand<X, typename std::enable_if<std::is_base_of<LazyExpr<X>, X>::value>::type>
+	{
+		static const bool	value = true;
+		static const bool	expr = true;
+		using type = X;
+	};
+
+	template <typename T>
+	struct __LazyOperand<Vec2<T>>
+	{
+		static const bool	value = true;
+		static const bool	expr = false;
+		using type = LazyVec<T, 2>;
+	};
+
+	template <typename T>
+	struct __LazyOperand<Vec3<T>>
+	{
+		static const bool	value = true;
+		static const bool	expr = false;
+		using type = LazyVec<T, 3>;
+	};
+
+	template <typename T>
+	struct __LazyOperand<Vec4<T>>
+	{
+		static const bool	value = true;
+		static const bool	expr = false;
+		using type = LazyVec<T, 4>;
+	};
+
+	template <typename T, unsigned int N>
+	struct __LazyOperand<SoABuffer<T, N>>
+	{
+		static const bool	value = true;
+		static const bool	expr = false;
+		using type = LazySoA<T, N>;
+	};
+
+	template <typename T>
+	struct __LazyOperand<Vec2SoA<T>> : __LazyOperand<SoABuffer<T, 2>> {};
+
+	template <typename T>
+	struct __LazyOperand<Vec3SoA<T>> : __LazyOperand<SoABuffer<T, 3>> {};
+
+	template <typename T>
+	struct __LazyOperand<Vec4SoA<T>> : __LazyOperand<SoABuffer<T, 4>> {};
+
+	// Enable the operators when both are operands and one is an expression.
+	template <typename L, typename R>
+	using __LazyEnable = typename std::enable_if<__LazyOperand<L>::value && __LazyOperand<R>::value
+												&& (__LazyOperand<L>::expr || __LazyOperand<R>::expr)>::type;
+
+	template <typename E>
+	using __LazyEnableExpr = typename std::enable_if<__LazyOperand<E>::expr>::type;
+
+	//**** EXTERNS OPERATORS ***************************************************
+	//---- Expression expression operator --------------------------------------
+
+	template <typename L, typename R, typename = __LazyEnable<L, R>>
+	LazyBinary<typename __LazyOperand<L>::type, typename __LazyOperand<R>::type, __LazyAdd>
+		operator+(const L &left, const R &right)
+	{
+		return (LazyBinary<typename __LazyOperand<L>::type, typename __LazyOperand<R>::type, __LazyAdd>(
+					typename __LazyOperand<L>::type(left), typename __LazyOperand<R>::type(right)));
+	}
+
+	template <typename L, typename R, typename = __LazyEnable<L, R>>
+	LazyBinary<typename __LazyOperand<L>::type, typename __LazyOperand<R>::type, __LazySub>
+		operator-(const L &left, const R &right)
+	{
+		return (LazyBinary<typename __LazyOperand<L>::type, typename __LazyOperand<R>::type, __LazySub>(
+					typename __LazyOperand<L>::type(left), typename __LazyOperand<R>::type(right)));
+	}
+
+	//---- Expression value operator -------------------------------------------
+
+	template <typename E, typename = __LazyEnableExpr<E>>
+	LazyScalar<E, __LazyMul>	operator*(const E &expr, typename E::value_type value)
+	{
+		return (LazyScalar<E, __LazyMul>(expr, value));
+	}
+
+	template <typename E, typename = __LazyEnableExpr<E>>
+	LazyScalar<E, __LazyMul>	operator*(typename E::value_type value, const E &expr)
+	{
+		return (LazyScalar<E, __LazyMul>(expr, value));
+	}
+
+	template <typename E, typename = __LazyEnableExpr<E>>
+	LazyScalar<E, __LazyDiv>	operator/(const E &expr, typename E::value_type value)
+	{
+		return (LazyScalar<E, __LazyDiv>(expr, value));
+	}
+
+	//---- Unary operator ------------------------------------------------------
+
+	template <typename E, typename = __LazyEnableExpr<E>>
+	LazyNegate<E>	operator-(const E &expr)
+	{
+		return (LazyNegate<E>(expr));
+	}
+
+	//**** FUNCTIONS ***********************************************************
+
+	/**
+	 * @brief Start an expression on a vector or a SoA container.
+	 *
+	 * @param operand Vec2, Vec3, Vec4 or SoA container, must outlive the
+	 * expression.
+	 *
+	 * @return The expression leaf on operand.
+	 */
+	template <typename X>
+	typename __LazyOperand<X>::type	lazy(const X &operand)
+	{
+		return (typename __LazyOperand<X>::type(operand));
+	}
+
+	/**
+	 * @brief Compute an expression of single vectors.
+	 *
+	 * @param expr The expression.
+	 *
+	 * @return The Vec2, Vec3 or Vec4 result of the expression.
+	 */
+	template <typename E>
+	typename __LazyResult<typename E::value_type, E::dim>::type	eval(const LazyExpr<E> &expr)
+	{
+		typename __LazyResult<typename E::value_type, E::dim>::type	res;
+
+		for (unsigned int c = 0; c < E::dim; c++)
+			res[c] = expr.self().get(0, c);
+		return (res);
+	}
+
+	/**
+	 * @brief Compute an expression of SoA containers in one pass.
+	 *
+	 * @param res Result vectors, resized to the expression size. Can be one of
+	 * the operands.
+	 * @param expr The expression.
+	 */
+	template <typename T, unsigned int N, typename E>
+	void	assign(SoABuffer<T, N> &res, const LazyExpr<E> &expr)
+	{
+		static_assert(std::is_same<T, typename E::value_type>::value, "Lazy result must have the same value type");
+		static_assert(N == E::dim, "Lazy result must have the same dimension");
+
+		const E				&e = expr.self();
+		const std::size_t	size = e.size() != 0 ? e.size() : res.size();
+
+		res.resize(size);
+		for (unsigned int c = 0; c < N; c++)
+		{
+			T	*dst = res.component(c);
+
+			for (std::size_t i = 0; i < size; i++)
+				dst[i] = e.get(i, c);
+		}
+	}
+
+	/**
+	 * @brief Compute an expression of single vectors.
+	 *
+	 * @param res The result vector.
+	 * @param expr The expression.
+	 */
+	template <typename T, typename E>
+	void	assign(Vec2<T> &res, const LazyExpr<E> &expr)
+	{
+		res = eval(expr);
+	}
+
+	template <typename T, typename E>
+	void	assign(Vec3<T> &res, const LazyExpr<E> &expr)
+	{
+		res = eval(expr);
+	}
+
+	template <typename T, typename E>
+	void	assign(Vec4<T> &res, const LazyExpr<E> &expr)
+	{
+		res = eval(expr);
+	}
+}
+
+#endif
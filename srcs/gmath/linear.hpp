@@ -1,6 +1,8 @@
 #ifndef GM_LINEAR
 # define GM_LINEAR
 
+# include <gmath/fma.hpp>
+
 namespace gm {
 	// Functions
 	/**
@@ -10,12 +12,13 @@ namespace gm {
 	 * @param end End of the linear interpolation.
 	 * @param range Factor of the linear interpolation. Must be between 0 and 1 for coherent result.
 	 *
-	 * @return Result of the linear interpolation.
+	 * @return Result of the linear interpolation, fused multiply-add when
+	 * GM_USE_FMA is defined.
 	 */
 	template <typename T>
 	T	lerp(const T &start, const T &end, float range)
 	{
-		return (start + (end - start) * range);
+		return (__madd(end - start, range, start));
 	}
 
 	/**
@@ -25,12 +28,13 @@ namespace gm {
 	 * @param end End of the linear interpolation.
 	 * @param range Factor of the linear interpolation. Must be between 0 and 1 for coherent result.
 	 *
-	 * @return Result of the linear interpolation.
+	 * @return Result of the linear interpolation, fused multiply-add when
+	 * GM_USE_FMA is defined.
 	 */
 	template <typename T>
 	T	lerp(const T &start, const T &end, double range)
 	{
-		return (start + (end - start) * range);
+		return (__madd(end - start, range, start));
 	}
 }
 
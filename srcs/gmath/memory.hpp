@@ -0,0 +1,180 @@
+#ifndef GM_MEMORY_HPP
+# define GM_MEMORY_HPP
+
+// Alignment of buffers used by batch kernels, enough for an avx512 register
+// and a cache line.
+# define GM_SIMD_ALIGNMENT 64
+
+# include <gmath/config.hpp>
+
+# include <cstddef>
+# include <cstdint>
+# include <cstdlib>
+# include <new>
+# include <stdexcept>
+# include <vector>
+
+namespace gm {
+	//**** FUNCTIONS ***********************************************************
+
+	/**
+	 * @brief Allocate memory aligned on a power of two.
+	 *
+	 * @param size Size in bytes to allocate.
+	 * @param alignment Wanted alignment, a power of two.
+	 *
+	 * @return Pointer to the memory, to free with alignedFree.
+	 *
+	 * @exception Throw std::bad_alloc when allocation fails.
+	 */
+	inline void	*alignedAlloc(std::size_t size, std::size_t alignment = GM_SIMD_ALIGNMENT)
+	{
+		if (alignment < sizeof(void *))
+			alignment = sizeof(void *);
+
+		// Original pointer is stored just before the aligned block
+		void	*raw = std::malloc(size + alignment + sizeof(void *));
+		if (raw == nullptr)
+			GM_THROW(std::bad_alloc());
+
+		const std::uintptr_t	start = reinterpret_cast<std::uintptr_t>(raw) + sizeof(void *);
+		void	*aligned = reinterpret_cast<void *>((start + alignment - 1) & ~(alignment - 1));
+
+		static_cast<void **>(aligned)[-1] = raw;
+		return (aligned);
+	}
+
+	/**
+	 * @brief Free memory allocated with alignedAlloc.
+	 *
+	 * @param ptr Pointer returned by alignedAlloc, can be nullptr.
+	 */
+	inline void	alignedFree(void *ptr)
+	{
+		if (ptr != nullptr)
+			std::free(static_cast<void **>(ptr)[-1]);
+	}
+
+	//**** CLASS DEFINE ********************************************************
+
+	/**
+	 * @brief Allocator of memory aligned on A bytes, for standard containers.
+	 *
+	 * @tparam T Type of value allocated.
+	 * @tparam A Alignment, a power of two not below the alignment of T.
+	 *
+	 * With the default alignment, every array starts on a cache line and
+	 * the batch kernels never split a load on two lines for 16 bytes types.
+	 */
+	template <typename T, std::size_t A = GM_SIMD_ALIGNMENT>
+	class AlignedAllocator
+	{
+		static_assert(A != 0 && (A & (A - 1)) == 0, "AlignedAllocator alignment must be a power of two");
+		static_assert(A >= alignof(T), "AlignedAllocator alignment must not be below the alignment of T");
+	public:
+		typedef T	value_type;
+
+		template <typename U>
+		struct rebind
+		{
+			typedef AlignedAllocator<U, A>	other;
+		};
+
+		//**** INITIALISION ****************************************************
+		//---- Constructors ----------------------------------------------------
+
+		/**
+		 * @brief Default constructor of AlignedAllocator class.
+		 *
+		 * @return The AlignedAllocator.
+		 */
+		constexpr AlignedAllocator(void) noexcept {}
+
+		/**
+		 * @brief Constructor of AlignedAllocator class from an allocator of
+		 * another type.
+		 *
+		 * @return The AlignedAllocator.
+		 */
+		template <typename U>
+		constexpr AlignedAllocator(const AlignedAllocator<U, A> &) noexcept {}
+
+		//**** PUBLIC METHODS **************************************************
+
+		/**
+		 * @brief Allocate memory for values, not constructed.
+		 *
+		 * @param count Number of values.
+		 *
+		 * @return Pointer aligned on A bytes.
+		 *
+		 * @exception Throw std::bad_alloc when allocation fails.
+		 */
+		T	*allocate(std::size_t count)
+		{
+			if (count > static_cast<std::size_t>(-1) / sizeof(T))
+				GM_THROW(std::bad_alloc());
+			return (static_cast<T *>(alignedAlloc(count * sizeof(T), A)));
+		}
+
+		/**
+		 * @brief Free memory of allocate.
+		 *
+		 * @param ptr Pointer returned by allocate.
+		 */
+		void	deallocate(T *ptr, std::size_t) noexcept
+		{
+			alignedFree(ptr);
+		}
+	};
+
+	//**** EXTERNS OPERATORS ***************************************************
+
+	template <typename T, typename U, std::size_t A>
+	constexpr bool	operator==(const AlignedAllocator<T, A> &, const AlignedAllocator<U, A> &) noexcept
+	{
+		return (true);
+	}
+
+	template <typename T, typename U, std::size_t A>
+	constexpr bool	operator!=(const AlignedAllocator<T, A> &, const AlignedAllocator<U, A> &) noexcept
+	{
+		return (false);
+	}
+
+	//**** USINGS **************************************************************
+
+	/**
+	 * @brief Vector with its data aligned on A bytes, to give to the batch
+	 * functions.
+	 */
+	template <typename T, std::size_t A = GM_SIMD_ALIGNMENT>
+	using Buffer = std::vector<T, AlignedAllocator<T, A> >;
+
+	//**** STATIC FUNCTIONS ****************************************************
+
+	/**
+	 * @brief Internal function for memory. Reject at compile time a Buffer
+	 * given to a batch function with less than one SSE register of
+	 * alignment.
+	 */
+	template <std::size_t A>
+	inline void	__checkBatchBuffer(void)
+	{
+		static_assert(A >= 16, "Buffers given to batch functions must be aligned on 16 bytes at least");
+	}
+
+	/**
+	 * @brief Internal function for memory. Check that two buffers given to a
+	 * batch function have the same size.
+	 *
+	 * @exception Throw an exception if sizes are different.
+	 */
+	inline void	__checkBatchSize(std::size_t a, std::size_t b)
+	{
+		if (a != b)
+			GM_THROW(std::runtime_error("Batch buffers have different sizes"));
+	}
+}
+
+#endif
@@ -0,0 +1,254 @@
+#ifndef GM_NORMALS_HPP
+# define GM_NORMALS_HPP
+
+# include <gmath/config.hpp>
+# include <gmath/utils.hpp>
+# include <gmath/Vec3.hpp>
+# include <gmath/dispatch.hpp>
+
+# include <cmath>
+# include <cstddef>
+# include <cstdint>
+
+//**** NORMAL ENCODINGS ********************************************************
+// Unit Vec3<float> stored in 32 bits instead of 12 bytes:
+//   octahedral   the sphere unfolded on a square, 2 x snorm16, every
+//                direction with the same precision
+//   1010102      x y z in snorm10, w bits at 0, the 10-10-10-2 snorm vertex
+//                format of OpenGL and Vulkan
+//   snorm16x2    x y in snorm16, z rebuilt positive, for normals of one
+//                hemisphere (tangent space, view space)
+// Values are rounded to nearest even. The batch versions give the same bits
+// at every simd level, the decodings as long as the caller doesn't contract
+// the scalar versions into fma (-ffp-contract=off with -mfma).
+
+namespace gm {
+	//**** STATIC FUNCTIONS DEFINE *********************************************
+
+	/**
+	 * @brief Internal function for normals. Clamp a value to [-1, 1] and round
+	 * it to an integer in [-scale, scale].
+	 *
+	 * @param value The value.
+	 * @param scale Largest integer.
+	 *
+	 * @return The integer, two's complement on 32 bits.
+	 */
+	inline std::uint32_t	__snorm(float value, float scale)
+	{
+		return (static_cast<std::uint32_t>(static_cast<std::int32_t>(std::rint(min(max(value, -1.0f), 1.0f) * scale))));
+	}
+
+	/**
+	 * @brief Internal function for normals. Read a signed integer in bits and
+	 * convert it back to [-1, 1].
+	 *
+	 * @param bits The packed bits.
+	 * @param size Number of bits of the integer.
+	 * @param offset Index of the first bit of the integer.
+	 *
+	 * @return The value in [-1, 1].
+	 */
+	inline float	__unsnorm(std::uint32_t bits, int size, int offset)
+	{
+		const std::int32_t	value = static_cast<std::int32_t>(bits << (32 - size - offset)) >> (32 - size);
+
+		return (max(static_cast<float>(value) / static_cast<float>((1 << (size - 1)) - 1), -1.0f));
+	}
+
+	//**** FUNCTIONS ***********************************************************
+	//---- Octahedral ----------------------------------------------------------
+
+	/**
+	 * @brief Encode a unit vector in the octahedral form.
+	 *
+	 * Angular error below 0.004 degrees after decoding.
+	 *
+	 * @param normal The vector, not null.
+	 *
+	 * @return u in the 16 low bits and v in the 16 high bits, snorm16.
+	 */
+	inline std::uint32_t	encodeOctahedral(const Vec3<float> &normal)
+	{
+		const float	inv = 1.0f / (std::abs(normal.x) + std::abs(normal.y) + std::abs(normal.z));
+		float		u = normal.x * inv;
+		float		v = normal.y * inv;
+
+		// Lower hemisphere folded on the corners of the square
+		if (normal.z < 0.0f)
+		{
+			const float	foldU = (1.0f - std::abs(v)) * (u < 0.0f ? -1.0f : 1.0f);
+
+			v = (1.0f - std::abs(u)) * (v < 0.0f ? -1.0f : 1.0f);
+			u = foldU;
+		}
+		return ((__snorm(u, 32767.0f) & 0xFFFFu) | (__snorm(v, 32767.0f) << 16));
+	}
+
+	/**
+	 * @brief Decode a vector of the octahedral form.
+	 *
+	 * @param bits The encoded vector.
+	 *
+	 * @return The unit vector.
+	 */
+	inline Vec3<float>	decodeOctahedral(std::uint32_t bits)
+	{
+		const float	u = __unsnorm(bits, 16, 0);
+		const float	v = __unsnorm(bits, 16, 16);
+		const float	w = 1.0f - std::abs(u) - std::abs(v);
+		const float	t = max(-w, 0.0f);
+		const float	x = u + (u < 0.0f ? t : -t);
+		const float	y = v + (v < 0.0f ? t : -t);
+		const float	norm = std::sqrt(x * x + y * y + w * w);
+
+		return (Vec3<float>(x / norm, y / norm, w / norm));
+	}
+
+	//---- 10-10-10-2 ----------------------------------------------------------
+
+	/**
+	 * @brief Encode a vector in the 10-10-10-2 snorm form.
+	 *
+	 * Vectors are kept within 2e-3.
+	 *
+	 * @param normal The vector, components clamped to [-1, 1].
+	 *
+	 * @return x in bits 0 to 9, y in 10 to 19, z in 20 to 29, w bits at 0.
+	 */
+	inline std::uint32_t	encode1010102(const Vec3<float> &normal)
+	{
+		return ((__snorm(normal.x, 511.0f) & 0x3FFu) | ((__snorm(normal.y, 511.0f) & 0x3FFu) << 10)
+				| ((__snorm(normal.z, 511.0f) & 0x3FFu) << 20));
+	}
+
+	/**
+	 * @brief Decode a vector of the 10-10-10-2 snorm form, like the gpu does.
+	 *
+	 * @param bits The encoded vector, w bits are ignored.
+	 *
+	 * @return The vector, not normalized again.
+	 */
+	inline Vec3<float>	decode1010102(std::uint32_t bits)
+	{
+		return (Vec3<float>(__unsnorm(bits, 10, 0), __unsnorm(bits, 10, 10), __unsnorm(bits, 10, 20)));
+	}
+
+	//---- snorm16x2 -----------------------------------------------------------
+
+	/**
+	 * @brief Encode x and y of a unit vector in snorm16.
+	 *
+	 * z is dropped, decoding gives back a positive z. Vectors are kept within
+	 * 7e-3, the error grows when z is near 0.
+	 *
+	 * @param normal The vector, z must not be negative.
+	 *
+	 * @return x in the 16 low bits and y in the 16 high bits.
+	 */
+	inline std::uint32_t	encodeSnorm16x2(const Vec3<float> &normal)
+	{
+		return ((__snorm(normal.x, 32767.0f) & 0xFFFFu) | (__snorm(normal.y, 32767.0f) << 16));
+	}
+
+	/**
+	 * @brief Decode a vector of the snorm16x2 form.
+	 *
+	 * @param bits The encoded vector.
+	 *
+	 * @return The unit vector, z is sqrt(1 - x^2 - y^2).
+	 */
+	inline Vec3<float>	decodeSnorm16x2(std::uint32_t bits)
+	{
+		const float	x = __unsnorm(bits, 16, 0);
+		const float	y = __unsnorm(bits, 16, 16);
+
+		return (Vec3<float>(x, y, std::sqrt(max(1.0f - x * x - y * y, 0.0f))));
+	}
+
+	//---- Batch ---------------------------------------------------------------
+
+	/**
+	 * @brief Encode a unit vector array in the octahedral form, with the best
+	 * simd level of the cpu.
+	 *
+	 * @param src The vectors.
+	 * @param dst The encoded vectors.
+	 * @param count Number of vectors.
+	 */
+	inline void	encodeOctahedral(const Vec3<float> *src, std::uint32_t *dst, std::size_t count)
+	{
+		kernels().encodeOctahedral(reinterpret_cast<const float *>(src), dst, count);
+	}
+
+	/**
+	 * @brief Decode an array of the octahedral form, with the best simd level
+	 * of the cpu.
+	 *
+	 * @param src The encoded vectors.
+	 * @param dst The unit vectors.
+	 * @param count Number of vectors.
+	 */
+	inline void	decodeOctahedral(const std::uint32_t *src, Vec3<float> *dst, std::size_t count)
+	{
+		kernels().decodeOctahedral(src, reinterpret_cast<float *>(dst), count);
+	}
+
+	/**
+	 * @brief Encode a vector array in the 10-10-10-2 snorm form, with the best
+	 * simd level of the cpu.
+	 *
+	 * @param src The vectors.
+	 * @param dst The encoded vectors.
+	 * @param count Number of vectors.
+	 */
+	inline void	encode1010102(const Vec3<float> *src, std::uint32_t *dst, std::size_t count)
+	{
+		kernels().encode1010102(reinterpret_cast<const float *>(src), dst, count);
+	}
+
+	/**
+	 * @brief Decode an array of the 10-10-10-2 snorm form, with the best simd
+	 * level of the cpu.
+	 *
+	 * @param src The encoded vectors.
+	 * @param dst The vectors.
+	 * @param count Number of vectors.
+	 */
+	inline void	decode1010102(const std::uint32_t *src, Vec3<float> *dst, std::size_t count)
+	{
+		kernels().decode1010102(src, reinterpret_cast<float *>(dst), count);
+	}
+
+	/**
+	 * @brief Encode x and y of a unit vector array in snorm16, with the best
+	 * simd level of the cpu.
+	 *
+	 * @param src The vectors, z must not be negative.
+	 * @param dst The encoded vectors.
+	 * @param count Number of vectors.
+	 */
+	inline void	encodeSnorm16x2(const Vec3<float> *src, std::uint32_t *dst, std::size_t count)
+	{
+		kernels().encodeSnorm16x2(reinterpret_cast<const float *>(src), dst, count);
+	}
+
+	/**
+	 * @brief Decode an array of the snorm16x2 form, with the best simd level
+	 * of the cpu.
+	 *
+	 * @param src The encoded vectors.
+	 * @param dst The unit vectors.
+	 * @param count Number of vectors.
+	 */
+	inline void	decodeSnorm16x2(const std::uint32_t *src, Vec3<float> *dst, std::size_t count)
+	{
+		kernels().decodeSnorm16x2(src, reinterpret_cast<float *>(dst), count);
+	}
+
+	//**** CHECKS **************************************************************
+
+	static_assert(sizeof(Vec3<float>) == 3 * sizeof(float), "Vec3<float> must be packed for the batch kernels");
+}
+
+#endif
@@ -0,0 +1,167 @@
+#ifndef GM_PRECISION_HPP
+# define GM_PRECISION_HPP
+
+# include <gmath/config.hpp>
+# include <gmath/simd.hpp>
+
+# ifdef GM_FAST_TRIG
+#  include <gmath/fast.hpp>
+# endif
+
+# include <cmath>
+
+//**** PRECISION POLICY ********************************************************
+// sqrt, sin, cos, tan and acos of the headers run in MathPrecision<T>::type,
+// then are cast back to T. float stay in float (sqrtf, sinf, ...), so the
+// compiler can use sqrtss and packed single precision code, without two
+// conversions per call. Define GM_PRECISE_FLOAT to compute float in double, as before.
+
+namespace gm {
+	//**** TYPES ***************************************************************
+
+	/**
+	 * @brief Type used to compute the square root and trigonometry of T.
+	 * Integers use double. Can be specialized for user types.
+	 */
+	template <typename T>
+	struct MathPrecision
+	{
+		typedef double	type;
+	};
+
+	template <>
+	struct MathPrecision<float>
+	{
+# ifdef GM_PRECISE_FLOAT
+		typedef double	type;
+# else
+		typedef float	type;
+# endif
+	};
+
+	template <>
+	struct MathPrecision<long double>
+	{
+		typedef long double	type;
+	};
+
+	//**** FUNCTIONS ***********************************************************
+
+	/**
+	 * @brief Internal function for precision. Square root in the precision
+	 * of T.
+	 *
+	 * @param value Positive value.
+	 *
+	 * @return Square root of value.
+	 */
+	template <typename T>
+	T	__sqrt(const T &value)
+	{
+		typedef typename MathPrecision<T>::type	P;
+
+		return (static_cast<T>(std::sqrt(static_cast<P>(value))));
+	}
+
+	/**
+	 * @brief Internal function for precision. Arc cosinus in the precision
+	 * of T.
+	 *
+	 * @param value Value in [-1, 1].
+	 *
+	 * @return Arc cosinus of value.
+	 */
+	template <typename T>
+	T	__acos(const T &value)
+	{
+		typedef typename MathPrecision<T>::type	P;
+
+		return (static_cast<T>(std::acos(static_cast<P>(value))));
+	}
+
+	/**
+	 * @brief Internal function for precision. Sinus in the precision of T.
+	 *
+	 * @param radians The angle in radians.
+	 *
+	 * @return Sinus of radians.
+	 */
+	template <typename T>
+	T	__sin(const T &radians)
+	{
+		typedef typename MathPrecision<T>::type	P;
+
+		return (static_cast<T>(std::sin(static_cast<P>(radians))));
+	}
+
+	/**
+	 * @brief Internal function for precision. Tangent in the precision of T.
+	 *
+	 * @param radians The angle in radians.
+	 *
+	 * @return Tangent of radians.
+	 */
+	template <typename T>
+	T	__tan(const T &radians)
+	{
+		typedef typename MathPrecision<T>::type	P;
+
+		return (static_cast<T>(std::tan(static_cast<P>(radians))));
+	}
+
+	/**
+	 * @brief Internal function for precision. Approximated 1 / sqrt(value).
+	 *
+	 * float use the hardware estimate with one Newton-Raphson step when SSE
+	 * is available, relative error below 2.5e-7. Other types are exact.
+	 *
+	 * @param value Positive value.
+	 *
+	 * @return 1 / sqrt(value).
+	 */
+	template <typename T>
+	T	__rsqrt(const T &value)
+	{
+		return (static_cast<T>(1) / __sqrt(value));
+	}
+
+# ifdef GM_SSE2
+	inline float	__rsqrt(float value)
+	{
+		return (_mm_cvtss_f32(__rsqrt(_mm_set_ss(value))));
+	}
+# endif
+
+	/**
+	 * @brief Internal function for rotations. Sinus and cosinus of an angle,
+	 * with gm::fast::sincos for float and double when GM_FAST_TRIG is defined.
+	 *
+	 * @param radians The angle in radians.
+	 * @param s Receive the sinus.
+	 * @param c Receive the cosinus.
+	 */
+	template <typename T>
+	void	__sincos(T radians, T &s, T &c)
+	{
+		typedef typename MathPrecision<T>::type	P;
+
+		const P	value = static_cast<P>(radians);
+
+		s = static_cast<T>(std::sin(value));
+		c = static_cast<T>(std::cos(value));
+	}
+
+# ifdef GM_FAST_TRIG
+	inline void	__sincos(float radians, float &s, float &c)
+	{
+		fast::sincos(radians, s, c);
+	}
+
+	inline void	__sincos(double radians, double &s, double &c)
+	{
+		fast::sincos(radians, s, c);
+	}
+# endif
+}
+
+#endif
@@ -0,0 +1,117 @@
+#ifndef GM_SIMD_HPP
+# define GM_SIMD_HPP
+
+# include <gmath/config.hpp>
+
+# ifdef GM_SSE2
+#  include <immintrin.h>
+
+//**** FUNCTIONS ***************************************************************
+
+namespace gm {
+	/**
+	 * @brief Internal function for simd. Horizontal sum of a register.
+	 *
+	 * @param vec The register to sum.
+	 *
+	 * @return Register with the sum of the 4 lanes in every lane.
+	 */
+	inline __m128	__hsum(__m128 vec)
+	{
+		__m128	tmp = _mm_add_ps(vec, _mm_shuffle_ps(vec, vec, _MM_SHUFFLE(2, 3, 0, 1)));
+
+		return (_mm_add_ps(tmp, _mm_shuffle_ps(tmp, tmp, _MM_SHUFFLE(1, 0, 3, 2))));
+	}
+
+	/**
+	 * @brief Internal function for simd. Dot product of 2 registers.
+	 *
+	 * @param v1 First register.
+	 * @param v2 Second register.
+	 *
+	 * @return Register with the dot product in every lane.
+	 */
+	inline __m128	__dot4(__m128 v1, __m128 v2)
+	{
+		return (__hsum(_mm_mul_ps(v1, v2)));
+	}
+
+#  if defined(GM_USE_FMA) && defined(GM_FMA)
+	/**
+	 * @brief Internal function for simd. Dot product of the 3 first lanes,
+	 * each add fused in the order of the scalar __dot, so same bits.
+	 *
+	 * @param v1 First register.
+	 * @param v2 Second register.
+	 *
+	 * @return Register with the dot product in the first lane.
+	 */
+	inline __m128	__fusedDot3(__m128 v1, __m128 v2)
+	{
+		const __m128	res = _mm_mul_ss(v1, v2);
+		const __m128	y = _mm_fmadd_ss(_mm_shuffle_ps(v1, v1, _MM_SHUFFLE(1, 1, 1, 1)),
+										_mm_shuffle_ps(v2, v2, _MM_SHUFFLE(1, 1, 1, 1)), res);
+
+		return (_mm_fmadd_ss(_mm_movehl_ps(v1, v1), _mm_movehl_ps(v2, v2), y));
+	}
+
+	/**
+	 * @brief Internal function for simd. Dot product of 2 registers, each add
+	 * fused in the order of the scalar __dot, so same bits.
+	 *
+	 * @param v1 First register.
+	 * @param v2 Second register.
+	 *
+	 * @return Register with the dot product in the first lane.
+	 */
+	inline __m128	__fusedDot4(__m128 v1, __m128 v2)
+	{
+		return (_mm_fmadd_ss(_mm_shuffle_ps(v1, v1, _MM_SHUFFLE(3, 3, 3, 3)),
+							_mm_shuffle_ps(v2, v2, _MM_SHUFFLE(3, 3, 3, 3)), __fusedDot3(v1, v2)));
+	}
+#  endif
+
+	/**
+	 * @brief Internal function for simd. Cross product of the 3 first lanes.
+	 *
+	 * @param v1 First register.
+	 * @param v2 Second register.
+	 *
+	 * @return Register with the cross product, last lane at 0.
+	 */
+	inline __m128	__cross3(__m128 v1, __m128 v2)
+	{
+		// (y, z, x, w) of each vector
+		const __m128	aYzx = _mm_shuffle_ps(v1, v1, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128	bYzx = _mm_shuffle_ps(v2, v2, _MM_SHUFFLE(3, 0, 2, 1));
+		// (a * b.yzx - a.yzx * b).yzx
+		const __m128	res = _mm_sub_ps(_mm_mul_ps(v1, bYzx), _mm_mul_ps(aYzx, v2));
+
+		return (_mm_shuffle_ps(res, res, _MM_SHUFFLE(3, 0, 2, 1)));
+	}
+
+	/**
+	 * @brief Internal function for simd. Approximated 1 / sqrt(value).
+	 *
+	 * Hardware estimate refined by one Newton-Raphson step, relative error is
+	 * below 2.5e-7.
+	 *
+	 * @param value Register of values, must be positive.
+	 *
+	 * @return Register of 1 / sqrt(value).
+	 */
+	inline __m128	__rsqrt(__m128 value)
+	{
+		const __m128	half = _mm_set1_ps(0.5f);
+		const __m128	threeHalf = _mm_set1_ps(1.5f);
+		__m128			res = _mm_rsqrt_ps(value);
+
+		// res = res * (1.5 - 0.5 * value * res * res)
+		return (_mm_mul_ps(res, _mm_sub_ps(threeHalf,
+					_mm_mul_ps(_mm_mul_ps(half, value), _mm_mul_ps(res, res)))));
+	}
+}
+
+# endif
+
+#endif
@@ -0,0 +1,453 @@
+#ifndef GM_TRANSFORM_HPP
+# define GM_TRANSFORM_HPP
+
+# include <gmath/Vec2.hpp>
+# include <gmath/Vec3.hpp>
+# include <gmath/Vec4.hpp>
+# include <gmath/Mat2.hpp>
+# include <gmath/Mat3.hpp>
+# include <gmath/Mat4.hpp>
+# include <gmath/VecMat.hpp>
+# include <gmath/dispatch.hpp>
+# include <gmath/memory.hpp>
+
+#include <cstddef>
+#include <limits>
+
+namespace gm {
+	//**** FUNCTIONS ***********************************************************
+	//---- Generic -------------------------------------------------------------
+
+	/**
+	 * @brief Transform an array of points by a Mat4 (w = 1).
+	 *
+	 * @param mat4 The transform matrix, its last row is ignored.
+	 * @param src The points to transform.
+	 * @param dst Array of count points for the results, can be src.
+	 * @param count Number of points.
+	 */
+	template <typename T, class L>
+	void	transformPoints(const Mat4<T, L> &mat4, const Vec3<T> *src, Vec3<T> *dst, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; i++)
+			dst[i] = (mat4 * Vec4<T>(src[i].x, src[i].y, src[i].z, static_cast<T>(1))).xyz();
+	}
+
+	/**
+	 * @brief Transform an array of directions by a Mat4 (w = 0).
+	 *
+	 * @param mat4 The transform matrix, translation and last row are ignored.
+	 * @param src The vectors to transform.
+	 * @param dst Array of count vectors for the results, can be src.
+	 * @param count Number of vectors.
+	 */
+	template <typename T, class L>
+	void	transformVectors(const Mat4<T, L> &mat4, const Vec3<T> *src, Vec3<T> *dst, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; i++)
+			dst[i] = (mat4 * Vec4<T>(src[i].x, src[i].y, src[i].z, static_cast<T>(0))).xyz();
+	}
+
+	/**
+	 * @brief Transform an array of Vec4 by a Mat4.
+	 *
+	 * @param mat4 The transform matrix.
+	 * @param src The vectors to transform.
+	 * @param dst Array of count vectors for the results, can be src.
+	 * @param count Number of vectors.
+	 */
+	template <typename T, class L>
+	void	transformHomogeneous(const Mat4<T, L> &mat4, const Vec4<T> *src, Vec4<T> *dst, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; i++)
+			dst[i] = mat4 * src[i];
+	}
+
+	/**
+	 * @brief Rotate an array of Vec2, the cosinus and sinus are computed once.
+	 *
+	 * @param radians The angle in radians.
+	 * @param src The vectors to rotate.
+	 * @param dst Array of count vectors for the results, can be src.
+	 * @param count Number of vectors.
+	 */
+	template <typename T>
+	void	rotate(T radians, const Vec2<T> *src, Vec2<T> *dst, std::size_t count)
+	{
+		const Mat2<T>	mat2 = Mat2<T>::rotation(radians);
+
+		for (std::size_t i = 0; i < count; i++)
+			dst[i] = mat2 * src[i];
+	}
+
+	/**
+	 * @brief Rotate an array of Vec3, the rotation matrix is computed once.
+	 *
+	 * @param axis Vec3 to tell on wich axis the rotation will be done. It must be normalized.
+	 * @param radians The angle in radians.
+	 * @param src The vectors to rotate.
+	 * @param dst Array of count vectors for the results, can be src.
+	 * @param count Number of vectors.
+	 */
+	template <typename T>
+	void	rotate(const Vec3<T> &axis, T radians, const Vec3<T> *src, Vec3<T> *dst, std::size_t count)
+	{
+		const Mat3<T>	mat3 = Mat3<T>::rotation(axis, radians);
+
+		for (std::size_t i = 0; i < count; i++)
+			dst[i] = mat3 * src[i];
+	}
+
+	/**
+	 * @brief Rotate an array of Vec4 in 3D, the rotation matrix is computed
+	 * once. w values are unchanged.
+	 *
+	 * @param axis Vec3 to tell on wich axis the rotation will be done. It must be normalized.
+	 * @param radians The angle in radians.
+	 * @param src The vectors to rotate.
+	 * @param dst Array of count vectors for the results, can be src.
+	 * @param count Number of vectors.
+	 */
+	template <typename T>
+	void	rotate(const Vec3<T> &axis, T radians, const Vec4<T> *src, Vec4<T> *dst, std::size_t count)
+	{
+		transformHomogeneous(Mat4<T>::rotation3D(axis, radians), src, dst, count);
+	}
+
+	/**
+	 * @brief Normalize an array of Vec2 with normalizeFast.
+	 *
+	 * @param src The vectors to normalize, none can be null.
+	 * @param dst Array of count vectors for the results, can be src.
+	 * @param count Number of vectors.
+	 */
+	template <typename T>
+	void	normalizeFast(const Vec2<T> *src, Vec2<T> *dst, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; i++)
+			dst[i] = normalizeFast(src[i]);
+	}
+
+	/**
+	 * @brief Normalize an array of Vec2 with normalizeSafe.
+	 *
+	 * @param src The vectors to normalize.
+	 * @param dst Array of count vectors for the results, can be src.
+	 * @param count Number of vectors.
+	 * @param epsilon Norm under which a result is a null Vec2.
+	 */
+	template <typename T>
+	void	normalizeSafe(const Vec2<T> *src, Vec2<T> *dst, std::size_t count,
+							T epsilon = std::numeric_limits<T>::epsilon())
+	{
+		for (std::size_t i = 0; i < count; i++)
+			dst[i] = normalizeSafe(src[i], epsilon);
+	}
+
+	/**
+	 * @brief Normalize an array of Vec3 with normalizeFast.
+	 *
+	 * @param src The vectors to normalize, none can be null.
+	 * @param dst Array of count vectors for the results, can be src.
+	 * @param count Number of vectors.
+	 */
+	template <typename T>
+	void	normalizeFast(const Vec3<T> *src, Vec3<T> *dst, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; i++)
+			dst[i] = normalizeFast(src[i]);
+	}
+
+	/**
+	 * @brief Normalize an array of Vec3 with normalizeSafe.
+	 *
+	 * @param src The vectors to normalize.
+	 * @param dst Array of count vectors for the results, can be src.
+	 * @param count Number of vectors.
+	 * @param epsilon Norm under which a result is a null Vec3.
+	 */
+	template <typename T>
+	void	normalizeSafe(const Vec3<T> *src, Vec3<T> *dst, std::size_t count,
+							T epsilon = std::numeric_limits<T>::epsilon())
+	{
+		for (std::size_t i = 0; i < count; i++)
+			dst[i] = normalizeSafe(src[i], epsilon);
+	}
+
+	/**
+	 * @brief Normalize an array of Vec4 with normalizeFast.
+	 *
+	 * @param src The vectors to normalize, none can be null.
+	 * @param dst Array of count vectors for the results, can be src.
+	 * @param count Number of vectors.
+	 */
+	template <typename T>
+	void	normalizeFast(const Vec4<T> *src, Vec4<T> *dst, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; i++)
+			dst[i] = normalizeFast(src[i]);
+	}
+
+	/**
+	 * @brief Normalize an array of Vec4 with normalizeSafe.
+	 *
+	 * @param src The vectors to normalize.
+	 * @param dst Array of count vectors for the results, can be src.
+	 * @param count Number of vectors.
+	 * @param epsilon Norm under which a result is a null Vec4.
+	 */
+	template <typename T>
+	void	normalizeSafe(const Vec4<T> *src, Vec4<T> *dst, std::size_t count,
+							T epsilon = std::numeric_limits<T>::epsilon())
+	{
+		for (std::size_t i = 0; i < count; i++)
+			dst[i] = normalizeSafe(src[i], epsilon);
+	}
+
+	//---- Float ---------------------------------------------------------------
+	// Float versions run the batch kernels, 4 to 16 vectors per iteration.
+	// Kernels read a RowMajor matrix, other layouts are converted once.
+
+	static_assert(sizeof(Vec2<float>) == 2 * sizeof(float), "Vec2f must be packed");
+	static_assert(sizeof(Vec3<float>) == 3 * sizeof(float), "Vec3f must be packed");
+	static_assert(sizeof(Vec4<float>) == 4 * sizeof(float), "Vec4f must be packed");
+
+	/**
+	 * @brief Transform an array of points by a Mat4f (w = 1), with the best
+	 * simd level of the cpu.
+	 *
+	 * @param mat4 The transform matrix, its last row is ignored.
+	 * @param src The points to transform.
+	 * @param dst Array of count points for the results, can be src.
+	 * @param count Number of points.
+	 */
+	template <class L>
+	void	transformPoints(const Mat4<float, L> &mat4, const Vec3<float> *src, Vec3<float> *dst, std::size_t count)
+	{
+		const Mat4<float>	rows(mat4);
+
+		kernels().transformPoints(rows.values, reinterpret_cast<const float *>(src), reinterpret_cast<float *>(dst), count);
+	}
+
+	/**
+	 * @brief Transform an array of directions by a Mat4f (w = 0), with the
+	 * best simd level of the cpu.
+	 *
+	 * @param mat4 The transform matrix, translation and last row are ignored.
+	 * @param src The vectors to transform.
+	 * @param dst Array of count vectors for the results, can be src.
+	 * @param count Number of vectors.
+	 */
+	template <class L>
+	void	transformVectors(const Mat4<float, L> &mat4, const Vec3<float> *src, Vec3<float> *dst, std::size_t count)
+	{
+		const Mat4<float>	rows(mat4);
+
+		kernels().transformVectors(rows.values, reinterpret_cast<const float *>(src), reinterpret_cast<float *>(dst), count);
+	}
+
+	/**
+	 * @brief Transform an array of Vec4f by a Mat4f, with the best simd level
+	 * of the cpu.
+	 *
+	 * @param mat4 The transform matrix.
+	 * @param src The vectors to transform.
+	 * @param dst Array of count vectors for the results, can be src.
+	 * @param count Number of vectors.
+	 */
+	template <class L>
+	void	transformHomogeneous(const Mat4<float, L> &mat4, const Vec4<float> *src, Vec4<float> *dst, std::size_t count)
+	{
+		const Mat4<float>	rows(mat4);
+
+		kernels().transformHomogeneous(rows.values, reinterpret_cast<const float *>(src), reinterpret_cast<float *>(dst), count);
+	}
+
+	/**
+	 * @brief Rotate an array of Vec3f, with the best simd level of the cpu.
+	 *
+	 * @param axis Vec3 to tell on wich axis the rotation will be done. It must be normalized.
+	 * @param radians The angle in radians.
+	 * @param src The vectors to rotate.
+	 * @param dst Array of count vectors for the results, can be src.
+	 * @param count Number of vectors.
+	 */
+	inline void	rotate(const Vec3<float> &axis, float radians, const Vec3<float> *src, Vec3<float> *dst, std::size_t count)
+	{
+		transformVectors(Mat4<float>::rotation3D(axis, radians), src, dst, count);
+	}
+
+	/**
+	 * @brief Normalize an array of Vec2f with normalizeFast, with the best
+	 * simd level of the cpu. Relative error below 4e-7 on each component.
+	 *
+	 * @param src The vectors to normalize, none can be null.
+	 * @param dst Array of count vectors for the results, can be src.
+	 * @param count Number of vectors.
+	 */
+	inline void	normalizeFast(const Vec2<float> *src, Vec2<float> *dst, std::size_t count)
+	{
+		kernels().normalizeFast(reinterpret_cast<const float *>(src), 2, reinterpret_cast<float *>(dst), count);
+	}
+
+	/**
+	 * @brief Normalize an array of Vec2f with normalizeSafe, with the best
+	 * simd level of the cpu.
+	 *
+	 * @param src The vectors to normalize.
+	 * @param dst Array of count vectors for the results, can be src.
+	 * @param count Number of vectors.
+	 * @param epsilon Norm under which a result is a null Vec2f.
+	 */
+	inline void	normalizeSafe(const Vec2<float> *src, Vec2<float> *dst, std::size_t count,
+							float epsilon = std::numeric_limits<float>::epsilon())
+	{
+		kernels().normalizeSafe(reinterpret_cast<const float *>(src), 2, epsilon, reinterpret_cast<float *>(dst), count);
+	}
+
+	/**
+	 * @brief Normalize an array of Vec3f with normalizeFast, with the best
+	 * simd level of the cpu. Relative error below 4e-7 on each component.
+	 *
+	 * @param src The vectors to normalize, none can be null.
+	 * @param dst Array of count vectors for the results, can be src.
+	 * @param count Number of vectors.
+	 */
+	inline void	normalizeFast(const Vec3<float> *src, Vec3<float> *dst, std::size_t count)
+	{
+		kernels().normalizeFast(reinterpret_cast<const float *>(src), 3, reinterpret_cast<float *>(dst), count);
+	}
+
+	/**
+	 * @brief Normalize an array of Vec3f with normalizeSafe, with the best
+	 * simd level of the cpu.
+	 *
+	 * @param src The vectors to normalize.
+	 * @param dst Array of count vectors for the results, can be src.
+	 * @param count Number of vectors.
+	 * @param epsilon Norm under which a result is a null Vec3f.
+	 */
+	inline void	normalizeSafe(const Vec3<float> *src, Vec3<float> *dst, std::size_t count,
+							float epsilon = std::numeric_limits<float>::epsilon())
+	{
+		kernels().normalizeSafe(reinterpret_cast<const float *>(src), 3, epsilon, reinterpret_cast<float *>(dst), count);
+	}
+
+	/**
+	 * @brief Normalize an array of Vec4f with normalizeFast, with the best
+	 * simd level of the cpu. Relative error below 4e-7 on each component.
+	 *
+	 * @param src The vectors to normalize, none can be null.
+	 * @param dst Array of count vectors for the results, can be src.
+	 * @param count Number of vectors.
+	 */
+	inline void	normalizeFast(const Vec4<float> *src, Vec4<float> *dst, std::size_t count)
+	{
+		kernels().normalizeFast(reinterpret_cast<const float *>(src), 4, reinterpret_cast<float *>(dst), count);
+	}
+
+	/**
+	 * @brief Normalize an array of Vec4f with normalizeSafe, with the best
+	 * simd level of the cpu.
+	 *
+	 * @param src The vectors to normalize.
+	 * @param dst Array of count vectors for the results, can be src.
+	 * @param count Number of vectors.
+	 * @param epsilon Norm under which a result is a null Vec4f.
+	 */
+	inline void	normalizeSafe(const Vec4<float> *src, Vec4<float> *dst, std::size_t count,
+							float epsilon = std::numeric_limits<float>::epsilon())
+	{
+		kernels().normalizeSafe(reinterpret_cast<const float *>(src), 4, epsilon, reinterpret_cast<float *>(dst), count);
+	}
+
+	//---- Buffers -------------------------------------------------------------
+	// Same functions on Buffer, their alignment is checked at compile time.
+
+	/**
+	 * @brief Transform a Buffer of points by a Mat4f (w = 1), with the best
+	 * simd level of the cpu.
+	 *
+	 * @param mat4 The transform matrix, its last row is ignored.
+	 * @param src The points to transform.
+	 * @param dst The results, resized to src size. Can be src.
+	 */
+	template <class L, std::size_t A, std::size_t B>
+	void	transformPoints(const Mat4<float, L> &mat4, const Buffer<Vec3<float>, A> &src, Buffer<Vec3<float>, B> &dst)
+	{
+		__checkBatchBuffer<A>();
+		__checkBatchBuffer<B>();
+		dst.resize(src.size());
+		transformPoints(mat4, src.data(), dst.data(), src.size());
+	}
+
+	/**
+	 * @brief Transform a Buffer of directions by a Mat4f (w = 0), with the
+	 * best simd level of the cpu.
+	 *
+	 * @param mat4 The transform matrix, translation and last row are ignored.
+	 * @param src The vectors to transform.
+	 * @param dst The results, resized to src size. Can be src.
+	 */
+	template <class L, std::size_t A, std::size_t B>
+	void	transformVectors(const Mat4<float, L> &mat4, const Buffer<Vec3<float>, A> &src, Buffer<Vec3<float>, B> &dst)
+	{
+		__checkBatchBuffer<A>();
+		__checkBatchBuffer<B>();
+		dst.resize(src.size());
+		transformVectors(mat4, src.data(), dst.data(), src.size());
+	}
+
+	/**
+	 * @brief Transform a Buffer of Vec4f by a Mat4f, with the best simd level
+	 * of the cpu.
+	 *
+	 * @param mat4 The transform matrix.
+	 * @param src The vectors to transform.
+	 * @param dst The results, resized to src size. Can be src.
+	 */
+	template <class L, std::size_t A, std::size_t B>
+	void	transformHomogeneous(const Mat4<float, L> &mat4, const Buffer<Vec4<float>, A> &src, Buffer<Vec4<float>, B> &dst)
+	{
+		__checkBatchBuffer<A>();
+		__checkBatchBuffer<B>();
+		dst.resize(src.size());
+		transformHomogeneous(mat4, src.data(), dst.data(), src.size());
+	}
+
+	/**
+	 * @brief Normalize a Buffer of Vec2f, Vec3f or Vec4f with normalizeFast,
+	 * with the best simd level of the cpu.
+	 *
+	 * @param src The vectors to normalize, none can be null.
+	 * @param dst The results, resized to src size. Can be src.
+	 */
+	template <typename V, std::size_t A, std::size_t B>
+	void	normalizeFast(const Buffer<V, A> &src, Buffer<V, B> &dst)
+	{
+		__checkBatchBuffer<A>();
+		__checkBatchBuffer<B>();
+		dst.resize(src.size());
+		normalizeFast(src.data(), dst.data(), src.size());
+	}
+
+	/**
+	 * @brief Normalize a Buffer of Vec2f, Vec3f or Vec4f with normalizeSafe,
+	 * with the best simd level of the cpu.
+	 *
+	 * @param src The vectors to normalize.
+	 * @param dst The results, resized to src size. Can be src.
+	 * @param epsilon Norm under which a result is a null vector.
+	 */
+	template <typename V, std::size_t A, std::size_t B>
+	void	normalizeSafe(const Buffer<V, A> &src, Buffer<V, B> &dst,
+							float epsilon = std::numeric_limits<float>::epsilon())
+	{
+		__checkBatchBuffer<A>();
+		__checkBatchBuffer<B>();
+		dst.resize(src.size());
+		normalizeSafe(src.data(), dst.data(), src.size(), epsilon);
+	}
+}
+
+#endif
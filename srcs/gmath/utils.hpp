@@ -22,9 +22,7 @@ namespace gm {
 	template <typename T>
 	T	min(const T &a, const T &b)
 	{
-		if (a < b)
-			return (a);
-		return (b);
+		return (a < b ? a : b);
 	}
 
 	/**
@@ -38,9 +36,7 @@ namespace gm {
 	template <typename T>
 	T	max(const T &a, const T &b)
 	{
-		if (a > b)
-			return (a);
-		return (b);
+		return (a > b ? a : b);
 	}
 
 	/**
@@ -53,9 +49,7 @@ namespace gm {
 	template <typename T>
 	T	abs(const T &value)
 	{
-		if (value < static_cast<T>(0))
-			return (-value);
-		return (value);
+		return (value < static_cast<T>(0) ? -value : value);
 	}
 
 	/**
@@ -68,13 +62,83 @@ namespace gm {
 	template <typename T>
 	T	sign(const T &value)
 	{
-		T	zero = static_cast<T>(0);
+		const T	zero = static_cast<T>(0);
 
-		if (value < zero)
-			return (static_cast<T>(-1));
-		else if (value > zero)
-			return (static_cast<T>(1));
-		return (zero);
+		return (static_cast<T>(static_cast<int>(zero < value) - static_cast<int>(value < zero)));
+	}
+
+	/**
+	 * @brief Clamp a value between two bounds.
+	 *
+	 * @param value Input value.
+	 * @param low Lower bound.
+	 * @param high Upper bound, not below low.
+	 *
+	 * @return value, low or high.
+	 */
+	template <typename T>
+	T	clamp(const T &value, const T &low, const T &high)
+	{
+		return (min(max(value, low), high));
+	}
+
+	/**
+	 * @brief Get fractional part of value.
+	 *
+	 * @param value Input value.
+	 *
+	 * @return value - floor(value), in [0, 1).
+	 */
+	template <typename T>
+	T	fract(const T &value)
+	{
+		return (value - static_cast<T>(std::floor(value)));
+	}
+
+	/**
+	 * @brief Step function.
+	 *
+	 * @param edge Value where the step is.
+	 * @param value Input value.
+	 *
+	 * @return 0 if value is below edge, 1 otherwise.
+	 */
+	template <typename T>
+	T	step(const T &edge, const T &value)
+	{
+		return (value < edge ? static_cast<T>(0) : static_cast<T>(1));
+	}
+
+	/**
+	 * @brief Hermite interpolation between 0 and 1.
+	 *
+	 * @param edge0 Value where the result start to grow from 0.
+	 * @param edge1 Value where the result reach 1, not equal to edge0.
+	 * @param value Input value.
+	 *
+	 * @return 0 below edge0, 1 above edge1, and a smooth curve between.
+	 */
+	template <typename T>
+	T	smoothstep(const T &edge0, const T &edge1, const T &value)
+	{
+		const T	t = clamp((value - edge0) / (edge1 - edge0), static_cast<T>(0), static_cast<T>(1));
+
+		return (t * t * (static_cast<T>(3) - static_cast<T>(2) * t));
+	}
+
+	/**
+	 * @brief Choose between two values, without branch for arithmetic types.
+	 *
+	 * @param mask The condition.
+	 * @param a Value if mask is true.
+	 * @param b Value if mask is false.
+	 *
+	 * @return a or b.
+	 */
+	template <typename T>
+	T	select(bool mask, const T &a, const T &b)
+	{
+		return (mask ? a : b);
 	}
 
 	/**
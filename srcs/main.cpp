@@ -1,4 +1,8 @@
 #include <gmath.hpp>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
 
 int	main(void)
 {
@@ -170,6 +174,1048 @@ int	main(void)
 		std::cout << "vec2 : " << vec2 << ", -vec2 : " << -vec2 << std::endl;
 	}
 
+	{
+		gm::Vec4f	v1(1.0f, 2.0f, 3.0f, 4.0f);
+		gm::Vec4f	v2(0.5f);
+
+		std::cout << "vec4f v1 : " << v1 << ", v2 : " << v2 << std::endl;
+		std::cout << "v1 + v2 : " << v1 + v2 << ", v1 - v2 : " << v1 - v2 << std::endl;
+		std::cout << "v1 * 2 : " << v1 * 2.0f << ", v1 / 2 : " << v1 / 2.0f << std::endl;
+		std::cout << "dot : " << gm::dot(v1, v2) << ", norm : " << gm::norm(v1) << std::endl;
+		std::cout << "normalize : " << gm::normalize(v1) << ", norm : " << gm::norm(gm::normalize(v1)) << std::endl;
+	}
+
+	{
+		gm::Vec3Af	v1(1.0f, 2.0f, 3.0f);
+		gm::Vec3f	packed(0.0f, 1.0f, 0.0f);
+		gm::Vec3Af	v2 = packed;
+
+		std::cout << "vec3af v1 : " << v1 << ", v2 : " << v2 << ", sizeof : " << sizeof(gm::Vec3Af) << std::endl;
+		std::cout << "v1 + v2 : " << v1 + v2 << ", v1 * 2 : " << v1 * 2.0f << std::endl;
+		std::cout << "dot : " << gm::dot(v1, v2) << ", cross : " << gm::cross(v1, v2)
+					<< ", vec3f cross : " << gm::cross(gm::Vec3f(v1), packed) << std::endl;
+		std::cout << "normalize : " << gm::normalize(v1) << ", norm : " << gm::norm(gm::normalize(v1)) << std::endl;
+		std::cout << "hash : " << (gm::hash(v1) == gm::hash(gm::Vec3f(v1))) << std::endl;
+
+		// The pad lane stays at 0 after inf and nan, the norms are the Vec3f ones
+		const float			inf = std::numeric_limits<float>::infinity();
+		const gm::Vec3Af	byZero = gm::Vec3Af(1.0f, 2.0f, 2.0f) / 0.0f;
+		const gm::Vec3Af	byInf = v1 * inf;
+		bool				padOk = gm::norm2(byZero) == inf && gm::norm(byZero) == inf;
+
+		padOk = padOk && gm::dot(byInf, v1) == gm::dot(gm::Vec3f(v1) * inf, gm::Vec3f(v1));
+#ifdef GM_SSE2
+		// Exact division, not the reciprocal square root estimate
+		padOk = padOk && gm::normalize(gm::Vec3Af(3.0f, 4.0f, 12.0f)).z == 12.0f / 13.0f;
+#endif
+		std::cout << "vec3af pad and normalize : " << padOk << std::endl;
+	}
+
+	{
+		const gm::SimdLevel	detected = gm::detectSimdLevel();
+		float				a[19];
+		float				b[19];
+		float				res[19];
+		bool				ok = true;
+
+		for (int i = 0; i < 19; i++)
+		{
+			a[i] = static_cast<float>(i);
+			b[i] = static_cast<float>(i * 2);
+		}
+
+		std::cout << "simd level : " << gm::simdLevelName(gm::getSimdLevel()) << std::endl;
+		for (int level = 0; level <= static_cast<int>(detected); level++)
+		{
+			gm::setSimdLevel(static_cast<gm::SimdLevel>(level));
+			gm::madd(a, 2.0f, b, res, 19);
+			for (int i = 0; i < 19; i++)
+				ok = ok && res[i] == static_cast<float>(i * 4);
+			gm::add(a, b, res, 19);
+			for (int i = 0; i < 19; i++)
+				ok = ok && res[i] == static_cast<float>(i * 3);
+		}
+		gm::setSimdLevel(detected);
+		std::cout << "batch kernels : " << (ok ? "ok" : "error") << std::endl;
+	}
+
+	{
+		gm::Vec3SoAf	a;
+		gm::Vec3SoAf	b;
+		gm::Vec3SoAf	res;
+		float			values[19];
+		bool			ok = true;
+
+		for (int i = 0; i < 19; i++)
+		{
+			a.pushBack(gm::Vec3f(static_cast<float>(i), 1.0f, 2.0f));
+			b.pushBack(gm::Vec3f(0.0f, static_cast<float>(i), 0.0f));
+		}
+		a[0] = gm::Vec3f(0.0f, 0.0f, 0.0f);
+		b[1].z += 3.0f;
+
+		const gm::SimdLevel	detected = gm::detectSimdLevel();
+		for (int level = 0; level <= static_cast<int>(detected); level++)
+		{
+			gm::setSimdLevel(static_cast<gm::SimdLevel>(level));
+			gm::add(a, b, res);
+			gm::scale(res, 2.0f, res);
+			gm::sub(res, b, res);
+			gm::cross(a, b, res);
+			gm::dot(a, b, values);
+			for (std::size_t i = 0; i < a.size(); i++)
+			{
+				ok = ok && gm::Vec3f(res[i]) == gm::cross(gm::Vec3f(a[i]), gm::Vec3f(b[i]));
+				ok = ok && values[i] == gm::dot(gm::Vec3f(a[i]), gm::Vec3f(b[i]));
+			}
+			gm::normalize(a, res);
+			gm::norm(a, values);
+			for (std::size_t i = 0; i < a.size(); i++)
+			{
+				ok = ok && gm::Vec3f(res[i]) == gm::normalize(gm::Vec3f(a[i]));
+				ok = ok && values[i] == gm::norm(gm::Vec3f(a[i]));
+			}
+		}
+		gm::setSimdLevel(detected);
+
+		// Proxies work with the operators and functions of Vec3
+		const gm::Vec3f	v(1.0f, -2.0f, 0.5f);
+		bool			proxies = true;
+
+		for (std::size_t i = 0; i < a.size(); i++)
+		{
+			const gm::Vec3f	va(a[i]);
+			const gm::Vec3f	vb(b[i]);
+
+			proxies = proxies && a[i] + v == va + v && v - a[i] == v - va && a[i] - b[i] == va - vb && -a[i] == -va;
+			proxies = proxies && a[i] * 2.0f == va * 2.0f && 2.0f * a[i] == 2.0f * va && a[i] / 2.0f == va / 2.0f;
+			proxies = proxies && gm::dot(a[i], v) == gm::dot(va, v) && gm::dot(a[i], b[i]) == gm::dot(va, vb);
+			proxies = proxies && gm::cross(v, a[i]) == gm::cross(v, va) && gm::cross(a[i], b[i]) == gm::cross(va, vb);
+			proxies = proxies && gm::norm(a[i]) == gm::norm(va) && gm::norm2(a[i]) == gm::norm2(va);
+			proxies = proxies && gm::normalize(a[i]) == gm::normalize(va) && a[i] == va && !(a[i] != va);
+		}
+
+		gm::Vec2SoAd	v2(3);
+		gm::Vec4SoAf	v4(3);
+		v2[1] = gm::Vec2d(3.0, 4.0);
+		v4[2] = gm::Vec4f(1.0f, 1.0f, 1.0f, 1.0f);
+		proxies = proxies && gm::norm(v2[1]) == 5.0 && v2[1] * 2.0 - gm::Vec2d(6.0, 8.0) == gm::Vec2d(0.0, 0.0);
+		proxies = proxies && gm::dot(v4[2], v4[2]) == 4.0f && v4[2] + v4[2] == gm::Vec4f(2.0f, 2.0f, 2.0f, 2.0f);
+		proxies = proxies && gm::normalize(v4[2]) / 0.5f == gm::Vec4f(1.0f, 1.0f, 1.0f, 1.0f);
+		gm::normalize(v2, v2);
+		gm::normalize(v4, v4);
+
+		std::cout << "vec3 soa : " << res[3] << ", " << values[3] << ", aligned : "
+					<< (reinterpret_cast<std::uintptr_t>(a.getY()) % GM_SIMD_ALIGNMENT == 0) << std::endl;
+		std::cout << "vec2 soa : " << v2[1] << ", vec4 soa : " << v4[2] << std::endl;
+		std::cout << "soa kernels : " << (ok ? "ok" : "error") << ", proxies : " << (proxies ? "ok" : "error") << std::endl;
+	}
+
+	{
+		const gm::Mat4f	mat = gm::Mat4f::translation(gm::Vec3f(1.0f, -2.0f, 3.0f))
+							* gm::Mat4f::rotation3D(gm::normalize(gm::Vec3f(1.0f, 2.0f, 3.0f)), 0.7f);
+		const gm::Vec4f	moved = gm::Mat4f::translation(gm::Vec3f(1.0f, 2.0f, 3.0f)) * gm::Vec4f(1.0f, 1.0f, 1.0f, 1.0f);
+		gm::Vec3f		points[37];
+		gm::Vec3f		res[37];
+		gm::Vec3f		ref[37];
+		gm::Vec4f		points4[37];
+		gm::Vec4f		res4[37];
+		gm::Vec4f		ref4[37];
+		float			maxError = 0.0f;
+
+		for (int i = 0; i < 37; i++)
+		{
+			points[i] = gm::Vec3f(static_cast<float>(i), static_cast<float>(i % 5) - 2.0f, 0.5f * static_cast<float>(i));
+			points4[i] = gm::Vec4f(points[i].x, points[i].y, points[i].z, static_cast<float>(i % 3));
+		}
+
+		const gm::SimdLevel	detected = gm::detectSimdLevel();
+		for (int level = 0; level <= static_cast<int>(detected); level++)
+		{
+			gm::setSimdLevel(static_cast<gm::SimdLevel>(level));
+			gm::transformPoints(mat, points, res, 37);
+			gm::transformPoints<float>(mat, points, ref, 37);
+			for (int i = 0; i < 37; i++)
+				maxError = std::max(maxError, gm::norm(res[i] - ref[i]) / (1.0f + gm::norm(ref[i])));
+			gm::transformVectors(mat, points, res, 37);
+			gm::transformVectors<float>(mat, points, ref, 37);
+			for (int i = 0; i < 37; i++)
+				maxError = std::max(maxError, gm::norm(res[i] - ref[i]) / (1.0f + gm::norm(ref[i])));
+			std::copy(points4, points4 + 37, res4);
+			gm::transformHomogeneous(mat, res4, res4, 37);
+			gm::transformHomogeneous<float>(mat, points4, ref4, 37);
+			for (int i = 0; i < 37; i++)
+				maxError = std::max(maxError, gm::norm(res4[i] - ref4[i]) / (1.0f + gm::norm(ref4[i])));
+		}
+		gm::setSimdLevel(detected);
+
+		std::cout << "mat4 * vec4 w : " << moved << std::endl;
+		std::cout << "transform : " << res[36] << ", " << res4[36]
+					<< ", batch transform : " << (maxError < 1e-6f ? "ok" : "error") << std::endl;
+	}
+
+	{
+		// Needs a line swap in Gauss-Jordan, with non integer values
+		const gm::Mat3f	swap(0.0f, 1.5f, 0.0f, 2.5f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f);
+		const gm::Mat2f	mat2(0.0f, 0.5f, 4.0f, 1.0f);
+		float			maxError = 0.0f;
+
+		gm::initRandom(42);
+		for (int n = 0; n < 100; n++)
+		{
+			gm::Mat4f	mat4;
+			gm::Mat3f	mat3;
+
+			for (int i = 0; i < 16; i++)
+				mat4.values[i] = gm::fRand(-10.0f, 10.0f);
+			for (int i = 0; i < 9; i++)
+				mat3.values[i] = gm::fRand(-10.0f, 10.0f);
+
+			const gm::Mat4f	simd = gm::inverse(mat4);
+			gm::Mat4f		generic;
+
+			gm::tryInverse<float>(mat4, generic);
+			const gm::Mat4f	idSimd = mat4 * simd;
+			const gm::Mat4f	idGeneric = mat4 * generic;
+			const gm::Mat3f	id3 = mat3 * gm::inverse(mat3);
+
+			for (int i = 0; i < 16; i++)
+			{
+				const float	id = (i % 5 == 0) ? 1.0f : 0.0f;
+
+				maxError = std::max(maxError, std::abs(idSimd.values[i] - id));
+				maxError = std::max(maxError, std::abs(idGeneric.values[i] - id));
+			}
+			for (int i = 0; i < 9; i++)
+				maxError = std::max(maxError, std::abs(id3.values[i] - ((i % 4 == 0) ? 1.0f : 0.0f)));
+		}
+
+		std::cout << "inverse swap : " << gm::inverse(swap) << ", inverse mat2 : " << gm::inverse(mat2) << std::endl;
+		std::cout << "closed form inverse : " << (maxError < 1e-3f ? "ok" : "error") << std::endl;
+
+		const gm::Mat4f	singular(1, 2, 3, 4, 2, 4, 6, 8, 0, 1, 0, 1, 5, 5, 5, 5);
+		const gm::Mat4f	small = gm::Mat4f(0.01f);
+		gm::Mat4f		out;
+		float			det;
+
+		std::cout << "tryInverse singular : " << gm::tryInverse(singular, out, &det) << ", det " << det
+					<< ", small : " << gm::tryInverse(small, out, &det) << ", det " << det
+					<< ", small epsilon 1e-6 : " << gm::tryInverse(small, out, &det, 1e-6f) << std::endl;
+	}
+
+	{
+		const gm::Mat4f	rigid = gm::Mat4f::translation(gm::Vec3f(3.0f, -1.0f, 2.0f))
+								* gm::Mat4f::rotation3D(gm::normalize(gm::Vec3f(1.0f, -2.0f, 0.5f)), 1.2f);
+		const gm::Mat4f	affine = rigid * gm::Mat4f(1.5f, 0.2f, 0.0f, 0.0f,
+												   0.0f, 0.5f, 0.0f, 0.0f,
+												   0.1f, 0.0f, 2.0f, 0.0f,
+												   0.0f, 0.0f, 0.0f, 1.0f);
+		const gm::Mat4d	affined(affine.values[0], affine.values[1], affine.values[2], affine.values[3],
+								affine.values[4], affine.values[5], affine.values[6], affine.values[7],
+								affine.values[8], affine.values[9], affine.values[10], affine.values[11],
+								0.0, 0.0, 0.0, 1.0);
+		const gm::Mat4f	refRigid = gm::inverse(rigid);
+		const gm::Mat4f	refAffine = gm::inverse(affine);
+		const gm::Mat4f	genericRigid = gm::inverseRigid<float>(rigid);
+		const gm::Mat4d	genericAffine = gm::inverseAffine(affined);
+		const gm::Mat4f	simdRigid = gm::inverseRigid(rigid);
+		const gm::Mat4f	simdAffine = gm::inverseAffine(affine);
+		float			maxError = 0.0f;
+
+		for (int i = 0; i < 16; i++)
+		{
+			maxError = std::max(maxError, std::abs(genericRigid.values[i] - refRigid.values[i]));
+			maxError = std::max(maxError, std::abs(simdRigid.values[i] - refRigid.values[i]));
+			maxError = std::max(maxError, std::abs(static_cast<float>(genericAffine.values[i]) - refAffine.values[i]));
+			maxError = std::max(maxError, std::abs(simdAffine.values[i] - refAffine.values[i]));
+		}
+
+		gm::Mat4f	out;
+		std::cout << "inverse rigid * rigid :" << std::endl;
+		gm::print(simdRigid * rigid);
+		std::cout << "singular affine : " << gm::tryInverseAffine(gm::Mat4f(0.0f), out) << std::endl;
+		std::cout << "rigid and affine inverse : " << (maxError < 1e-5f ? "ok" : "error") << std::endl;
+	}
+
+	{
+		const gm::Vec3f		axis = gm::normalize(gm::Vec3f(1.0f, -2.0f, 0.5f));
+		const gm::Affine3f	a1 = gm::Affine3f::translation(gm::Vec3f(3.0f, -1.0f, 2.0f))
+								* gm::Affine3f::rotation(axis, 1.2f);
+		const gm::Affine3f	a2 = gm::Affine3f::scale(gm::Vec3f(1.5f, 0.5f, 2.0f))
+								* gm::Affine3f::translation(gm::Vec3f(-4.0f, 0.5f, 1.0f));
+		const gm::Mat4f		m1 = gm::Mat4f::translation(gm::Vec3f(3.0f, -1.0f, 2.0f))
+								* gm::Mat4f::rotation3D(axis, 1.2f);
+		const gm::Mat4f		m2 = static_cast<gm::Mat4f>(a2);
+		const gm::Affine3f	compose = a1 * a2;
+		const gm::Mat4f		composeRef = m1 * m2;
+		const gm::Vec3f		point(0.3f, 2.0f, -1.5f);
+		gm::Vec4f			pointRef = composeRef * gm::Vec4f(point.x, point.y, point.z, 1.0f);
+		gm::Vec4f			vectorRef = composeRef * gm::Vec4f(point.x, point.y, point.z, 0.0f);
+		const gm::Mat4f		invRef = gm::inverse(composeRef);
+		const gm::Mat4f		inv = static_cast<gm::Mat4f>(gm::inverse(compose));
+		const gm::Mat4f		invRigid = static_cast<gm::Mat4f>(gm::inverseRigid(a1));
+		const gm::Mat4f		invRigidRef = gm::inverse(m1);
+		const gm::Mat4f		composeMat = static_cast<gm::Mat4f>(compose);
+		float				maxError = 0.0f;
+
+		for (int i = 0; i < 16; i++)
+		{
+			maxError = std::max(maxError, std::abs(composeMat.values[i] - composeRef.values[i]));
+			maxError = std::max(maxError, std::abs(inv.values[i] - invRef.values[i]));
+			maxError = std::max(maxError, std::abs(invRigid.values[i] - invRigidRef.values[i]));
+		}
+		maxError = std::max(maxError, gm::norm(compose * point - pointRef.xyz()));
+		maxError = std::max(maxError, gm::norm(gm::transformVector(compose, point) - vectorRef.xyz()));
+
+		gm::Affine3f	out;
+		std::cout << "affine3 :" << std::endl;
+		gm::print(a2);
+		std::cout << "affine3 mat4 round trip : " << (gm::Affine3f(m2) == a2) << std::endl;
+		std::cout << "affine3 singular : " << gm::tryInverse(gm::Affine3f(), out) << std::endl;
+		std::cout << "affine3 compose, transform and inverse : " << (maxError < 1e-5f ? "ok" : "error") << std::endl;
+	}
+
+	{
+		constexpr gm::Mat4d		model = gm::Mat4d::translation(gm::Vec3d(1.0, 2.0, 3.0)) * gm::Mat4d(2.0);
+		constexpr gm::Vec4d		point = model * gm::Vec4d(1.0, 1.0, 1.0, 1.0);
+		const gm::Vec3f			src[3] = {gm::Vec3f(1.0f), gm::Vec3f(2.0f), gm::Vec3f(3.0f)};
+		gm::Vec3f				dst[3];
+
+		std::memcpy(dst, src, sizeof(src));
+		std::cout << "constexpr transform : " << point << std::endl;
+		std::cout << "memcpy vec3 : " << (dst[2] == src[2]) << std::endl;
+	}
+
+	{
+		gm::Mat3f	mat3 = gm::Mat3f::identity();
+		gm::Vec3f	vec3(1.0f, 2.0f, 3.0f);
+		float		sum = 0.0f;
+
+		for (unsigned int i = 0; i < 3; i++)
+		{
+			mat3.set(i, 0, vec3[i]);
+			sum += mat3[i] + mat3.get(i, 1);
+		}
+		std::cout << "bounds check : " << GM_BOUNDS_CHECK << ", noexcept accessors : "
+					<< (noexcept(vec3[0]) && noexcept(mat3.get(0, 0)) && noexcept(mat3[0])) << ", sum : " << sum << std::endl;
+	}
+
+	{
+		const gm::Vec3f	a(1.0f, 2.0f, 3.0f);
+		const gm::Vec3f	b(0.5f, -1.0f, 4.0f);
+		const gm::Vec3f	c(2.0f, 2.0f, -2.0f);
+		const gm::Vec3f	lazyRes = gm::eval(gm::lazy(a) + (gm::lazy(b) - c) * 2.0f - a / 4.0f);
+		gm::Vec3SoAf	pos(5);
+		gm::Vec3SoAf	vel(5);
+		bool			same = lazyRes == a + (b - c) * 2.0f - a / 4.0f;
+
+		for (std::size_t i = 0; i < pos.size(); i++)
+		{
+			pos[i] = gm::Vec3f(static_cast<float>(i));
+			vel[i] = gm::Vec3f(1.0f, 0.0f, static_cast<float>(i));
+		}
+		gm::assign(pos, gm::lazy(pos) + gm::lazy(vel) * 0.5f - c);
+		for (std::size_t i = 0; i < pos.size(); i++)
+			same = same && gm::Vec3f(pos[i]) == gm::Vec3f(static_cast<float>(i)) + gm::Vec3f(1.0f, 0.0f, static_cast<float>(i)) * 0.5f - c;
+
+		std::cout << "lazy : " << lazyRes << ", soa : " << pos[4] << ", same as operators : " << same << std::endl;
+	}
+
+	{
+		const float		a = 1.0f + 1.0f / 4096.0f;
+		const float		c = -(1.0f + 1.0f / 2048.0f);
+		const gm::Vec4f	v4 = gm::fma(gm::Vec4f(a), gm::Vec4f(a), gm::Vec4f(c));
+		const gm::Vec3d	v3 = gm::fma(gm::Vec3d(1.0, 2.0, 3.0), 2.0, gm::Vec3d(0.5));
+		const gm::Vec2i	v2 = gm::fma(gm::Vec2i(2, 3), gm::Vec2i(4, 5), gm::Vec2i(1));
+
+		std::cout << "fma : " << gm::fma(a, a, c) << ", vec4 : " << v4 << ", vec3 : " << v3
+					<< ", vec2 : " << v2 << ", int : " << gm::fma(3, 4, 5) << std::endl;
+		std::cout << "fused lerp : " << gm::lerp(gm::Vec3f(0.0f, 2.0f, -4.0f), gm::Vec3f(1.0f, 4.0f, 4.0f), 0.25f)
+					<< ", dot : " << gm::dot(gm::Vec4f(1.0f, 2.0f, 3.0f, 4.0f), gm::Vec4f(4.0f))
+					<< ", GM_USE_FMA : "
+#ifdef GM_USE_FMA
+					<< 1 << std::endl;
+#else
+					<< 0 << std::endl;
+#endif
+
+		// Small integers are promoted by the products, like a * b + c
+		const gm::Vec3<short>	vs(1, 2, 3);
+		const gm::Mat3<short>	ms(1, 2, 3, 4, 5, 6, 7, 8, 9);
+		const gm::Vec3<short>	msv = ms * vs;
+		const gm::Mat3<short>	mss = ms * gm::Mat3<short>(2);
+		bool	promoted = gm::dot(vs, gm::Vec3<short>(4, 5, 6)) == 32;
+
+		promoted = promoted && msv == gm::Vec3<short>(14, 32, 50) && mss == ms * static_cast<short>(2);
+		promoted = promoted && gm::dot(gm::Vec3<unsigned char>(200, 1, 0), gm::Vec3<unsigned char>(1, 1, 0)) == 201;
+		promoted = promoted && gm::lerp(1.0, 3.0, 0.25f) == 1.5;
+		std::cout << "promoted dot and products : " << promoted << std::endl;
+
+#if defined(GM_USE_FMA) && defined(GM_FMA)
+		// The fused SSE overloads round like the scalar order of __dot and __madd
+		bool	same = true;
+
+		for (int i = 0; i < 1000; i++)
+		{
+			const gm::Vec4f	v1(gm::fRand(), gm::fRand(), gm::fRand(), gm::fRand());
+			const gm::Vec4f	v2(gm::fRand(), gm::fRand(), gm::fRand(), gm::fRand());
+			const float		range = gm::fRand();
+			const gm::Vec4f	l = gm::lerp(v1, v2, range);
+			const gm::Vec3Af	l3 = gm::lerp(gm::Vec3Af(v1.x, v1.y, v1.z), gm::Vec3Af(v2.x, v2.y, v2.z), range);
+
+			same = same && gm::dot(v1, v2) == gm::__dot(v1.x, v2.x, v1.y, v2.y, v1.z, v2.z, v1.w, v2.w);
+			same = same && gm::dot(gm::Vec3Af(v1.x, v1.y, v1.z), gm::Vec3Af(v2.x, v2.y, v2.z))
+						== gm::__dot(v1.x, v2.x, v1.y, v2.y, v1.z, v2.z);
+			same = same && gm::dot(gm::Quatf(v1.x, v1.y, v1.z, v1.w), gm::Quatf(v2.x, v2.y, v2.z, v2.w))
+						== gm::__dot(v1.x, v2.x, v1.y, v2.y, v1.z, v2.z, v1.w, v2.w);
+			same = same && l.x == gm::__madd(v2.x - v1.x, range, v1.x) && l.y == gm::__madd(v2.y - v1.y, range, v1.y)
+						&& l.z == gm::__madd(v2.z - v1.z, range, v1.z) && l.w == gm::__madd(v2.w - v1.w, range, v1.w);
+			same = same && l3.x == l.x && l3.y == l.y && l3.z == l.z;
+		}
+		std::cout << "fused simd dot and lerp same as scalar : " << same << std::endl;
+#endif
+	}
+
+	{
+		const gm::Vec3f	axis = gm::normalize(gm::Vec3f(1.0f, 2.0f, -0.5f));
+		const gm::Vec3f	axis2 = gm::normalize(gm::Vec3f(-0.3f, 0.2f, 1.0f));
+		const gm::Quatf	q1 = gm::Quatf::rotation(axis, 0.7f);
+		const gm::Quatf	q2 = gm::Quatf::rotation(axis2, -1.9f);
+		const gm::Quatd	q1d(q1.x, q1.y, q1.z, q1.w);
+		const gm::Quatd	q2d(q2.x, q2.y, q2.z, q2.w);
+		const gm::Quatf	composed = q1 * q2;
+		const gm::Quatd	composedD = q1d * q2d;
+		const gm::Vec3f	v(0.5f, -2.0f, 3.0f);
+		const gm::Mat3f	mat = gm::Mat3f::rotation(axis, 0.7f) * gm::Mat3f::rotation(axis2, -1.9f);
+		const gm::Quatf	fromMat(mat);
+		const gm::Quatf	half = gm::slerp(gm::Quatf::identity(), q1, 0.5f);
+		const gm::Quatf	halfNlerp = gm::nlerp(gm::Quatf::identity(), q1, 0.5f);
+		gm::Quatf		keys[5] = {q1, q2, composed, -q1, gm::Quatf::identity()};
+		gm::Mat4f		mats[5];
+		gm::Vec3f		points[5] = {v, -v, axis, axis2, gm::Vec3f(1.0f)};
+		gm::Vec3f		rotated[5];
+		float			maxError = 0.0f;
+
+		maxError = gm::max(maxError, gm::norm(composed * v - mat * v));
+		maxError = gm::max(maxError, gm::norm(gm::Vec3f(static_cast<float>(composedD.x), static_cast<float>(composedD.y),
+								static_cast<float>(composedD.z)) - composed.xyz()));
+		maxError = gm::max(maxError, std::abs(std::abs(gm::dot(fromMat, composed)) - 1.0f));
+		for (int i = 0; i < 9; i++)
+			maxError = gm::max(maxError, std::abs(gm::toMat3(composed).values[i] - mat.values[i]));
+		maxError = gm::max(maxError, gm::norm(half * (half * v) - q1 * v));
+		maxError = gm::max(maxError, std::abs(gm::dot(half, halfNlerp) - 1.0f));
+		maxError = gm::max(maxError, gm::norm(gm::conjugate(q1) * (q1 * v) - v));
+		gm::slerp(keys, keys + 1, 0.25f, keys, 4);
+		gm::toMat4(keys, mats, 5);
+		gm::rotate(q2, points, rotated, 5);
+		for (int i = 0; i < 5; i++)
+			maxError = gm::max(maxError, gm::norm(rotated[i] - q2 * points[i]));
+		maxError = gm::max(maxError, gm::norm(gm::Vec3f((mats[0] * gm::Vec4f(v.x, v.y, v.z, 0.0f)).xyz()) - keys[0] * v));
+
+		std::cout << "quat : " << gm::Quatf::identity() << ", sizeof " << sizeof(gm::Quatf)
+					<< ", slerp angle : " << 2.0f * std::acos(half.w) << std::endl;
+		std::cout << "quat compose, rotate, slerp and matrices : " << (maxError < 1e-5f ? "ok" : "error") << std::endl;
+	}
+
+	{
+		const gm::Vec3f	axis = gm::normalize(gm::Vec3f(0.3f, -1.0f, 0.6f));
+		const float		angle = 1.2f;
+		const gm::Mat3f	mat3 = gm::Mat3f::rotation(axis, angle);
+		const gm::Mat4f	mat4 = gm::Mat4f::rotation3D(axis, angle);
+		const gm::Mat2f	mat2 = gm::Mat2f::rotation(angle);
+		gm::Vec3f		points[7];
+		gm::Vec3f		rotated[7];
+		gm::Vec4f		points4[7];
+		gm::Vec4f		rotated4[7];
+		gm::Vec2f		points2[7];
+		gm::Vec2f		rotated2[7];
+		float			maxError = 0.0f;
+
+		for (int i = 0; i < 7; i++)
+		{
+			points[i] = gm::Vec3f(static_cast<float>(i), 1.0f - static_cast<float>(i), 0.5f * static_cast<float>(i));
+			points4[i] = gm::Vec4f(points[i].x, points[i].y, points[i].z, static_cast<float>(i % 2));
+			points2[i] = gm::Vec2f(points[i].x, points[i].y);
+		}
+		gm::rotate(axis, angle, points, rotated, 7);
+		gm::rotate(axis, angle, points4, rotated4, 7);
+		gm::rotate(angle, points2, rotated2, 7);
+		for (int i = 0; i < 7; i++)
+		{
+			maxError = gm::max(maxError, gm::norm(gm::rotate(points[i], axis, angle) - mat3 * points[i]));
+			maxError = gm::max(maxError, gm::norm(rotated[i] - mat3 * points[i]));
+			maxError = gm::max(maxError, gm::norm(gm::rotate(points4[i], axis, angle) - mat4 * points4[i]));
+			maxError = gm::max(maxError, gm::norm(rotated4[i] - mat4 * points4[i]));
+			maxError = gm::max(maxError, gm::norm(gm::rotate(points2[i], angle) - mat2 * points2[i]));
+			maxError = gm::max(maxError, gm::norm(rotated2[i] - mat2 * points2[i]));
+			maxError = gm::max(maxError, gm::norm(gm::rotateArround(points[i], points[0], axis, angle)
+									- (mat3 * (points[i] - points[0]) + points[0])));
+			maxError = gm::max(maxError, gm::norm(gm::rotateArround(points4[i], points4[1], axis, angle)
+									- (mat4 * (points4[i] - points4[1]) + points4[1])));
+		}
+
+		std::cout << "rotate vec3 : " << gm::rotate(gm::Vec3f(1.0f, 0.0f, 0.0f), gm::Vec3f(0.0f, 0.0f, 1.0f), 1.5707964f)
+					<< ", rodrigues and batch rotate : " << (maxError < 1e-5f ? "ok" : "error") << std::endl;
+	}
+
+	{
+		float	angles[37];
+		float	values[37];
+		float	sinBatch[37];
+		float	cosBatch[37];
+		float	atanBatch[37];
+		float	expBatch[37];
+		float	logBatch[37];
+		float	maxError = 0.0f;
+		double	maxErrord = 0.0;
+
+		for (int i = 0; i < 37; i++)
+		{
+			angles[i] = -20.0f + 1.13f * static_cast<float>(i);
+			values[i] = -1.0f + static_cast<float>(i) / 18.0f;
+		}
+		gm::fast::sincos(angles, sinBatch, cosBatch, 37);
+		gm::fast::atan2(angles, values, atanBatch, 37);
+		gm::fast::exp(angles, expBatch, 37);
+		gm::fast::log(cosBatch, logBatch, 37);
+		for (int i = 0; i < 37; i++)
+		{
+			const double	angle = static_cast<double>(angles[i]);
+			const double	value = static_cast<double>(values[i]);
+			const double	absCos = std::abs(std::cos(angle)) + 0.5;
+
+			maxError = gm::max(maxError, std::abs(gm::fast::sin(angles[i]) - static_cast<float>(std::sin(angle))));
+			maxError = gm::max(maxError, std::abs(gm::fast::cos(angles[i]) - static_cast<float>(std::cos(angle))));
+			maxError = gm::max(maxError, std::abs(gm::fast::acos(values[i]) - static_cast<float>(std::acos(value))));
+			maxError = gm::max(maxError, std::abs(gm::fast::atan2(angles[i], values[i])
+									- static_cast<float>(std::atan2(angle, value))));
+			maxError = gm::max(maxError, std::abs(gm::fast::exp(angles[i]) / static_cast<float>(std::exp(angle)) - 1.0f));
+			maxError = gm::max(maxError, std::abs(sinBatch[i] - gm::fast::sin(angles[i])));
+			maxError = gm::max(maxError, std::abs(cosBatch[i] - gm::fast::cos(angles[i])));
+			maxError = gm::max(maxError, std::abs(atanBatch[i] - gm::fast::atan2(angles[i], values[i])));
+			maxError = gm::max(maxError, std::abs(expBatch[i] / gm::fast::exp(angles[i]) - 1.0f));
+			maxError = gm::max(maxError, std::abs(gm::fast::log(static_cast<float>(absCos))
+									- static_cast<float>(std::log(static_cast<double>(static_cast<float>(absCos))))));
+			maxErrord = gm::max(maxErrord, std::abs(gm::fast::sin(angle) - std::sin(angle)));
+			maxErrord = gm::max(maxErrord, std::abs(gm::fast::cos(angle) - std::cos(angle)));
+			maxErrord = gm::max(maxErrord, std::abs(gm::fast::acos(value) - std::acos(value)));
+			maxErrord = gm::max(maxErrord, std::abs(gm::fast::atan2(angle, value) - std::atan2(angle, value)));
+			maxErrord = gm::max(maxErrord, std::abs(gm::fast::exp(angle) / std::exp(angle) - 1.0));
+			maxErrord = gm::max(maxErrord, std::abs(gm::fast::log(absCos) - std::log(absCos)));
+		}
+		for (int i = 0; i < 37; i++)
+			if (cosBatch[i] > 0.0f)
+				maxError = gm::max(maxError, std::abs(logBatch[i] - gm::fast::log(cosBatch[i])));
+
+		std::cout << "fast sin(1) : " << gm::fast::sin(1.0f) << ", tan(0.5) : " << gm::fast::tan(0.5)
+					<< ", float and batch : " << (maxError < 1e-6f ? "ok" : "error")
+					<< ", double : " << (maxErrord < 1e-14 ? "ok" : "error") << std::endl;
+	}
+
+	{
+		// Error bounds documented in fast.hpp, against the long double libm
+		const std::size_t	count = 50000;
+		std::vector<float>	fx(count);
+		std::vector<float>	fy(count);
+		std::vector<float>	fres(count);
+		std::vector<double>	dx(count);
+		std::vector<double>	dy(count);
+		std::string			failed;
+
+		// Error in ulp of ref, or absolute
+		const auto	error = [](auto res, long double ref, bool absolute) {
+			int	exponent;
+
+			std::frexp(ref, &exponent);
+
+			const long double	diff = std::abs(static_cast<long double>(res) - ref);
+
+			return (absolute ? diff : diff / std::ldexp(1.0L, exponent - std::numeric_limits<decltype(res)>::digits));
+		};
+		const auto	check = [&](const char *name, long double bound, bool absolute, auto res, auto ref) {
+			long double	worst = 0.0L;
+
+			for (std::size_t i = 0; i < count; i++)
+				worst = std::max(worst, error(res(i), ref(i), absolute));
+			if (worst > bound)
+				failed += std::string(" ") + name;
+		};
+		// Float functions are checked alone and in batch at every level
+		const auto	checkFloat = [&](const char *name, long double bound, bool absolute, auto scalar, auto batch, auto ref) {
+			const gm::SimdLevel	detected = gm::detectSimdLevel();
+
+			check(name, bound, absolute, [&](std::size_t i) { return (scalar(fy[i], fx[i])); }, ref);
+			for (int level = 0; level <= static_cast<int>(detected); level++)
+			{
+				gm::setSimdLevel(static_cast<gm::SimdLevel>(level));
+				batch(fy.data(), fx.data(), fres.data());
+				check(name, bound, absolute, [&](std::size_t i) { return (fres[i]); }, ref);
+			}
+			gm::setSimdLevel(detected);
+		};
+		const auto	fill = [&](float low, float high) {
+			for (std::size_t i = 0; i < count; i++)
+				fx[i] = gm::fRand(low, high);
+		};
+		const auto	fillDouble = [&](double low, double high, double minCos) {
+			for (std::size_t i = 0; i < count; i++)
+				do
+					dx[i] = gm::dRand(low, high);
+				while (std::abs(std::cos(dx[i])) < minCos);
+		};
+		const auto	refFloat = [&](long double (*f)(long double)) {
+			return ([&fx, f](std::size_t i) { return (f(fx[i])); });
+		};
+		const auto	refDouble = [&](long double (*f)(long double)) {
+			return ([&dx, f](std::size_t i) { return (f(dx[i])); });
+		};
+		long double	(*ldSin)(long double) = std::sin;
+		long double	(*ldCos)(long double) = std::cos;
+		long double	(*ldTan)(long double) = std::tan;
+		long double	(*ldAcos)(long double) = std::acos;
+		long double	(*ldExp)(long double) = std::exp;
+		long double	(*ldLog)(long double) = std::log;
+
+		gm::initRandom(11);
+		fill(-8192.0f, 8192.0f);
+		checkFloat("sinf", 1e-7L, true, [](float, float x) { return (gm::fast::sin(x)); },
+					[](const float *, const float *x, float *res) { gm::fast::sin(x, res, count); }, refFloat(ldSin));
+		checkFloat("cosf", 1e-7L, true, [](float, float x) { return (gm::fast::cos(x)); },
+					[](const float *, const float *x, float *res) { gm::fast::cos(x, res, count); }, refFloat(ldCos));
+		fill(-3.14159f, 3.14159f);
+		checkFloat("sinf pi", 2.0L, false, [](float, float x) { return (gm::fast::sin(x)); },
+					[](const float *, const float *x, float *res) { gm::fast::sin(x, res, count); }, refFloat(ldSin));
+		checkFloat("cosf pi", 2.0L, false, [](float, float x) { return (gm::fast::cos(x)); },
+					[](const float *, const float *x, float *res) { gm::fast::cos(x, res, count); }, refFloat(ldCos));
+		fill(-1.5f, 1.5f);
+		checkFloat("tanf", 4.0L, false, [](float, float x) { return (gm::fast::tan(x)); },
+					[](const float *, const float *x, float *res) { gm::fast::tan(x, res, count); }, refFloat(ldTan));
+		fill(-1.0f, 1.0f);
+		checkFloat("acosf", 4.0L, false, [](float, float x) { return (gm::fast::acos(x)); },
+					[](const float *, const float *x, float *res) { gm::fast::acos(x, res, count); }, refFloat(ldAcos));
+		for (std::size_t i = 0; i < count; i++)
+			fy[i] = gm::fRand(-1.0f, 1.0f);
+		checkFloat("atan2f", 3.5L, false, [](float y, float x) { return (gm::fast::atan2(y, x)); },
+					[](const float *y, const float *x, float *res) { gm::fast::atan2(y, x, res, count); },
+					[&](std::size_t i) { return (std::atan2(static_cast<long double>(fy[i]), static_cast<long double>(fx[i]))); });
+		fill(-87.0f, 88.0f);
+		checkFloat("expf", 1.1L, false, [](float, float x) { return (gm::fast::exp(x)); },
+					[](const float *, const float *x, float *res) { gm::fast::exp(x, res, count); }, refFloat(ldExp));
+		for (std::size_t i = 0; i < count; i++)
+			fx[i] = std::exp(fx[i]);
+		checkFloat("logf", 1.0L, false, [](float, float x) { return (gm::fast::log(x)); },
+					[](const float *, const float *x, float *res) { gm::fast::log(x, res, count); }, refFloat(ldLog));
+
+		fillDouble(-1e6, 1e6, 0.0);
+		check("sin", 2.2e-16L, true, [&](std::size_t i) { return (gm::fast::sin(dx[i])); }, refDouble(ldSin));
+		check("cos", 2.2e-16L, true, [&](std::size_t i) { return (gm::fast::cos(dx[i])); }, refDouble(ldCos));
+		fillDouble(-3.14159, 3.14159, 0.0);
+		check("sin pi", 2.0L, false, [&](std::size_t i) { return (gm::fast::sin(dx[i])); }, refDouble(ldSin));
+		check("cos pi", 2.0L, false, [&](std::size_t i) { return (gm::fast::cos(dx[i])); }, refDouble(ldCos));
+		fillDouble(-1.5, 1.5, 0.0);
+		check("tan", 3.5L, false, [&](std::size_t i) { return (gm::fast::tan(dx[i])); }, refDouble(ldTan));
+		fillDouble(-1e6, 1e6, 0.1);
+		check("tan 1e6", 5.0L, false, [&](std::size_t i) { return (gm::fast::tan(dx[i])); }, refDouble(ldTan));
+		fillDouble(-1.0, 1.0, 0.0);
+		check("acos", 2.5L, false, [&](std::size_t i) { return (gm::fast::acos(dx[i])); }, refDouble(ldAcos));
+		for (std::size_t i = 0; i < count; i++)
+			dy[i] = gm::dRand(-1.0, 1.0);
+		check("atan2", 2.0L, false, [&](std::size_t i) { return (gm::fast::atan2(dy[i], dx[i])); },
+				[&](std::size_t i) { return (std::atan2(static_cast<long double>(dy[i]), static_cast<long double>(dx[i]))); });
+		fillDouble(-708.0, 709.0, 0.0);
+		check("exp", 2.0L, false, [&](std::size_t i) { return (gm::fast::exp(dx[i])); }, refDouble(ldExp));
+		for (std::size_t i = 0; i < count; i++)
+			dx[i] = std::exp(dx[i]);
+		check("log", 1.0L, false, [&](std::size_t i) { return (gm::fast::log(dx[i])); }, refDouble(ldLog));
+
+		std::cout << "fast math bounds : " << (failed.empty() ? "ok" : "error" + failed) << std::endl;
+	}
+
+	{
+		gm::Vec3f	points[11];
+		gm::Vec3f	fastRes[11];
+		gm::Vec3f	safeRes[11];
+		gm::Vec4f	points4[11];
+		gm::Vec4f	fast4[11];
+		gm::Vec2f	points2[11];
+		gm::Vec2f	safe2[11];
+		float		maxError = 0.0f;
+
+		for (int i = 0; i < 11; i++)
+		{
+			points[i] = gm::Vec3f(static_cast<float>(i) - 4.0f, 0.5f * static_cast<float>(i), 3.0f);
+			points4[i] = gm::Vec4f(points[i].x, points[i].y, points[i].z, -static_cast<float>(i));
+			points2[i] = gm::Vec2f(points[i].x, points[i].y);
+		}
+		points2[4] = gm::Vec2f(1e-9f, 0.0f);
+		gm::normalizeFast(points, fastRes, 11);
+		gm::normalizeSafe(points, safeRes, 11);
+		gm::normalizeFast(points4, fast4, 11);
+		gm::normalizeSafe(points2, safe2, 11);
+		for (int i = 0; i < 11; i++)
+		{
+			maxError = gm::max(maxError, gm::norm(fastRes[i] - gm::normalize(points[i])));
+			maxError = gm::max(maxError, gm::norm(gm::normalizeFast(points[i]) - gm::normalize(points[i])));
+			maxError = gm::max(maxError, gm::norm(safeRes[i] - gm::normalize(points[i])));
+			maxError = gm::max(maxError, gm::norm(gm::normalizeSafe(points[i]) - gm::normalize(points[i])));
+			maxError = gm::max(maxError, gm::norm(fast4[i] - gm::normalize(points4[i])));
+			maxError = gm::max(maxError, gm::norm(gm::normalizeSafe(points4[i]) - gm::normalize(points4[i])));
+			if (i != 4)
+				maxError = gm::max(maxError, gm::norm(safe2[i] - gm::normalize(points2[i])));
+		}
+
+		std::cout << "normalizeSafe null : " << gm::normalizeSafe(gm::Vec3f()) << ", " << safe2[4]
+					<< ", " << gm::normalizeSafe(gm::Vec4f(1e-8f, 0.0f, 0.0f, 0.0f))
+					<< ", fast and safe normalize : " << (maxError < 1e-6f ? "ok" : "error") << std::endl;
+	}
+
+	{
+		const float	values[12] = {-2.5f, -1.5f, -0.75f, -0.5f, -0.0f, 0.25f, 0.5f, 0.49999997f, 1.5f, 2.5f, 3.7f, -8.3f};
+		gm::Vec4f	vec4[3];
+		gm::Vec3f	vec3[4];
+		gm::Vec4f	res4[3];
+		gm::Vec3f	res3[4];
+		int			errors = 0;
+
+		for (int i = 0; i < 12; i++)
+		{
+			(&vec4[0].x)[i] = values[i];
+			(&vec3[0].x)[i] = values[i];
+		}
+		// Batch kernels, SSE Vec4f and generic Vec3f against the scalar functions
+		auto	check = [&](auto scalar, auto function)
+		{
+			function(vec4, res4, static_cast<std::size_t>(3));
+			function(vec3, res3, static_cast<std::size_t>(4));
+			for (int i = 0; i < 12; i++)
+			{
+				const float		expected = scalar(values[i]);
+				const gm::Vec4f	single4 = function(vec4[i / 4]);
+				const gm::Vec3f	single3 = function(vec3[i / 3]);
+
+				errors += (&res4[0].x)[i] != expected;
+				errors += (&res3[0].x)[i] != expected;
+				errors += (&single4.x)[i % 4] != expected;
+				errors += (&single3.x)[i % 3] != expected;
+			}
+		};
+		check([](float x) { return (gm::abs(x)); }, [](auto &&... args) { return (gm::abs(args...)); });
+		check([](float x) { return (gm::sign(x)); }, [](auto &&... args) { return (gm::sign(args...)); });
+		check([](float x) { return (std::floor(x)); }, [](auto &&... args) { return (gm::floor(args...)); });
+		check([](float x) { return (std::ceil(x)); }, [](auto &&... args) { return (gm::ceil(args...)); });
+		check([](float x) { return (std::round(x)); }, [](auto &&... args) { return (gm::round(args...)); });
+		check([](float x) { return (gm::fract(x)); }, [](auto &&... args) { return (gm::fract(args...)); });
+
+		gm::clamp(vec3, -1.0f, 1.0f, res3, 4);
+		gm::smoothstep(-1.0f, 1.0f, vec4, res4, 3);
+		for (int i = 0; i < 12; i++)
+		{
+			errors += (&res3[0].x)[i] != gm::clamp(values[i], -1.0f, 1.0f);
+			errors += gm::abs((&res4[0].x)[i] - gm::smoothstep(-1.0f, 1.0f, values[i])) > 1e-6f;
+		}
+		gm::step(0.5f, vec4, res4, 3);
+		gm::min(vec4, res4, res4, 3);
+		errors += res4[1] != gm::min(vec4[1], gm::step(gm::Vec4f(0.5f), vec4[1]));
+
+		const gm::Vec4b	mask = gm::lessThan(vec4[2], gm::Vec4f(2.0f));
+		const gm::Vec3b	mask3 = gm::greaterEqual(gm::Vec3d(1.0, 2.0, 3.0), gm::Vec3d(2.0));
+
+		std::cout << "component-wise : " << (errors == 0 ? "ok" : "error")
+					<< ", mask " << mask << ", " << mask3
+					<< ", select " << gm::select(mask, vec4[2], gm::Vec4f(0.0f))
+					<< ", any " << gm::any(mask3) << ", all " << gm::all(mask3) << std::endl;
+	}
+
+	{
+		static gm::half		halfs[65536];
+		static float		floats[65536];
+		static gm::half		back[65536];
+		int					errors = 0;
+
+		// Every half to float and back, batch against single conversions
+		for (unsigned int i = 0; i < 65536; i++)
+			halfs[i].setBits(static_cast<std::uint16_t>(i));
+		gm::toFloat(halfs, floats, 65536);
+		gm::toHalf(floats, back, 65536);
+		for (unsigned int i = 0; i < 65536; i++)
+		{
+			const bool	nan = (i & 0x7C00) == 0x7C00 && (i & 0x3FF) != 0;
+
+			if (nan)
+				errors += !std::isnan(floats[i]) || !std::isnan(static_cast<float>(back[i]));
+			else
+				errors += floats[i] != static_cast<float>(halfs[i]) || back[i].getBits() != i;
+		}
+
+		// Rounding of floats between halfs, ties to even
+		for (unsigned int i = 0; i < 65536; i++)
+		{
+			std::uint32_t	bits = static_cast<std::uint32_t>(i) * 65537u;
+
+			std::memcpy(&floats[i], &bits, sizeof(float));
+		}
+		gm::toHalf(floats, back, 65536);
+		for (unsigned int i = 0; i < 65536; i++)
+		{
+			if (std::isnan(floats[i]))
+				errors += !std::isnan(static_cast<float>(back[i]));
+			else
+				errors += back[i].getBits() != gm::half(floats[i]).getBits();
+		}
+
+		gm::Vec3f	points[5] = {gm::Vec3f(1.0f, -2.5f, 0.1f), gm::Vec3f(65504.0f, 70000.0f, 1e-7f),
+								gm::Vec3f(1.0f + 1.0f / 2048.0f, 1.0f + 3.0f / 2048.0f, -0.0f),
+								gm::Vec3f(3.14159f), gm::Vec3f(-1e-5f, 2048.5f, 0.333f)};
+		gm::Vec3h	packed[5];
+		gm::Vec3f	unpacked[5];
+
+		gm::toHalf(points, packed, 5);
+		gm::toFloat(packed, unpacked, 5);
+		for (int i = 0; i < 5; i++)
+			errors += unpacked[i] != gm::toFloat(gm::toHalf(points[i]));
+
+		// Arithmetic through float, rounded when stored in half
+		gm::Vec3h		sum = packed[0] + packed[3];
+		const gm::Vec3h	a(gm::half(1.0f), gm::half(2.0f), gm::half(-3.0f));
+		const gm::Vec3h	b(gm::half(0.5f), gm::half(4.0f), gm::half(1.0f));
+
+		sum *= gm::half(2.0f);
+		errors += sum != gm::toHalf((unpacked[0] + unpacked[3]) * 2.0f);
+		errors += static_cast<float>(gm::dot(a, b)) != 5.5f;
+		errors += gm::lerp(a, b, gm::half(0.5f)) != gm::Vec3h(gm::half(0.75f), gm::half(3.0f), gm::half(-1.0f));
+		errors += a * 2.0f != gm::Vec3h(gm::half(2.0f), gm::half(4.0f), gm::half(-6.0f));
+		errors += gm::hash(a) != gm::hash(gm::toHalf(gm::Vec3f(1.0f, 2.0f, -3.0f)));
+		errors += std::hash<gm::half>{}(gm::half(0.0f)) != std::hash<gm::half>{}(gm::half(-0.0f));
+		std::cout << "half : " << (errors == 0 ? "ok" : "error") << ", " << unpacked[0] << ", " << unpacked[1]
+					<< ", " << unpacked[2] << ", sum " << sum << ", " << sizeof(gm::Vec3h) << " bytes" << std::endl;
+	}
+
+	{
+		static gm::Vec3f		normals[1001];
+		static gm::Vec3f		hemisphere[1001];
+		static gm::Vec3f		decoded[1001];
+		static std::uint32_t	encoded[1001];
+		int						errors = 0;
+		float					maxAngle = 0.0f;
+		float					maxError1010102 = 0.0f;
+		float					maxErrorSnorm = 0.0f;
+
+		// Fibonacci sphere, then the axes
+		for (int i = 0; i < 1001; i++)
+		{
+			const float	z = 1.0f - (static_cast<float>(i) + 0.5f) / 500.5f;
+			const float	r = std::sqrt(1.0f - z * z);
+			const float	a = 2.39996323f * static_cast<float>(i);
+
+			normals[i] = gm::Vec3f(r * std::cos(a), r * std::sin(a), z);
+		}
+		normals[0] = gm::Vec3f(0.0f, 0.0f, -1.0f);
+		normals[1] = gm::Vec3f(-1.0f, 0.0f, 0.0f);
+		normals[2] = gm::Vec3f(0.0f, 1.0f, 0.0f);
+
+		const gm::SimdLevel	detected = gm::detectSimdLevel();
+		for (int level = 0; level <= static_cast<int>(detected); level++)
+		{
+			gm::setSimdLevel(static_cast<gm::SimdLevel>(level));
+			gm::encodeOctahedral(normals, encoded, 1001);
+			gm::decodeOctahedral(encoded, decoded, 1001);
+			for (int i = 0; i < 1001; i++)
+			{
+				errors += encoded[i] != gm::encodeOctahedral(normals[i]);
+				// Equal bits, unless this file is built with fma contraction
+				errors += gm::norm(decoded[i] - gm::decodeOctahedral(encoded[i])) > 1e-6f;
+				maxAngle = gm::max(maxAngle, gm::norm(decoded[i] - normals[i]));
+			}
+			gm::encode1010102(normals, encoded, 1001);
+			gm::decode1010102(encoded, decoded, 1001);
+			for (int i = 0; i < 1001; i++)
+			{
+				errors += encoded[i] != gm::encode1010102(normals[i]);
+				errors += decoded[i] != gm::decode1010102(encoded[i]);
+				maxError1010102 = gm::max(maxError1010102, gm::norm(decoded[i] - normals[i]));
+				hemisphere[i] = gm::Vec3f(normals[i].x, normals[i].y, std::abs(normals[i].z));
+			}
+			gm::encodeSnorm16x2(hemisphere, encoded, 1001);
+			gm::decodeSnorm16x2(encoded, decoded, 1001);
+			for (int i = 0; i < 1001; i++)
+			{
+				errors += encoded[i] != gm::encodeSnorm16x2(hemisphere[i]);
+				// z is sqrt(1 - x^2 - y^2), sensitive to the last bits near 0
+				errors += gm::norm(decoded[i] - gm::decodeSnorm16x2(encoded[i])) > 1e-3f;
+				maxErrorSnorm = gm::max(maxErrorSnorm, gm::norm(decoded[i] - hemisphere[i]));
+			}
+		}
+		gm::setSimdLevel(detected);
+
+		std::cout << "normal encodings : " << (errors == 0 ? "ok" : "error")
+					<< ", octahedral " << (maxAngle < 7e-5f ? "ok" : "error")
+					<< ", 1010102 " << (maxError1010102 < 2e-3f ? "ok" : "error")
+					<< ", snorm16x2 " << (maxErrorSnorm < 7e-3f ? "ok" : "error") << std::endl;
+	}
+
+	{
+		const gm::Vec3f	axis = gm::normalize(gm::Vec3f(1.0f, -2.0f, 0.5f));
+		const gm::Vec3f	eye(4.0f, -3.0f, 2.0f);
+		const gm::Mat4f	rows = gm::Mat4f::perspective(1.2f, 1.5f, 0.1f, 100.0f)
+								* gm::Mat4f::lookAt(eye, gm::Vec3f(), gm::Vec3f(0.0f, 0.0f, 1.0f))
+								* gm::Mat4f::translation(gm::Vec3f(1.0f, 2.0f, 3.0f)) * gm::Mat4f::rotation3D(axis, 0.7f);
+		const gm::Mat4fc	columns = gm::Mat4fc::perspective(1.2f, 1.5f, 0.1f, 100.0f)
+								* gm::Mat4fc::lookAt(eye, gm::Vec3f(), gm::Vec3f(0.0f, 0.0f, 1.0f))
+								* gm::Mat4fc::translation(gm::Vec3f(1.0f, 2.0f, 3.0f)) * gm::Mat4fc::rotation3D(axis, 0.7f);
+		const gm::Mat4f	transposed = gm::transpose(rows);
+		const gm::Mat4fc	invColumns = gm::inverse(columns);
+		const gm::Mat4fc	affine = gm::Mat4fc::translation(gm::Vec3f(1.0f, 2.0f, 3.0f)) * gm::toMat4<gm::ColumnMajor>(gm::Quatf(axis, 0.7f));
+		const gm::Mat4f	invAffine = gm::inverseAffine(gm::Mat4f(affine));
+		const gm::Vec4f	point(0.5f, -1.0f, 2.0f, 1.0f);
+		const gm::Vec3f	points[2] = {gm::Vec3f(0.5f, -1.0f, 2.0f), gm::Vec3f(-3.0f, 1.0f, 0.25f)};
+		gm::Vec3f		rowPoints[2];
+		gm::Vec3f		columnPoints[2];
+		float			maxError = 0.0f;
+
+		gm::transformPoints(rows, points, rowPoints, 2);
+		gm::transformPoints(columns, points, columnPoints, 2);
+		for (int i = 0; i < 16; i++)
+		{
+			maxError = std::max(maxError, std::abs(columns.values[i] - transposed.values[i]) / 100.0f);
+			maxError = std::max(maxError, std::abs(gm::Mat4f(invColumns).values[i] - gm::inverse(rows).values[i]) / 100.0f);
+			maxError = std::max(maxError, std::abs(gm::inverseAffine(affine).values[i] - gm::Mat4fc(invAffine).values[i]));
+		}
+		maxError = std::max(maxError, gm::norm(columns * point - rows * point) / 100.0f);
+		maxError = std::max(maxError, gm::norm(rowPoints[1] - columnPoints[1]) / 100.0f);
+
+		const gm::Mat4fc	projection = gm::Mat4fc::perspective(1.2f, 1.5f, 0.1f, 100.0f);
+		const gm::Vec4f		near = projection * gm::Vec4f(0.0f, 0.0f, -0.1f, 1.0f);
+		const gm::Vec4f		far = projection * gm::Vec4f(0.0f, 0.0f, -100.0f, 1.0f);
+
+		std::cout << "column major translation : " << gm::Mat4fc::translation(gm::Vec3f(1.0f, 2.0f, 3.0f))[12]
+					<< ", " << gm::Mat4fc::translation(gm::Vec3f(1.0f, 2.0f, 3.0f))[13]
+					<< ", " << gm::Mat4fc::translation(gm::Vec3f(1.0f, 2.0f, 3.0f))[14] << std::endl;
+		std::cout << "perspective depth near : " << near.z / near.w << ", far : " << far.z / far.w << std::endl;
+		std::cout << "column major matches row major : " << (maxError < 1e-5f ? "ok" : "error") << std::endl;
+	}
+
+	{
+		typedef gm::BlockLayout<gm::Std140, gm::Mat4f, gm::Mat3f, gm::Vec3f, float, gm::Vec2f[2]>	Uniforms;
+		typedef gm::BlockLayout<gm::Std430, gm::Mat3fc, gm::Vec3f, float[3]>						Storage;
+
+		const gm::Mat4f		mvp = gm::Mat4f::translation(gm::Vec3f(1.0f, 2.0f, 3.0f));
+		const gm::Mat3f		normal(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f);
+		const gm::Vec2f		offsets[2] = {gm::Vec2f(-1.0f, 1.0f), gm::Vec2f(0.5f, 0.25f)};
+		const float			weights[3] = {0.25f, 0.5f, 0.75f};
+		const gm::Vec3f		points[2] = {gm::Vec3f(1.0f, 2.0f, 3.0f), gm::Vec3f(4.0f, 5.0f, 6.0f)};
+		float				block[Uniforms::size() / sizeof(float)];
+		float				storage[Storage::size() / sizeof(float)];
+		float				array[8];
+		bool				ok = true;
+
+		std::fill(block, block + Uniforms::size() / sizeof(float), -1.0f);
+		Uniforms::pack(block, mvp, normal, gm::Vec3f(7.0f, 8.0f, 9.0f), 10.0f, offsets);
+		// Columns of mvp, translation in the last one
+		ok = ok && block[12] == 1.0f && block[13] == 2.0f && block[14] == 3.0f && block[15] == 1.0f;
+		// mat3 columns padded to vec4, padding untouched
+		ok = ok && block[16] == 1.0f && block[17] == 4.0f && block[18] == 7.0f && block[19] == -1.0f && block[20] == 2.0f;
+		ok = ok && block[28] == 7.0f && block[30] == 9.0f && block[31] == 10.0f;
+		// vec2 array with a 16 bytes stride
+		ok = ok && block[32] == -1.0f && block[33] == 1.0f && block[36] == 0.5f && block[37] == 0.25f;
+		Uniforms::write<3>(block, 11.0f);
+		ok = ok && Uniforms::size() == 160 && Uniforms::offset(4) == 128 && block[31] == 11.0f;
+
+		Storage::pack(storage, gm::Mat3fc(normal), gm::Vec3f(7.0f, 8.0f, 9.0f), weights);
+		ok = ok && storage[1] == 4.0f && storage[4] == 2.0f && storage[12] == 7.0f && storage[14] == 9.0f
+				&& storage[15] == 0.25f && storage[17] == 0.75f && Storage::size() == 80;
+
+		gm::packArray<gm::Std430>(array, points, 2);
+		ok = ok && array[2] == 3.0f && array[4] == 4.0f && array[6] == 6.0f;
+		std::cout << "std140 and std430 packing : " << (ok ? "ok" : "error") << std::endl;
+	}
+
+	{
+		gm::Buffer<gm::Mat4fA>			models(3, gm::Mat4f::translation(gm::Vec3f(1.0f, 2.0f, 3.0f)));
+		gm::Buffer<gm::Vec3f>			points(5, gm::Vec3f(1.0f, 1.0f, 1.0f));
+		gm::Buffer<gm::Vec4dA, 32>		positions;
+		std::vector<gm::Mat3fA>			normals(2, gm::Mat3f::identity());
+		const gm::Mat4fA				rotation = gm::Mat4f::rotation3D(gm::Vec3f(0.0f, 0.0f, 1.0f), 0.5f);
+		bool							ok = true;
+
+		models.push_back(rotation * models[0]);
+		positions.push_back(gm::Vec4d(1.0, 2.0, 3.0, 1.0));
+		positions.resize(9);
+		for (std::size_t i = 0; i < models.size(); i++)
+			ok = ok && reinterpret_cast<std::uintptr_t>(&models[i]) % 64 == 0;
+		ok = ok && reinterpret_cast<std::uintptr_t>(points.data()) % GM_SIMD_ALIGNMENT == 0
+				&& reinterpret_cast<std::uintptr_t>(positions.data()) % 32 == 0
+				&& reinterpret_cast<std::uintptr_t>(&normals[1]) % 16 == 0;
+		gm::transformPoints(models[3], points, points);
+		ok = ok && gm::norm(points[4] - (rotation.asMat3() * gm::Vec3f(2.0f, 3.0f, 4.0f))) < 1e-5f;
+
+		gm::Buffer<float>		values(19, 2.0f);
+		gm::Buffer<float, 16>	sums;
+
+		gm::madd(values, 3.0f, values, sums);
+		ok = ok && sums.size() == 19 && sums[18] == 8.0f;
+		ok = ok && models[3].get(3, 0) == (rotation * models[0]).get(3, 0) && positions[0].z == 3.0;
+		std::cout << "aligned buffers : " << (ok ? "ok" : "error") << std::endl;
+	}
+
+	{
+		const gm::Frustumd	reference(gm::Mat4d::perspective(1.0, 1.5, 0.1, 50.0)
+										* gm::Mat4d::lookAt(gm::Vec3d(0.0, 0.0, 5.0), gm::Vec3d(), gm::Vec3d(0.0, 1.0, 0.0)));
+		const gm::Frustumf	frustum(gm::Mat4fc::perspective(1.0f, 1.5f, 0.1f, 50.0f)
+										* gm::Mat4fc::lookAt(gm::Vec3f(0.0f, 0.0f, 5.0f), gm::Vec3f(), gm::Vec3f(0.0f, 1.0f, 0.0f)));
+		gm::Vec3SoAf		centers;
+		gm::Vec3SoAf		mins;
+		gm::Vec3SoAf		maxs;
+		float				radius[203];
+		std::uint32_t		spheres[gm::cullMaskSize(203)];
+		std::uint32_t		boxes[gm::cullMaskSize(203)];
+		std::size_t			visible = 0;
+		bool				ok = reference.contains(gm::Vec3d(0.0, 0.0, 0.0)) && !reference.contains(gm::Vec3d(0.0, 0.0, 6.0))
+									&& !reference.contains(gm::Vec3d(0.0, 0.0, -46.0));
+
+		for (unsigned int p = 0; p < 6; p++)
+			ok = ok && gm::norm(gm::Vec4d(frustum.planes[p].x, frustum.planes[p].y, frustum.planes[p].z,
+											frustum.planes[p].w) - reference.planes[p]) < 1e-3;
+
+		gm::initRandom(7);
+		for (int i = 0; i < 203; i++)
+		{
+			const gm::Vec3f	center(gm::fRand(-30.0f, 30.0f), gm::fRand(-30.0f, 30.0f), gm::fRand(-50.0f, 10.0f));
+			const gm::Vec3f	half(gm::fRand(0.0f, 2.0f), gm::fRand(0.0f, 2.0f), gm::fRand(0.0f, 2.0f));
+
+			centers.pushBack(center);
+			mins.pushBack(center - half);
+			maxs.pushBack(center + half);
+			radius[i] = gm::norm(half);
+		}
+
+		const gm::SimdLevel	detected = gm::detectSimdLevel();
+		for (int level = 0; level <= static_cast<int>(detected); level++)
+		{
+			gm::setSimdLevel(static_cast<gm::SimdLevel>(level));
+			gm::cullSpheres(frustum, centers, radius, spheres);
+			gm::cullAABBs(frustum, mins, maxs, boxes);
+			for (std::size_t i = 0; i < centers.size(); i++)
+			{
+				const gm::Vec3d	center(gm::Vec3f(centers[i]).x, gm::Vec3f(centers[i]).y, gm::Vec3f(centers[i]).z);
+				const double	scale = 1.0 + 1e-4 / radius[i];
+
+				// Spheres a bit smaller or bigger than radius give the same
+				// result unless they touch a plane
+				if (reference.intersectsSphere(center, radius[i] * scale)
+						== reference.intersectsSphere(center, radius[i] / scale))
+					ok = ok && gm::isVisible(spheres, i) == reference.intersectsSphere(center, radius[i]);
+				// A box is inside its bounding sphere
+				ok = ok && (gm::isVisible(spheres, i) || !gm::isVisible(boxes, i));
+				ok = ok && gm::isVisible(boxes, i) == frustum.intersectsAABB(mins[i], maxs[i]);
+			}
+			ok = ok && (spheres[6] >> 11) == 0 && (boxes[6] >> 11) == 0;
+		}
+		gm::setSimdLevel(detected);
+		for (std::size_t i = 0; i < centers.size(); i++)
+			visible += gm::isVisible(spheres, i);
+		std::cout << "frustum culling : " << visible << " visible spheres, " << (ok ? "ok" : "error") << std::endl;
+	}
+
 	{
 		gm::PerlinNoisef	perlinNoisef;
 		gm::PerlinNoised	perlinNoised;